@@ -0,0 +1,433 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+/**
+ * Host microbenchmarks of transaction parsing, decoders, formatting and encoding. Every functional test transaction
+ * is parsed and rendered like during review, cryptography is provided by the OpenSSL shims of the native build.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "os.h"
+#include "cx.h"
+
+#include "globals.h"
+#include "types.h"
+#include "common/base58.h"
+#include "common/buffer.h"
+#include "common/format.h"
+#include "common/macros.h"
+#include "common/wif.h"
+#include "transaction/decoders.h"
+#include "transaction/field.h"
+#include "transaction/transaction_parse.h"
+
+#include "bench.h"
+
+#define STACK_PAINT_LEN   (64 * 1024)
+#define STACK_PAINT_BYTE  0xA5
+#define DEFAULT_MIN_TIME  0.2
+#define MAX_RESULTS       256
+#define MAX_RESULT_NAME   64
+#define CALIBRATION_ROUND 16
+
+typedef void bench_fn_t(const void *arg);
+
+typedef struct {
+    char name[MAX_RESULT_NAME];
+    uint64_t iterations;
+    double ns_per_op;
+    size_t stack_bytes;
+    double allocations_per_op;
+} bench_result_t;
+
+typedef struct {
+    decoder_t *decoder;
+    const char *name;
+    bench_result_t *result;
+    double total_ns;
+} decoder_stats_t;
+
+static bench_result_t g_results[MAX_RESULTS];
+static size_t g_results_count = 0;
+static double g_min_time = DEFAULT_MIN_TIME;
+static const char *g_filter = NULL;
+
+/**
+ * Heap allocations of the application code, which is linked with --wrap for allocation functions
+ */
+static uint64_t g_allocations = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    g_allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    g_allocations++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    g_allocations++;
+    return __real_realloc(ptr, size);
+}
+
+static decoder_stats_t g_decoders[] = {
+    {&decoder_operation_name, "decoder_operation_name"},
+    {&decoder_string, "decoder_string"},
+    {&decoder_array_of_strings, "decoder_array_of_strings"},
+    {&decoder_array_of_u64, "decoder_array_of_u64"},
+    {&decoder_boolean, "decoder_boolean"},
+    {&decoder_date_time, "decoder_date_time"},
+    {&decoder_public_key, "decoder_public_key"},
+    {&decoder_asset, "decoder_asset"},
+    {&decoder_weight, "decoder_weight"},
+    {&decoder_uint32, "decoder_uint32"},
+    {&decoder_uint64, "decoder_uint64"},
+    {&decoder_uint16, "decoder_uint16"},
+    {&decoder_uint8, "decoder_uint8"},
+    {&decoder_authority_type, "decoder_authority_type"},
+    {&decoder_optional_authority_type, "decoder_optional_authority_type"},
+    {&decoder_empty_extensions, "decoder_empty_extensions"},
+    {&decoder_beneficiaries_extensions, "decoder_beneficiaries_extensions"},
+};
+
+static double now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+/**
+ * Fill unused stack below the caller with a pattern, measured function overwrites it down to its deepest frame
+ */
+static __attribute__((noinline)) void stack_paint(void) {
+    volatile uint8_t area[STACK_PAINT_LEN];
+
+    for (size_t i = 0; i < sizeof(area); i++) {
+        area[i] = STACK_PAINT_BYTE;
+    }
+}
+
+// reading the area left behind by stack_paint() at the same depth is the point of the measure
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+static __attribute__((noinline)) size_t stack_measure(void) {
+    volatile uint8_t area[STACK_PAINT_LEN];
+    size_t untouched = 0;
+
+    while (untouched < sizeof(area) && area[untouched] == STACK_PAINT_BYTE) {
+        untouched++;
+    }
+
+    return sizeof(area) - untouched;
+}
+#pragma GCC diagnostic pop
+
+static bench_result_t *result_add(const char *name) {
+    if (g_results_count == MAX_RESULTS) {
+        fprintf(stderr, "too many benchmarks\n");
+        exit(EXIT_FAILURE);
+    }
+
+    bench_result_t *result = &g_results[g_results_count++];
+    memset(result, 0, sizeof(*result));
+    snprintf(result->name, sizeof(result->name), "%s", name);
+
+    return result;
+}
+
+static bool is_selected(const char *name) {
+    return g_filter == NULL || strstr(name, g_filter) != NULL;
+}
+
+/**
+ * Run function until minimum time elapses, stack usage is measured on a separate run
+ */
+static void bench_run(const char *name, bench_fn_t *fn, const void *arg) {
+    if (!is_selected(name)) {
+        return;
+    }
+
+    bench_result_t *result = result_add(name);
+    uint64_t iterations = 0;
+    uint64_t allocations = g_allocations;
+    double start, elapsed;
+
+    // warm up first, lazy initialization of libc must not count as stack usage
+    fn(arg);
+    stack_paint();
+    fn(arg);
+    result->stack_bytes = stack_measure();
+
+    start = now_ns();
+    do {
+        for (uint32_t i = 0; i < CALIBRATION_ROUND; i++) {
+            fn(arg);
+        }
+        iterations += CALIBRATION_ROUND;
+        elapsed = now_ns() - start;
+    } while (elapsed < g_min_time * 1e9);
+
+    result->iterations = iterations;
+    result->ns_per_op = elapsed / (double) iterations;
+    result->allocations_per_op = (double) (g_allocations - allocations) / (double) (iterations + 2);
+}
+
+/**
+ * Parse transaction the way SIGN_TRANSACTION handler does, from the global raw transaction buffer
+ */
+static parser_status_e parse(const bench_transaction_t *tx) {
+    parser_status_e status = PARSING_OK;
+    buffer_t buf = {.ptr = G_context.tx_info.raw_tx, .size = tx->length, .offset = 0};
+
+    memmove(G_context.tx_info.raw_tx, tx->data, tx->length);
+    cx_sha256_init(&G_context.tx_info.sha);
+
+    BEGIN_TRY {
+        TRY {
+            status = transaction_parse(&buf);
+        }
+        CATCH_OTHER(e) {
+            UNUSED(e);
+            status = FIELD_PARSING_ERROR;
+        }
+        FINALLY {
+        }
+    }
+    END_TRY;
+
+    return status;
+}
+
+static void bench_parse(const void *arg) {
+    parse((const bench_transaction_t *) arg);
+}
+
+/**
+ * Decode every page of every field, fields are decoded from the beginning of the operation like review screens do
+ */
+static void bench_review(const void *arg) {
+    field_t field = {0};
+
+    parse((const bench_transaction_t *) arg);
+
+    for (uint8_t position = 0; position < G_context.tx_info.parser->size; position++) {
+        uint8_t page_count = 1;
+
+        for (uint8_t page = 0; page < page_count; page++) {
+            G_context.tx_info.operation.offset = 0;
+            field_reset(&field, page);
+
+            for (uint8_t i = 0; i <= position; i++) {
+                decoder_t *decoder = (decoder_t *) PIC(G_context.tx_info.parser->decoders[i]);
+                (*decoder)(&G_context.tx_info.operation, &field, false);
+            }
+
+            page_count = field_page_count(&field);
+        }
+    }
+}
+
+static decoder_stats_t *decoder_stats(decoder_t *decoder) {
+    for (size_t i = 0; i < ARRAYLEN(g_decoders); i++) {
+        if (g_decoders[i].decoder == decoder) {
+            return &g_decoders[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Time each decoder over fields of every transaction, results are aggregated per decoder
+ */
+static void bench_decoders(void) {
+    field_t field = {0};
+    const uint32_t rounds = 1000;
+
+    for (size_t t = 0; t < BENCH_TRANSACTIONS_COUNT; t++) {
+        if (parse(&BENCH_TRANSACTIONS[t]) != PARSING_OK) {
+            continue;
+        }
+
+        const parser_t *parser = G_context.tx_info.parser;
+
+        for (uint8_t position = 0; position < parser->size; position++) {
+            decoder_t *decoder = (decoder_t *) PIC(parser->decoders[position]);
+            decoder_stats_t *stats = decoder_stats(decoder);
+            size_t offset = 0;
+
+            if (stats == NULL || !is_selected(stats->name)) {
+                continue;
+            }
+
+            // offset of the field is known only after decoding preceding fields
+            buffer_t operation = G_context.tx_info.operation;
+            operation.offset = 0;
+            for (uint8_t i = 0; i < position; i++) {
+                ((decoder_t *) PIC(parser->decoders[i]))(&operation, &field, false);
+            }
+            offset = operation.offset;
+
+            if (stats->result == NULL) {
+                stats->result = result_add(stats->name);
+                operation.offset = offset;
+                stack_paint();
+                (*decoder)(&operation, &field, false);
+                stats->result->stack_bytes = stack_measure();
+            }
+
+            uint64_t allocations = g_allocations;
+            double start = now_ns();
+            for (uint32_t i = 0; i < rounds; i++) {
+                operation.offset = offset;
+                (*decoder)(&operation, &field, false);
+            }
+            stats->total_ns += now_ns() - start;
+            stats->result->iterations += rounds;
+            stats->result->allocations_per_op += (double) (g_allocations - allocations);
+        }
+    }
+
+    for (size_t i = 0; i < ARRAYLEN(g_decoders); i++) {
+        bench_result_t *result = g_decoders[i].result;
+        if (result != NULL) {
+            result->ns_per_op = g_decoders[i].total_ns / (double) result->iterations;
+            result->allocations_per_op /= (double) result->iterations;
+        }
+    }
+}
+
+static void bench_format_asset(const void *arg) {
+    asset_t asset = {.amount = 1234567890, .precision = 3, .symbol = "STEEM"};
+    char out[MAX_HIVE_ASSET_LEN] = {0};
+
+    (void) arg;
+    format_asset(&asset, out, sizeof(out));
+}
+
+static void bench_format_timestamp(const void *arg) {
+    char out[DATE_TIME_STR_LEN] = {0};
+
+    (void) arg;
+    format_timestamp(1589141622, out, sizeof(out));
+}
+
+static const uint8_t PUBLIC_KEY[PUBKEY_COMPRESSED_LEN] = {
+    0x02, 0x72, 0xda, 0x61, 0x6d, 0x74, 0xac, 0xf1, 0xd1, 0x48, 0x2c, 0x2e, 0xfd, 0x4f, 0xdf, 0xe3, 0x49,
+    0xba, 0x35, 0x3b, 0x44, 0x9a, 0xb7, 0x67, 0xd9, 0x66, 0xd0, 0x05, 0x99, 0x74, 0x7a, 0x11, 0x9d};
+
+static void bench_base58_encode(const void *arg) {
+    char out[PUBKEY_WIF_STR_LEN] = {0};
+
+    (void) arg;
+    base58_encode(PUBLIC_KEY, sizeof(PUBLIC_KEY), out, sizeof(out));
+}
+
+static void bench_wif_from_compressed_public_key(const void *arg) {
+    uint8_t key[PUBKEY_COMPRESSED_LEN];
+    char out[PUBKEY_WIF_STR_LEN + 1] = {0};
+
+    (void) arg;
+    memcpy(key, PUBLIC_KEY, sizeof(key));
+    wif_from_compressed_public_key(key, sizeof(key), out, PUBKEY_WIF_STR_LEN);
+}
+
+static void print_text(void) {
+    printf("%-48s %12s %12s %10s %10s\n", "benchmark", "ns/op", "ops/s", "stack [B]", "allocs/op");
+    for (size_t i = 0; i < g_results_count; i++) {
+        const bench_result_t *r = &g_results[i];
+        printf("%-48s %12.1f %12.0f %10zu %10.2f\n", r->name, r->ns_per_op, 1e9 / r->ns_per_op, r->stack_bytes, r->allocations_per_op);
+    }
+}
+
+static void print_json(void) {
+    printf("{\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < g_results_count; i++) {
+        const bench_result_t *r = &g_results[i];
+        printf("    {\"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.1f, \"ops_per_s\": %.0f, \"stack_bytes\": %zu, "
+               "\"allocations_per_op\": %.2f}%s\n",
+               r->name, (unsigned long long) r->iterations, r->ns_per_op, 1e9 / r->ns_per_op, r->stack_bytes, r->allocations_per_op,
+               i + 1 < g_results_count ? "," : "");
+    }
+    printf("  ]\n}\n");
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "Usage: %s [--json] [--filter SUBSTRING] [--min-time SECONDS]\n", name);
+}
+
+int main(int argc, char *argv[]) {
+    char name[MAX_RESULT_NAME];
+    bool json = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            g_filter = argv[++i];
+        } else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            g_min_time = atof(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (size_t i = 0; i < BENCH_TRANSACTIONS_COUNT; i++) {
+        if (parse(&BENCH_TRANSACTIONS[i]) != PARSING_OK) {
+            fprintf(stderr, "%s: transaction cannot be parsed\n", BENCH_TRANSACTIONS[i].name);
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (size_t i = 0; i < BENCH_TRANSACTIONS_COUNT; i++) {
+        snprintf(name, sizeof(name), "transaction_parse/%s", BENCH_TRANSACTIONS[i].name);
+        bench_run(name, bench_parse, &BENCH_TRANSACTIONS[i]);
+    }
+
+    for (size_t i = 0; i < BENCH_TRANSACTIONS_COUNT; i++) {
+        snprintf(name, sizeof(name), "review/%s", BENCH_TRANSACTIONS[i].name);
+        bench_run(name, bench_review, &BENCH_TRANSACTIONS[i]);
+    }
+
+    bench_decoders();
+
+    bench_run("format_asset", bench_format_asset, NULL);
+    bench_run("format_timestamp", bench_format_timestamp, NULL);
+    bench_run("base58_encode", bench_base58_encode, NULL);
+    bench_run("wif_from_compressed_public_key", bench_wif_from_compressed_public_key, NULL);
+
+    if (json) {
+        print_json();
+    } else {
+        print_text();
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * SIGN_TRANSACTION payload of a functional test transaction, generated by transactions.py
+ */
+typedef struct {
+    const char *name;     /// transaction file name without extension
+    const uint8_t *data;  /// BIP32 path followed by TLV encoded transaction
+    size_t length;        /// length of data
+} bench_transaction_t;
+
+extern const bench_transaction_t BENCH_TRANSACTIONS[];
+extern const size_t BENCH_TRANSACTIONS_COUNT;
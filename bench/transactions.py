@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+"""
+Serialize functional test transactions (test/transactions/*.json) into the SIGN_TRANSACTION payload the application
+receives (BIP32 path followed by TLV encoded transaction fields) and emit them as a C source for the benchmarks.
+
+Usage: transactions.py OUTPUT.c TRANSACTION.json...
+"""
+
+import calendar
+import hashlib
+import json
+import os
+import struct
+import sys
+import time
+
+CHAIN_ID = bytes.fromhex("beeab0de" + "00" * 28)
+PATH = [0x80000030, 0x8000000D, 0x80000000, 0x80000000, 0x80000000]  # 48'/13'/0'/0'/0'
+
+ASSETS = {"HIVE": (3, b"STEEM"), "HBD": (3, b"SBD"), "VESTS": (6, b"VESTS")}
+BASE58 = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz"
+
+# Operation id and serialized fields (name, type) in protocol order
+OPERATIONS = {
+    "vote": (0, [("voter", "string"), ("author", "string"), ("permlink", "string"), ("weight", "i16")]),
+    "comment": (1, [("parent_author", "string"), ("parent_permlink", "string"), ("author", "string"), ("permlink", "string"),
+                    ("title", "string"), ("body", "string"), ("json_metadata", "string")]),
+    "transfer": (2, [("from", "string"), ("to", "string"), ("amount", "asset"), ("memo", "string")]),
+    "transfer_to_vesting": (3, [("from", "string"), ("to", "string"), ("amount", "asset")]),
+    "withdraw_vesting": (4, [("account", "string"), ("vesting_shares", "asset")]),
+    "limit_order_create": (5, [("owner", "string"), ("orderid", "u32"), ("amount_to_sell", "asset"), ("min_to_receive", "asset"),
+                               ("fill_or_kill", "bool"), ("expiration", "time")]),
+    "limit_order_cancel": (6, [("owner", "string"), ("orderid", "u32")]),
+    "feed_publish": (7, [("publisher", "string"), ("exchange_rate", "price")]),
+    "convert": (8, [("owner", "string"), ("requestid", "u32"), ("amount", "asset")]),
+    "account_create": (9, [("fee", "asset"), ("creator", "string"), ("new_account_name", "string"), ("owner", "authority"),
+                           ("active", "authority"), ("posting", "authority"), ("memo_key", "public_key"), ("json_metadata", "string")]),
+    "account_update": (10, [("account", "string"), ("owner", "optional_authority"), ("active", "optional_authority"),
+                            ("posting", "optional_authority"), ("memo_key", "public_key"), ("json_metadata", "string")]),
+    "witness_update": (11, [("owner", "string"), ("url", "string"), ("block_signing_key", "public_key"), ("props", "chain_properties"),
+                            ("fee", "asset")]),
+    "account_witness_vote": (12, [("account", "string"), ("witness", "string"), ("approve", "bool")]),
+    "account_witness_proxy": (13, [("account", "string"), ("proxy", "string")]),
+    "delete_comment": (17, [("author", "string"), ("permlink", "string")]),
+    "custom_json": (18, [("required_auths", "strings"), ("required_posting_auths", "strings"), ("id", "string"), ("json", "string")]),
+    "comment_options": (19, [("author", "string"), ("permlink", "string"), ("max_accepted_payout", "asset"), ("percent_hbd", "u16"),
+                             ("allow_votes", "bool"), ("allow_curation_rewards", "bool"), ("extensions", "extensions")]),
+    "set_withdraw_vesting_route": (20, [("from_account", "string"), ("to_account", "string"), ("percent", "u16"), ("auto_vest", "bool")]),
+    "claim_account": (22, [("creator", "string"), ("fee", "asset"), ("extensions", "extensions")]),
+    "create_claimed_account": (23, [("creator", "string"), ("new_account_name", "string"), ("owner", "authority"), ("active", "authority"),
+                                    ("posting", "authority"), ("memo_key", "public_key"), ("json_metadata", "string"),
+                                    ("extensions", "extensions")]),
+    "request_account_recovery": (24, [("recovery_account", "string"), ("account_to_recover", "string"),
+                                      ("new_owner_authority", "authority"), ("extensions", "extensions")]),
+    "recover_account": (25, [("account_to_recover", "string"), ("new_owner_authority", "authority"),
+                             ("recent_owner_authority", "authority"), ("extensions", "extensions")]),
+    "change_recovery_account": (26, [("account_to_recover", "string"), ("new_recovery_account", "string"), ("extensions", "extensions")]),
+    "transfer_to_savings": (32, [("from", "string"), ("to", "string"), ("amount", "asset"), ("memo", "string")]),
+    "transfer_from_savings": (33, [("from", "string"), ("request_id", "u32"), ("to", "string"), ("amount", "asset"), ("memo", "string")]),
+    "cancel_transfer_from_savings": (34, [("from", "string"), ("request_id", "u32")]),
+    "decline_voting_rights": (36, [("account", "string"), ("decline", "bool")]),
+    "reset_account": (37, [("reset_account", "string"), ("account_to_reset", "string"), ("new_owner_authority", "authority")]),
+    "set_reset_account": (38, [("account", "string"), ("current_reset_account", "string"), ("reset_account", "string")]),
+    "claim_reward_balance": (39, [("account", "string"), ("reward_hive", "asset"), ("reward_hbd", "asset"), ("reward_vests", "asset")]),
+    "delegate_vesting_shares": (40, [("delegator", "string"), ("delegatee", "string"), ("vesting_shares", "asset")]),
+    "witness_set_properties": (42, [("owner", "string"), ("props", "witness_properties"), ("extensions", "extensions")]),
+    "create_proposal": (44, [("creator", "string"), ("receiver", "string"), ("start_date", "time"), ("end_date", "time"),
+                             ("daily_pay", "asset"), ("subject", "string"), ("permlink", "string"), ("extensions", "extensions")]),
+    "update_proposal_votes": (45, [("voter", "string"), ("proposal_ids", "i64s"), ("approve", "bool"), ("extensions", "extensions")]),
+    "remove_proposal": (46, [("proposal_owner", "string"), ("proposal_ids", "i64s"), ("extensions", "extensions")]),
+    "update_proposal": (47, [("proposal_id", "i64"), ("creator", "string"), ("daily_pay", "asset"), ("subject", "string"),
+                             ("permlink", "string"), ("extensions", "extensions")]),
+    "collateralized_convert": (48, [("owner", "string"), ("requestid", "u32"), ("amount", "asset")]),
+    "recurrent_transfer": (49, [("from", "string"), ("to", "string"), ("amount", "asset"), ("memo", "string"), ("recurrence", "u16"),
+                                ("executions", "u16"), ("extensions", "extensions")]),
+}
+
+
+def varint(value):
+    out = b""
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out += bytes([byte | 0x80])
+        else:
+            return out + bytes([byte])
+
+
+def string(value):
+    data = value.encode("utf-8")
+    return varint(len(data)) + data
+
+
+def timestamp(value):
+    return struct.pack("<I", calendar.timegm(time.strptime(value, "%Y-%m-%dT%H:%M:%S")))
+
+
+def asset(value):
+    amount, symbol = value.split(" ")
+    precision, legacy_symbol = ASSETS[symbol]
+    whole, _, fraction = amount.partition(".")
+    units = int(whole) * 10**precision + int(fraction.ljust(precision, "0") or "0")
+    return struct.pack("<qB", units, precision) + legacy_symbol.ljust(7, b"\0")
+
+
+def public_key(value):
+    number = 0
+    for char in value[3:]:
+        number = number * 58 + BASE58.index(char)
+    # checksum is not verified, the application does not verify it either
+    return number.to_bytes(37, "big")[:33]
+
+
+def authority(value):
+    out = struct.pack("<I", value["weight_threshold"]) + varint(len(value["account_auths"]))
+    out += b"".join(string(account) + struct.pack("<H", weight) for account, weight in value["account_auths"])
+    out += varint(len(value["key_auths"]))
+    out += b"".join(public_key(key) + struct.pack("<H", weight) for key, weight in value["key_auths"])
+    return out
+
+
+def extension(value):
+    kind, content = value
+    if kind == 0:  # comment_payout_beneficiaries
+        beneficiaries = content["beneficiaries"]
+        data = varint(len(beneficiaries)) + b"".join(string(b["account"]) + struct.pack("<H", b["weight"]) for b in beneficiaries)
+    elif kind == 1:  # update_proposal_end_date
+        data = timestamp(content["end_date"])
+    else:
+        raise ValueError("unsupported extension %d" % kind)
+    return varint(kind) + data
+
+
+SERIALIZERS = {
+    "string": string,
+    "strings": lambda value: varint(len(value)) + b"".join(string(item) for item in value),
+    "bool": lambda value: bytes([1 if value else 0]),
+    "u16": lambda value: struct.pack("<H", int(value)),
+    "i16": lambda value: struct.pack("<h", int(value)),
+    "u32": lambda value: struct.pack("<I", int(value)),
+    "i64": lambda value: struct.pack("<q", int(value)),
+    "i64s": lambda value: varint(len(value)) + b"".join(struct.pack("<q", item) for item in value),
+    "time": timestamp,
+    "asset": asset,
+    "price": lambda value: asset(value["base"]) + asset(value["quote"]),
+    "public_key": public_key,
+    "authority": authority,
+    "optional_authority": lambda value: b"\x00" if value is None else b"\x01" + authority(value),
+    "chain_properties": lambda value: asset(value["account_creation_fee"]) + struct.pack("<IH", value["maximum_block_size"],
+                                                                                         value["hbd_interest_rate"]),
+    "extensions": lambda value: varint(len(value)) + b"".join(extension(item) for item in value),
+    # sorted [key, hex encoded serialized value] pairs
+    "witness_properties": lambda value: varint(len(value)) + b"".join(string(key) + varint(len(bytes.fromhex(data))) + bytes.fromhex(data)
+                                                                      for key, data in value),
+}
+
+DEFAULTS = {"extensions": [], "optional_authority": None, "bool": False}
+
+
+def tlv(value):
+    if len(value) < 0x80:
+        length = bytes([len(value)])
+    elif len(value) < 0x100:
+        length = bytes([0x81, len(value)])
+    else:
+        length = bytes([0x82]) + struct.pack(">H", len(value))
+    return bytes([0x04]) + length + value
+
+
+def operation(name, fields):
+    operation_id, layout = OPERATIONS[name]
+    out = varint(operation_id)
+    for field, kind in layout:
+        value = fields[field] if field in fields else DEFAULTS[kind]
+        out += SERIALIZERS[kind](value)
+    return out
+
+
+def transaction(tx):
+    """Return SIGN_TRANSACTION payload and the serialized transaction which is signed (without chain id)"""
+    if len(tx["operations"]) != 1:
+        raise ValueError("only single operation transactions are supported")
+
+    header = [struct.pack("<H", tx["ref_block_num"] & 0xFFFF), struct.pack("<I", tx["ref_block_prefix"]), timestamp(tx["expiration"])]
+    op = operation(*tx["operations"][0])
+
+    payload = bytes([len(PATH)]) + b"".join(struct.pack(">I", index) for index in PATH)
+    payload += tlv(CHAIN_ID) + b"".join(tlv(field) for field in header) + tlv(varint(1)) + tlv(op) + tlv(varint(0))
+
+    return payload, b"".join(header) + varint(1) + op + varint(0)
+
+
+def main():
+    output, sources = sys.argv[1], sorted(sys.argv[2:])
+    lines = ["/* Generated by bench/transactions.py, do not edit */", "", '#include "bench.h"', ""]
+    entries = []
+
+    for source in sources:
+        with open(source) as f:
+            payload, _ = transaction(json.load(f))
+        name = os.path.splitext(os.path.basename(source))[0]
+        data = ", ".join("0x%02x" % byte for byte in payload)
+        lines.append("static const uint8_t %s[] = {%s};" % (name, data))
+        entries.append('    {"%s", %s, sizeof(%s)},' % (name, name, name))
+
+    lines += ["", "const bench_transaction_t BENCH_TRANSACTIONS[] = {"] + entries + ["};", ""]
+    lines.append("const size_t BENCH_TRANSACTIONS_COUNT = sizeof(BENCH_TRANSACTIONS) / sizeof(BENCH_TRANSACTIONS[0]);")
+
+    with open(output, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -3,6 +3,7 @@ set -e
 
 SCRIPTDIR="$(cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd)"
 BUILDDIR="$SCRIPTDIR/cmake-build-fuzz"
+APDU_BUILDDIR="$SCRIPTDIR/cmake-build-fuzz-apdu"
 
 # Compile fuzzer
 rm -rf "$BUILDDIR"
@@ -12,3 +13,8 @@ cd "$BUILDDIR"
 cmake -DCMAKE_C_COMPILER=clang ..
 make clean
 make fuzz_hive
+
+# Compile APDU dispatcher fuzzer, built with the host shims of native/
+rm -rf "$APDU_BUILDDIR"
+cmake -DCMAKE_C_COMPILER=clang -DFUZZ=ON -S "$SCRIPTDIR/../native" -B "$APDU_BUILDDIR"
+cmake --build "$APDU_BUILDDIR" --target fuzz_apdu
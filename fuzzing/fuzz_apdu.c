@@ -0,0 +1,134 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "os.h"
+
+#include "constants.h"
+#include "globals.h"
+#include "offsets.h"
+#include "types.h"
+#include "apdu/dispatcher.h"
+#include "common/macros.h"
+
+#include "native.h"
+#include "generator.h"
+
+/* Commands of a single input, every command is a separate exchange as with a real host */
+#define MAX_COMMANDS 16
+
+#define MAX_CHUNK_LEN (MAX_APDU_LEN - OFFSET_CDATA)
+
+static const uint8_t INSTRUCTIONS[] = {GET_PUBLIC_KEY,
+                                       SIGN_TRANSACTION,
+                                       GET_VERSION,
+                                       GET_APP_NAME,
+                                       SIGN_HASH,
+                                       GET_SETTINGS,
+                                       SET_SESSION_POLICY,
+                                       SIGN_MESSAGE,
+                                       GET_ECDH_SECRETS,
+                                       DECRYPT_MEMO,
+                                       GET_PERF_STATS,
+                                       GET_LAST_SIGNATURE,
+                                       PREVIEW_TRANSACTION,
+                                       CREATE_ACCOUNT,
+                                       SET_KEY_INDEX,
+                                       GET_RESPONSE};
+
+static void exchange(uint8_t *apdu, size_t apdu_len) {
+    uint8_t response[NATIVE_MAX_RESPONSE_LEN];
+
+    size_t response_len = native_exchange(apdu, apdu_len, response);
+    if (response_len < 2 || response_len > sizeof(response)) {
+        fprintf(stderr, "invalid response length %zu to INS %02x\n", response_len, apdu[OFFSET_INS]);
+        abort();
+    }
+}
+
+/**
+ * Generated transaction sent in chunks as SIGN_TRANSACTION
+ */
+static void send_transaction(fuzz_input_t *input) {
+    uint8_t payload[MAX_TRANSACTION_LEN];
+    uint8_t apdu[MAX_APDU_LEN];
+
+    size_t length = generate_transaction(input, payload, sizeof(payload));
+    for (size_t offset = 0; offset < length; offset += MAX_CHUNK_LEN) {
+        size_t chunk = length - offset < MAX_CHUNK_LEN ? length - offset : MAX_CHUNK_LEN;
+
+        apdu[OFFSET_CLA] = CLA;
+        apdu[OFFSET_INS] = SIGN_TRANSACTION;
+        apdu[OFFSET_P1] = offset == 0 ? P1_FIRST_CHUNK : P1_SUBSEQUENT_CHUNK;
+        apdu[OFFSET_P2] = offset + chunk < length ? P2_MORE : P2_LAST;
+        apdu[OFFSET_LC] = (uint8_t) chunk;
+        memcpy(apdu + OFFSET_CDATA, payload + offset, chunk);
+        exchange(apdu, OFFSET_CDATA + chunk);
+    }
+}
+
+/**
+ * Command of a known instruction with arbitrary parameters and data, or a completely arbitrary one
+ */
+static void send_command(fuzz_input_t *input, uint8_t selector) {
+    uint8_t apdu[MAX_APDU_LEN + 1];
+    size_t length = fuzz_u8(input);
+
+    apdu[OFFSET_CLA] = CLA;
+    apdu[OFFSET_INS] = INSTRUCTIONS[fuzz_u8(input) % ARRAYLEN(INSTRUCTIONS)];
+    apdu[OFFSET_P1] = fuzz_u8(input);
+    apdu[OFFSET_P2] = fuzz_u8(input);
+    apdu[OFFSET_LC] = (uint8_t) (length < MAX_CHUNK_LEN ? length : MAX_CHUNK_LEN);
+    for (size_t i = OFFSET_CDATA; i < OFFSET_CDATA + apdu[OFFSET_LC]; i++) {
+        apdu[i] = fuzz_u8(input);
+    }
+    length = OFFSET_CDATA + apdu[OFFSET_LC];
+
+    if ((selector & 0xF0) == 0) {
+        // wrong class, instruction or length
+        apdu[OFFSET_CLA] ^= fuzz_u8(input);
+        apdu[OFFSET_INS] ^= fuzz_u8(input);
+        length = fuzz_u8(input);
+    }
+
+    exchange(apdu, length);
+}
+
+int LLVMFuzzerInitialize(int *argc, char ***argv) {
+    UNUSED(argc);
+    UNUSED(argv);
+
+    if (!native_seed_init(NATIVE_DEFAULT_MNEMONIC)) {
+        abort();
+    }
+    return 0;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
+    fuzz_input_t input = {.data = Data, .size = Size, .offset = 0};
+    uint8_t policies = fuzz_u8(&input);
+    settings_t settings = {.initialized = 0x01,
+                           .sign_hash_policy = (policies & 0x01) ? ENABLED : DISABLED,
+                           .session_signing_policy = (policies & 0x02) ? SESSION_SIGNING_ENABLED : SESSION_SIGNING_DISABLED,
+                           .summary_review_policy = (policies & 0x04) ? SUMMARY_REVIEW_ENABLED : SUMMARY_REVIEW_DISABLED};
+
+    nvm_write((void *) &N_settings, (void *) &settings, sizeof(settings_t));
+    explicit_bzero(&G_context, sizeof(G_context));
+    explicit_bzero(G_operation_templates, sizeof(G_operation_templates));
+    explicit_bzero(&G_session_policy, sizeof(G_session_policy));
+    G_native_approve = (policies & 0x08) == 0;
+
+    for (uint8_t i = 0; i < MAX_COMMANDS && input.offset < input.size; i++) {
+        uint8_t selector = fuzz_u8(&input);
+
+        if ((selector & 0x03) == 0) {
+            send_transaction(&input);
+        } else {
+            send_command(&input, selector);
+        }
+    }
+
+    return 0;
+}
@@ -1,50 +1,136 @@
-#include "transaction/transaction_parse.h"
-
 #include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "globals.h"
-/*
-#include "apdu/parser.h"
-#include "apdu/dispatcher.h"
-#include "cx.h"
-*/
+#include "common/macros.h"
+#include "transaction/field.h"
+#include "transaction/field_pager.h"
+#include "transaction/template_diff.h"
+#include "transaction/transaction_parse.h"
 
-int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
-    if (Size < 5) {
-        //mimic buf_len < OFFSET_CDATA in apdu_parser()
-        return 1;
+#include "generator.h"
+
+/* Review screens browsed at most per transaction, both directions */
+#define MAX_REVIEW_STEPS 64
+
+/* Checked in release builds as well, unlike assert() */
+#define FUZZ_CHECK(condition)                                                             \
+    do {                                                                                  \
+        if (!(condition)) {                                                               \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            abort();                                                                      \
+        }                                                                                 \
+    } while (0)
+
+/**
+ * Display pass decodes each field from the start of the operation, as the review screens do, and has to consume
+ * exactly the bytes consumed by the hash pass of transaction_parse(): otherwise the user reviews other data than
+ * is signed.
+ */
+static void check_display_pass(void) {
+    const parser_t *parser = G_context.tx_info.parser;
+    buffer_t *operation = &G_context.tx_info.operation;
+    size_t hash_offsets[ARRAYLEN(parser->decoders)];
+    field_t field;
+
+    operation->offset = 0;
+    for (uint8_t i = 0; i < parser->size; i++) {
+        decoder_t *decoder = (decoder_t *) PIC(parser->decoders[i]);
+        FUZZ_CHECK((*decoder)(operation, NULL, true));
+        hash_offsets[i] = operation->offset;
     }
-    BEGIN_TRY {
-        TRY {
-            uint8_t lc;
 
-            lc = Data[0];
+    for (uint8_t position = 0; position < parser->size; position++) {
+        uint8_t page_count = 1;
+        for (uint8_t page = 0; page < page_count; page++) {
+            operation->offset = 0;
+            field_reset(&field, page);
+            for (uint8_t i = 0; i <= position; i++) {
+                decoder_t *decoder = (decoder_t *) PIC(parser->decoders[i]);
+                (*decoder)(operation, &field, false);
+                FUZZ_CHECK(operation->offset == hash_offsets[i]);
+            }
+            page_count = field_page_count(&field);
+        }
+    }
 
-            explicit_bzero(&G_context, sizeof(G_context));
-            G_context.req_type = CONFIRM_TRANSACTION;
-            G_context.state = STATE_NONE;
+    operation->offset = 0;
+}
+
+/**
+ * Browse review screens as display_next_state() does, input decides direction of every step
+ */
+static void browse_review(fuzz_input_t *input) {
+    field_t field = {0};
+    bool dynamic = false;
 
-            G_context.tx_info.raw_tx_len = Size - 1 > MAX_TRANSACTION_LEN ? MAX_TRANSACTION_LEN : Size - 1;
-            memcpy(G_context.tx_info.raw_tx, Data + 1, G_context.tx_info.raw_tx_len);
-            buffer_t tx_buffer = {.offset = 0, .ptr = &G_context.tx_info.raw_tx, .size = lc};
+    field_pager_reset();
+    for (uint8_t step = 0; step < MAX_REVIEW_STEPS; step++) {
+        bool backward = fuzz_u8(input) & 0x01;
 
-            transaction_parse(&tx_buffer);
+        if (!dynamic) {
+            if (!backward) {
+                field_pager_reset();
+            }
+            dynamic = parse_field(&field, backward, backward);
+        } else {
+            dynamic = parse_field(&field, backward, false);
+        }
+        FUZZ_CHECK(strnlen(field.title, sizeof(field.title)) < sizeof(field.title));
+    }
+}
 
-            lc = Data[0];
+static void fuzz_transaction(fuzz_input_t *input) {
+    explicit_bzero(&G_context, sizeof(G_context));
+    G_context.req_type = CONFIRM_TRANSACTION;
+    G_context.state = STATE_NONE;
+
+    size_t length = generate_transaction(input, G_context.tx_info.raw_tx, sizeof(G_context.tx_info.raw_tx));
+    if (length == 0) {
+        return;
+    }
+    G_context.tx_info.raw_tx_len = length;
+    cx_sha256_init(&G_context.tx_info.sha);
 
+    buffer_t tx_buffer = {.offset = 0, .ptr = G_context.tx_info.raw_tx, .size = length};
+    if (transaction_parse(&tx_buffer) != PARSING_OK) {
+        return;
+    }
+    G_context.state = STATE_PARSED;
+
+    check_display_pass();
+
+    template_diff_compute();
+    browse_review(input);
+
+    // following transaction of the same type is reviewed as changes of this one
+    template_diff_store();
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
+    fuzz_input_t input = {.data = Data, .size = Size, .offset = 0};
+
+    explicit_bzero(G_operation_templates, sizeof(G_operation_templates));
+
+    BEGIN_TRY {
+        TRY {
+            uint8_t transactions = 1 + (fuzz_u8(&input) & 0x01);
+            for (uint8_t i = 0; i < transactions; i++) {
+                fuzz_transaction(&input);
+            }
+
+            // remaining input is used as a SIGN_HASH payload
             explicit_bzero(&G_context, sizeof(G_context));
             G_context.req_type = CONFIRM_HASH;
             G_context.state = STATE_NONE;
 
-            G_context.tx_info.raw_tx_len = Size - 1 > MAX_TRANSACTION_LEN ? MAX_TRANSACTION_LEN : Size - 1;
-            memcpy(G_context.tx_info.raw_tx, Data + 1, G_context.tx_info.raw_tx_len);
-            buffer_t hash_buffer = {.offset = 0, .ptr = &G_context.tx_info.raw_tx, .size = lc};
-
+            buffer_t hash_buffer = {.offset = input.offset, .ptr = Data, .size = Size};
             hash_parse(&hash_buffer);
         }
         CATCH_OTHER(e) {
-            return 0;
         }
         FINALLY {
         }
@@ -53,19 +139,3 @@ int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
 
     return 0;
 }
-
-/*
-int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
-    command_t cmd;
-    memset(&cmd, 0, sizeof(cmd));
-    if (!apdu_parser(&cmd, Data, Size)) {
-        return 0;
-    }
-
-    // Dispatch structured APDU command to handler
-    if (apdu_dispatcher(&cmd) < 0) {
-        return 0;
-    }
-    return 0;
-}
-*/
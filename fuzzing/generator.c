@@ -0,0 +1,476 @@
+#include "generator.h"
+
+#include <string.h>
+
+#include "constants.h"
+#include "types.h"
+#include "common/format.h"
+#include "common/json.h"
+#include "common/macros.h"
+#include "transaction/decoders.h"
+#include "transaction/names.h"
+#include "transaction/parsers.h"
+
+#define OPERATION_NUMBER(number, name) number,
+
+static const uint8_t OPERATIONS[] = {OPERATION_NAMES(OPERATION_NUMBER)};
+
+/* Legacy asset symbols accepted by format_asset, with their precision */
+static const struct {
+    uint8_t precision;
+    char symbol[7];
+} ASSETS[] = {{3, "STEEM"}, {3, "SBD"}, {6, "VESTS"}};
+
+/* 48'/13'/0'/0'/0' */
+static const uint32_t BIP32_PATH[] = {0x80000030, 0x8000000D, 0x80000000, 0x80000000, 0x80000000};
+
+#define CHAIN_ID_LEN 32
+#define MAX_ARRAY_LEN 8
+#define MAX_RAW_FIELD_LEN 32
+
+/* Limits of read_string() in decoders.c, lengths equal to the limit are rejected */
+#define STRING_LIMIT 256
+#define ARRAY_STRING_LIMIT 50
+#define ACCOUNT_NAME_LIMIT 64
+#define BENEFICIARY_NAME_LIMIT 65
+
+/* Payloads nested one level deeper than the tokenizer accepts */
+#define MAX_JSON_GENERATOR_DEPTH (JSON_MAX_DEPTH + 1)
+#define MAX_JSON_MEMBERS 4
+
+/* Ids with a custom_json renderer, and members and values they look for */
+static const char *const CUSTOM_JSON_IDS[] = {"follow", "ssc-mainnet-hive", "rc"};
+static const char *const JSON_KEYS[] = {"follower", "following", "what", "account", "author", "permlink", "contractName", "contractAction",
+                                        "contractPayload", "symbol", "to", "quantity", "price", "memo", "from", "delegatees", "max_rc", "0"};
+static const char *const JSON_STRINGS[] = {"follow", "reblog", "blog", "ignore", "delegate_rc", "tokens", "transfer", "BEE", "engrave", "1.000"};
+static const char *const JSON_PRIMITIVES[] = {"0", "-1", "1000000", "1.5e3", "true", "false", "null", "tru", "--1"};
+
+typedef struct {
+    uint8_t *ptr;
+    size_t size;
+    size_t offset;
+    bool overflow;
+} output_t;
+
+typedef void generator_t(fuzz_input_t *, output_t *);
+
+uint8_t fuzz_u8(fuzz_input_t *input) {
+    return input->offset < input->size ? input->data[input->offset++] : 0;
+}
+
+static void put(output_t *out, const void *data, size_t length) {
+    if (out->overflow || out->size - out->offset < length) {
+        out->overflow = true;
+        return;
+    }
+    memcpy(out->ptr + out->offset, data, length);
+    out->offset += length;
+}
+
+static void put_u8(output_t *out, uint8_t value) {
+    put(out, &value, 1);
+}
+
+static void put_input(fuzz_input_t *input, output_t *out, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        put_u8(out, fuzz_u8(input));
+    }
+}
+
+/**
+ * Length or count below limit, boundary values (0, limit - 1 and the rejected limit) are favoured
+ */
+static size_t fuzz_length(fuzz_input_t *input, size_t limit) {
+    uint8_t selector = fuzz_u8(input);
+
+    switch (selector & 0x0F) {
+        case 0:
+            return 0;
+        case 1:
+            return limit - 1;
+        case 2:
+            return limit;
+        default:
+            return fuzz_u8(input) % limit;
+    }
+}
+
+/**
+ * Prefix written for given length, wrong by a few bytes once in 16 times
+ */
+static size_t fuzz_prefix(fuzz_input_t *input, size_t length) {
+    uint8_t selector = fuzz_u8(input);
+
+    if ((selector & 0x0F) == 0) {
+        return length + (int8_t) (selector >> 4) - 8;
+    }
+    return length;
+}
+
+/**
+ * Unsigned LEB128 length prefix of strings
+ */
+static void put_varint(output_t *out, uint32_t value) {
+    do {
+        uint8_t byte = value & 0x7F;
+
+        value >>= 7;
+        put_u8(out, value != 0 ? (byte | 0x80) : byte);
+    } while (value != 0);
+}
+
+static void put_string(output_t *out, const char *str) {
+    put(out, str, strlen(str));
+}
+
+static void generate_string_limited(fuzz_input_t *input, output_t *out, size_t limit) {
+    size_t length = fuzz_length(input, limit);
+
+    put_varint(out, (uint32_t) fuzz_prefix(input, length));
+    for (size_t i = 0; i < length; i++) {
+        // mostly printable characters, as account names and permlinks are
+        uint8_t c = fuzz_u8(input);
+        put_u8(out, (c & 0x80) ? c : (uint8_t) (' ' + c % 95));
+    }
+}
+
+static void generate_string(fuzz_input_t *input, output_t *out) {
+    generate_string_limited(input, out, STRING_LIMIT);
+}
+
+static void generate_array_of_strings(fuzz_input_t *input, output_t *out) {
+    size_t count = fuzz_length(input, MAX_ARRAY_LEN);
+
+    put_u8(out, (uint8_t) fuzz_prefix(input, count));
+    for (size_t i = 0; i < count; i++) {
+        generate_string_limited(input, out, ARRAY_STRING_LIMIT);
+    }
+}
+
+static void generate_array_of_u64(fuzz_input_t *input, output_t *out) {
+    size_t count = fuzz_length(input, MAX_ARRAY_LEN);
+
+    put_u8(out, (uint8_t) fuzz_prefix(input, count));
+    put_input(input, out, count * sizeof(uint64_t));
+}
+
+static void generate_u8(fuzz_input_t *input, output_t *out) {
+    put_input(input, out, sizeof(uint8_t));
+}
+
+static void generate_u16(fuzz_input_t *input, output_t *out) {
+    put_input(input, out, sizeof(uint16_t));
+}
+
+static void generate_u32(fuzz_input_t *input, output_t *out) {
+    put_input(input, out, sizeof(uint32_t));
+}
+
+static void generate_u64(fuzz_input_t *input, output_t *out) {
+    put_input(input, out, sizeof(uint64_t));
+}
+
+static void generate_boolean(fuzz_input_t *input, output_t *out) {
+    uint8_t value = fuzz_u8(input);
+
+    put_u8(out, (value & 0xF0) ? (value & 0x01) : value);
+}
+
+static void generate_public_key(fuzz_input_t *input, output_t *out) {
+    put_u8(out, 0x02 | (fuzz_u8(input) & 0x01));
+    put_input(input, out, PUBKEY_COMPRESSED_LEN - 1);
+}
+
+static void generate_asset(fuzz_input_t *input, output_t *out) {
+    uint8_t selector = fuzz_u8(input);
+
+    put_input(input, out, sizeof(int64_t));
+    if ((selector & 0x0F) == 0) {
+        // unknown symbol or precision
+        put_input(input, out, 1 + sizeof(symbol_t));
+    } else {
+        uint8_t index = selector % ARRAYLEN(ASSETS);
+        put_u8(out, ASSETS[index].precision);
+        put(out, ASSETS[index].symbol, sizeof(symbol_t));
+    }
+}
+
+static void generate_authority(fuzz_input_t *input, output_t *out) {
+    size_t count;
+
+    // weight threshold
+    put_input(input, out, sizeof(uint32_t));
+
+    count = fuzz_length(input, MAX_ARRAY_LEN);
+    put_u8(out, (uint8_t) fuzz_prefix(input, count));
+    for (size_t i = 0; i < count; i++) {
+        generate_string_limited(input, out, ACCOUNT_NAME_LIMIT);
+        generate_u16(input, out);
+    }
+
+    count = fuzz_length(input, MAX_ARRAY_LEN);
+    put_u8(out, (uint8_t) fuzz_prefix(input, count));
+    for (size_t i = 0; i < count; i++) {
+        generate_public_key(input, out);
+        generate_u16(input, out);
+    }
+}
+
+static void generate_optional_authority(fuzz_input_t *input, output_t *out) {
+    uint8_t present = fuzz_u8(input) & 0x01;
+
+    put_u8(out, present);
+    if (present) {
+        generate_authority(input, out);
+    }
+}
+
+static void generate_empty_extensions(fuzz_input_t *input, output_t *out) {
+    put_u8(out, (uint8_t) fuzz_prefix(input, 0));
+}
+
+static void generate_beneficiaries_extensions(fuzz_input_t *input, output_t *out) {
+    uint8_t selector = fuzz_u8(input);
+
+    if ((selector & 0x01) == 0) {
+        put_u8(out, (uint8_t) fuzz_prefix(input, 0));
+        return;
+    }
+
+    size_t count = fuzz_length(input, MAX_ARRAY_LEN);
+
+    put_u8(out, (uint8_t) fuzz_prefix(input, 1));
+    // extension type, only beneficiaries (0) are supported
+    put_u8(out, (selector & 0xF0) ? 0 : selector);
+    put_u8(out, (uint8_t) fuzz_prefix(input, count));
+    for (size_t i = 0; i < count; i++) {
+        generate_string_limited(input, out, BENEFICIARY_NAME_LIMIT);
+        generate_u16(input, out);
+    }
+}
+
+static void generate_custom_json_id(fuzz_input_t *input, output_t *out) {
+    uint8_t selector = fuzz_u8(input);
+
+    if (selector < 0xC0) {
+        const char *id = CUSTOM_JSON_IDS[selector % ARRAYLEN(CUSTOM_JSON_IDS)];
+        put_varint(out, (uint32_t) strlen(id));
+        put_string(out, id);
+    } else {
+        generate_string(input, out);
+    }
+}
+
+/**
+ * JSON value made of members and values known to custom_json renderers, with an occasional syntax error
+ */
+static void generate_json_value(fuzz_input_t *input, output_t *out, uint8_t depth) {
+    uint8_t selector = fuzz_u8(input);
+    bool object = (selector % 6) == 0;
+
+    if ((selector % 6) <= 1 && depth < MAX_JSON_GENERATOR_DEPTH) {
+        size_t count = fuzz_u8(input) % (MAX_JSON_MEMBERS + 1);
+
+        put_u8(out, object ? '{' : '[');
+        for (size_t i = 0; i < count; i++) {
+            if (i > 0) {
+                put_u8(out, ',');
+            }
+            if (object) {
+                put_u8(out, '"');
+                put_string(out, JSON_KEYS[fuzz_u8(input) % ARRAYLEN(JSON_KEYS)]);
+                put(out, "\":", 2);
+            }
+            generate_json_value(input, out, depth + 1);
+        }
+        put_u8(out, object ? '}' : ']');
+    } else if ((selector % 6) == 2) {
+        put_u8(out, '"');
+        put_string(out, JSON_STRINGS[fuzz_u8(input) % ARRAYLEN(JSON_STRINGS)]);
+        put_u8(out, '"');
+    } else if ((selector % 6) == 3) {
+        put_string(out, JSON_PRIMITIVES[fuzz_u8(input) % ARRAYLEN(JSON_PRIMITIVES)]);
+    } else if ((selector % 6) == 4) {
+        // any character, mostly breaking the syntax
+        put_u8(out, fuzz_u8(input));
+    } else {
+        put_u8(out, '"');
+        put_input(input, out, fuzz_u8(input) % 8);
+        put_u8(out, '"');
+    }
+}
+
+static void generate_custom_json(fuzz_input_t *input, output_t *out) {
+    uint8_t json[MAX_TRANSACTION_LEN];
+    output_t text = {.ptr = json, .size = sizeof(json), .offset = 0, .overflow = false};
+
+    generate_json_value(input, &text, 0);
+
+    put_varint(out, (uint32_t) fuzz_prefix(input, text.offset));
+    put(out, json, text.offset);
+}
+
+/**
+ * Sorted witness properties, mostly known keys with values of their type (see decoders.c), keys out of order now and then
+ */
+static void generate_witness_properties(fuzz_input_t *input, output_t *out) {
+    static const struct {
+        const char *key;
+        generator_t *generator;
+    } properties[] = {
+        {"account_creation_fee", &generate_asset},
+        {"account_subsidy_budget", &generate_u32},
+        {"hbd_exchange_rate", &generate_asset},
+        {"hbd_interest_rate", &generate_u16},
+        {"key", &generate_public_key},
+        {"maximum_block_size", &generate_u32},
+        {"new_property", &generate_string},
+        {"new_signing_key", &generate_public_key},
+        {"url", &generate_string},
+    };
+    uint8_t present = fuzz_u8(input);
+    uint8_t selector = fuzz_u8(input);
+    size_t count = 0;
+
+    for (size_t i = 0; i < ARRAYLEN(properties); i++) {
+        count += (present >> (i % 8)) & 0x01;
+    }
+    put_varint(out, (uint32_t) fuzz_prefix(input, count));
+
+    for (size_t i = 0; i < ARRAYLEN(properties); i++) {
+        // swapping neighbours breaks the order of keys
+        size_t index = ((selector & 0x0F) == 0 && i + 1 < ARRAYLEN(properties)) ? i ^ 1 : i;
+        uint8_t value[STRING_LIMIT + sizeof(uint32_t)];
+        output_t data = {.ptr = value, .size = sizeof(value), .offset = 0, .overflow = false};
+
+        if (((present >> (index % 8)) & 0x01) == 0) {
+            continue;
+        }
+
+        put_varint(out, (uint32_t) strlen(properties[index].key));
+        put_string(out, properties[index].key);
+
+        (*properties[index].generator)(input, &data);
+        if (strcmp(properties[index].key, "hbd_exchange_rate") == 0) {
+            // price is a pair of assets
+            generate_asset(input, &data);
+        }
+        put_varint(out, (uint32_t) fuzz_prefix(input, data.offset));
+        put(out, value, data.offset);
+    }
+}
+
+/**
+ * Field without a generator, i.e. decoder added without updating this table, is filled with raw input
+ */
+static void generate_raw(fuzz_input_t *input, output_t *out) {
+    put_input(input, out, fuzz_u8(input) % (MAX_RAW_FIELD_LEN + 1));
+}
+
+static const struct {
+    decoder_t *decoder;
+    generator_t *generator;
+} GENERATORS[] = {
+    {&decoder_array_of_strings, &generate_array_of_strings},
+    {&decoder_array_of_u64, &generate_array_of_u64},
+    {&decoder_asset, &generate_asset},
+    {&decoder_authority_type, &generate_authority},
+    {&decoder_optional_authority_type, &generate_optional_authority},
+    {&decoder_boolean, &generate_boolean},
+    {&decoder_date_time, &generate_u32},
+    {&decoder_public_key, &generate_public_key},
+    {&decoder_string, &generate_string},
+    {&decoder_custom_json, &generate_custom_json},
+    {&decoder_uint16, &generate_u16},
+    {&decoder_uint32, &generate_u32},
+    {&decoder_uint64, &generate_u64},
+    {&decoder_uint8, &generate_u8},
+    {&decoder_weight, &generate_u16},
+    {&decoder_empty_extensions, &generate_empty_extensions},
+    {&decoder_beneficiaries_extensions, &generate_beneficiaries_extensions},
+    {&decoder_witness_properties, &generate_witness_properties},
+};
+
+static generator_t *get_generator(decoder_t *decoder) {
+    for (size_t i = 0; i < ARRAYLEN(GENERATORS); i++) {
+        if (GENERATORS[i].decoder == decoder) {
+            return GENERATORS[i].generator;
+        }
+    }
+    return &generate_raw;
+}
+
+static void generate_fields(fuzz_input_t *input, output_t *out) {
+    uint8_t operation = OPERATIONS[fuzz_u8(input) % ARRAYLEN(OPERATIONS)];
+    const parser_t *parser = get_operation_parser(operation);
+
+    for (uint8_t i = 0; i < parser->size; i++) {
+        if (parser->decoders[i] == &decoder_operation_name) {
+            put_u8(out, operation);
+        } else if (i + 1 < parser->size && parser->decoders[i + 1] == &decoder_custom_json) {
+            // id of custom_json selects the renderer of the payload which follows it
+            generate_custom_json_id(input, out);
+        } else {
+            (*get_generator(parser->decoders[i]))(input, out);
+        }
+    }
+}
+
+size_t generate_operation(fuzz_input_t *input, uint8_t *out, size_t out_len) {
+    output_t output = {.ptr = out, .size = out_len, .offset = 0, .overflow = false};
+
+    generate_fields(input, &output);
+
+    return output.overflow ? 0 : output.offset;
+}
+
+static void put_tlv(output_t *out, const uint8_t *value, size_t length) {
+    put_u8(out, 0x04);
+    if (length < 0x80) {
+        put_u8(out, (uint8_t) length);
+    } else if (length < 0x100) {
+        put_u8(out, 0x81);
+        put_u8(out, (uint8_t) length);
+    } else {
+        put_u8(out, 0x82);
+        put_u8(out, (uint8_t) (length >> 8));
+        put_u8(out, (uint8_t) length);
+    }
+    put(out, value, length);
+}
+
+size_t generate_transaction(fuzz_input_t *input, uint8_t *out, size_t out_len) {
+    output_t output = {.ptr = out, .size = out_len, .offset = 0, .overflow = false};
+    uint8_t chain_id[CHAIN_ID_LEN] = {0xBE, 0xEA, 0xB0, 0xDE};
+    uint8_t header[sizeof(uint32_t)];
+    uint8_t operation[MAX_TRANSACTION_LEN];
+    uint8_t single = 1, no_extensions = 0;
+
+    put_u8(&output, ARRAYLEN(BIP32_PATH));
+    for (size_t i = 0; i < ARRAYLEN(BIP32_PATH); i++) {
+        uint32_t index = BIP32_PATH[i];
+        uint8_t be[4] = {index >> 24, index >> 16, index >> 8, index};
+        put(&output, be, sizeof(be));
+    }
+
+    put_tlv(&output, chain_id, sizeof(chain_id));
+
+    // ref_block_num, ref_block_prefix and expiration
+    const size_t header_lengths[] = {sizeof(uint16_t), sizeof(uint32_t), sizeof(uint32_t)};
+    for (size_t i = 0; i < ARRAYLEN(header_lengths); i++) {
+        for (size_t j = 0; j < header_lengths[i]; j++) {
+            header[j] = fuzz_u8(input);
+        }
+        put_tlv(&output, header, header_lengths[i]);
+    }
+    put_tlv(&output, &single, sizeof(single));
+
+    size_t length = generate_operation(input, operation, sizeof(operation));
+    if (length == 0) {
+        return 0;
+    }
+    put_tlv(&output, operation, length);
+    put_tlv(&output, &no_extensions, sizeof(no_extensions));
+
+    return output.overflow ? 0 : output.offset;
+}
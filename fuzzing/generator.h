@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Fuzzer input consumed as a stream of decisions, reading past its end yields zeros.
+ */
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+    size_t offset;
+} fuzz_input_t;
+
+/**
+ * Consume single byte of fuzzer input.
+ *
+ * @param[in, out] input
+ *   Fuzzer input.
+ *
+ * @return next byte of input, 0 if the input is exhausted.
+ *
+ */
+uint8_t fuzz_u8(fuzz_input_t *input);
+
+/**
+ * Generate serialized operation: operation number followed by the fields of its parser_t descriptor. Every field is
+ * generated according to its decoder, so mutations of the input change field values and lengths instead of breaking
+ * the operation framing. Occasionally a length or a count is written off by a few bytes to exercise error paths.
+ *
+ * @param[in, out] input
+ *   Fuzzer input.
+ * @param[out]     out
+ *   Output buffer.
+ * @param[in]      out_len
+ *   Length of output buffer.
+ *
+ * @return length of the operation, 0 if it does not fit the output buffer.
+ *
+ */
+size_t generate_operation(fuzz_input_t *input, uint8_t *out, size_t out_len);
+
+/**
+ * Generate SIGN_TRANSACTION payload: BIP32 path, DER encoded transaction header, generated operation and extensions.
+ *
+ * @param[in, out] input
+ *   Fuzzer input.
+ * @param[out]     out
+ *   Output buffer.
+ * @param[in]      out_len
+ *   Length of output buffer.
+ *
+ * @return length of the payload, 0 if it does not fit the output buffer.
+ *
+ */
+size_t generate_transaction(fuzz_input_t *input, uint8_t *out, size_t out_len);
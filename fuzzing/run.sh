@@ -1,4 +1,5 @@
 #!/usr/bin/env bash
+# Usage: run.sh [apdu] [libFuzzer options...]
 
 set -e
 
@@ -6,4 +7,10 @@ SCRIPTDIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd )"
 BUILDDIR="$SCRIPTDIR/cmake-build-fuzz"
 CORPUSDIR="$SCRIPTDIR/corpus"
 
-"$BUILDDIR"/fuzz_hive "$CORPUSDIR" "$@" > /dev/null
+if [ "$1" = "apdu" ]; then
+    shift
+    mkdir -p "$SCRIPTDIR/corpus-apdu"
+    "$SCRIPTDIR"/cmake-build-fuzz-apdu/fuzz_apdu "$SCRIPTDIR/corpus-apdu" "$@" > /dev/null
+else
+    "$BUILDDIR"/fuzz_hive "$CORPUSDIR" "$@" > /dev/null
+fi
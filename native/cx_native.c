@@ -0,0 +1,629 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+/**
+ * OpenSSL backed implementation of the cx_* functions used by the application. Functions are linked with
+ * --wrap, so both the throwing and the *_no_throw flavours of the SDK headers end up here.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <openssl/bn.h>
+#include <openssl/core_names.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/obj_mac.h>
+
+#include "os.h"
+#include "cx.h"
+
+#include "constants.h"
+#include "common/macros.h"
+
+#include "native.h"
+
+/**
+ * SDK hash and HMAC structures are too small to keep OpenSSL state, it is kept aside and looked up by the address
+ * of the structure the application hashes into.
+ */
+typedef struct {
+    const void *owner;
+    EVP_MD_CTX *md;
+    EVP_MAC_CTX *mac;
+    uint8_t key[64];
+    size_t key_len;
+    size_t size;
+} native_hash_t;
+
+static native_hash_t g_hashes[8];
+
+static native_hash_t *native_hash_get(const void *owner) {
+    native_hash_t *free_slot = NULL;
+
+    for (size_t i = 0; i < ARRAYLEN(g_hashes); i++) {
+        if (g_hashes[i].owner == owner) {
+            return &g_hashes[i];
+        }
+        if (free_slot == NULL && g_hashes[i].owner == NULL) {
+            free_slot = &g_hashes[i];
+        }
+    }
+
+    // application abandons hashes when transaction is rejected, reuse the oldest slot
+    if (free_slot == NULL) {
+        free_slot = &g_hashes[0];
+    }
+
+    EVP_MD_CTX_free(free_slot->md);
+    EVP_MAC_CTX_free(free_slot->mac);
+    memset(free_slot, 0, sizeof(*free_slot));
+    free_slot->owner = owner;
+
+    return free_slot;
+}
+
+static cx_err_t native_md_init(const void *owner, const EVP_MD *type) {
+    native_hash_t *hash = native_hash_get(owner);
+
+    if (hash->md == NULL) {
+        hash->md = EVP_MD_CTX_new();
+    }
+    hash->size = EVP_MD_get_size(type);
+
+    return EVP_DigestInit_ex(hash->md, type, NULL) == 1 ? CX_OK : CX_INTERNAL_ERROR;
+}
+
+cx_err_t __wrap_cx_sha256_init_no_throw(cx_sha256_t *hash) {
+    return native_md_init(hash, EVP_sha256());
+}
+
+int __wrap_cx_sha256_init(cx_sha256_t *hash) {
+    __wrap_cx_sha256_init_no_throw(hash);
+    return CX_SHA256;
+}
+
+cx_err_t __wrap_cx_sha512_init_no_throw(cx_sha512_t *hash) {
+    return native_md_init(hash, EVP_sha512());
+}
+
+int __wrap_cx_sha512_init(cx_sha512_t *hash) {
+    __wrap_cx_sha512_init_no_throw(hash);
+    return CX_SHA512;
+}
+
+cx_err_t __wrap_cx_ripemd160_init_no_throw(cx_ripemd160_t *hash) {
+    return native_md_init(hash, EVP_ripemd160());
+}
+
+int __wrap_cx_ripemd160_init(cx_ripemd160_t *hash) {
+    __wrap_cx_ripemd160_init_no_throw(hash);
+    return CX_RIPEMD160;
+}
+
+cx_err_t __wrap_cx_hash_no_throw(cx_hash_t *hash, uint32_t mode, const uint8_t *in, size_t len, uint8_t *out, size_t out_len) {
+    native_hash_t *state = native_hash_get(hash);
+    unsigned int size = 0;
+
+    if (state->md == NULL || (len > 0 && EVP_DigestUpdate(state->md, in, len) != 1)) {
+        return CX_INTERNAL_ERROR;
+    }
+
+    if (mode & CX_LAST) {
+        if (out_len < state->size || EVP_DigestFinal_ex(state->md, out, &size) != 1) {
+            return CX_INVALID_PARAMETER;
+        }
+        EVP_DigestInit_ex(state->md, NULL, NULL);
+    }
+
+    return CX_OK;
+}
+
+int __wrap_cx_hash(cx_hash_t *hash, int mode, const unsigned char *in, unsigned int len, unsigned char *out, unsigned int out_len) {
+    if (__wrap_cx_hash_no_throw(hash, mode, in, len, out, out_len) != CX_OK) {
+        THROW(INVALID_PARAMETER);
+    }
+    return (mode & CX_LAST) ? (int) native_hash_get(hash)->size : 0;
+}
+
+size_t __wrap_cx_hash_get_size(const cx_hash_t *hash) {
+    return native_hash_get(hash)->size;
+}
+
+cx_err_t __wrap_cx_hash_final(cx_hash_t *hash, uint8_t *digest) {
+    return __wrap_cx_hash_no_throw(hash, CX_LAST, NULL, 0, digest, native_hash_get(hash)->size);
+}
+
+static size_t native_digest(const EVP_MD *type, const uint8_t *in, size_t len, uint8_t *out, size_t out_len) {
+    unsigned int size = 0;
+
+    if (out_len < (size_t) EVP_MD_get_size(type) || EVP_Digest(in, len, out, &size, type, NULL) != 1) {
+        THROW(INVALID_PARAMETER);
+    }
+
+    return size;
+}
+
+size_t __wrap_cx_hash_sha256(const uint8_t *in, size_t len, uint8_t *out, size_t out_len) {
+    return native_digest(EVP_sha256(), in, len, out, out_len);
+}
+
+size_t __wrap_cx_hash_sha512(const uint8_t *in, size_t len, uint8_t *out, size_t out_len) {
+    return native_digest(EVP_sha512(), in, len, out, out_len);
+}
+
+static cx_err_t native_hmac_reset(native_hash_t *state) {
+    OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, "SHA256", 0), OSSL_PARAM_construct_end()};
+
+    return EVP_MAC_init(state->mac, state->key, state->key_len, params) == 1 ? CX_OK : CX_INTERNAL_ERROR;
+}
+
+cx_err_t __wrap_cx_hmac_sha256_init_no_throw(cx_hmac_sha256_t *hmac, const uint8_t *key, size_t key_len) {
+    native_hash_t *state = native_hash_get(hmac);
+
+    if (key_len > sizeof(state->key)) {
+        return CX_INVALID_PARAMETER;
+    }
+
+    if (state->mac == NULL) {
+        EVP_MAC *mac = EVP_MAC_fetch(NULL, "HMAC", NULL);
+        state->mac = EVP_MAC_CTX_new(mac);
+        EVP_MAC_free(mac);
+    }
+
+    memcpy(state->key, key, key_len);
+    state->key_len = key_len;
+    state->size = CX_SHA256_SIZE;
+
+    return native_hmac_reset(state);
+}
+
+int __wrap_cx_hmac_sha256_init(cx_hmac_sha256_t *hmac, const unsigned char *key, unsigned int key_len) {
+    if (__wrap_cx_hmac_sha256_init_no_throw(hmac, key, key_len) != CX_OK) {
+        THROW(INVALID_PARAMETER);
+    }
+    return CX_SHA256;
+}
+
+cx_err_t __wrap_cx_hmac_no_throw(cx_hmac_t *hmac, uint32_t mode, const uint8_t *in, size_t len, uint8_t *mac, size_t mac_len) {
+    native_hash_t *state = native_hash_get(hmac);
+    size_t size = 0;
+
+    if (state->mac == NULL || (len > 0 && EVP_MAC_update(state->mac, in, len) != 1)) {
+        return CX_INTERNAL_ERROR;
+    }
+
+    if (mode & CX_LAST) {
+        if (EVP_MAC_final(state->mac, mac, &size, mac_len) != 1) {
+            return CX_INVALID_PARAMETER;
+        }
+        // SDK keeps the key, so HMAC can be computed again without init
+        return native_hmac_reset(state);
+    }
+
+    return CX_OK;
+}
+
+int __wrap_cx_hmac(cx_hmac_t *hmac, int mode, const unsigned char *in, unsigned int len, unsigned char *mac, unsigned int mac_len) {
+    if (__wrap_cx_hmac_no_throw(hmac, mode, in, len, mac, mac_len) != CX_OK) {
+        THROW(INVALID_PARAMETER);
+    }
+    return (mode & CX_LAST) ? CX_SHA256_SIZE : 0;
+}
+
+/**
+ * secp256k1 group shared by all the curve operations
+ */
+static const EC_GROUP *native_group(void) {
+    static EC_GROUP *group = NULL;
+
+    if (group == NULL) {
+        group = EC_GROUP_new_by_curve_name(NID_secp256k1);
+    }
+
+    return group;
+}
+
+static void native_bn_to_bytes(const BIGNUM *bn, uint8_t *out, size_t len) {
+    BN_bn2binpad(bn, out, len);
+}
+
+cx_err_t __wrap_cx_ecfp_init_private_key_no_throw(cx_curve_t curve, const uint8_t *raw_key, size_t key_len, cx_ecfp_private_key_t *pvkey) {
+    if (curve != CX_CURVE_256K1 || key_len > sizeof(pvkey->d)) {
+        return CX_INVALID_PARAMETER;
+    }
+
+    pvkey->curve = curve;
+    pvkey->d_len = key_len;
+    memcpy(pvkey->d, raw_key, key_len);
+
+    return CX_OK;
+}
+
+int __wrap_cx_ecfp_init_private_key(cx_curve_t curve, const unsigned char *raw_key, unsigned int key_len, cx_ecfp_private_key_t *pvkey) {
+    if (__wrap_cx_ecfp_init_private_key_no_throw(curve, raw_key, key_len, pvkey) != CX_OK) {
+        THROW(INVALID_PARAMETER);
+    }
+    return key_len;
+}
+
+/**
+ * Multiply point (generator if NULL) by scalar, uncompressed result is written to out
+ */
+static bool native_point_mul(const uint8_t *scalar, size_t scalar_len, const uint8_t *point, size_t point_len, uint8_t out[static 65]) {
+    const EC_GROUP *group = native_group();
+    BN_CTX *ctx = BN_CTX_new();
+    BIGNUM *k = BN_bin2bn(scalar, scalar_len, NULL);
+    EC_POINT *P = NULL;
+    EC_POINT *R = EC_POINT_new(group);
+    bool is_valid = false;
+
+    if (point != NULL) {
+        P = EC_POINT_new(group);
+        if (EC_POINT_oct2point(group, P, point, point_len, ctx) != 1) {
+            goto end;
+        }
+    }
+
+    if (EC_POINT_mul(group, R, point == NULL ? k : NULL, P, point == NULL ? NULL : k, ctx) != 1 || EC_POINT_is_at_infinity(group, R)) {
+        goto end;
+    }
+
+    is_valid = EC_POINT_point2oct(group, R, POINT_CONVERSION_UNCOMPRESSED, out, 65, ctx) == 65;
+
+end:
+    EC_POINT_free(P);
+    EC_POINT_free(R);
+    BN_clear_free(k);
+    BN_CTX_free(ctx);
+
+    return is_valid;
+}
+
+bool native_public_key(const uint8_t private_key[static 32], uint8_t public_key[static 65]) {
+    return native_point_mul(private_key, 32, NULL, 0, public_key);
+}
+
+cx_err_t __wrap_cx_ecfp_generate_pair_no_throw(cx_curve_t curve, cx_ecfp_public_key_t *pubkey, cx_ecfp_private_key_t *privkey, bool keep_private) {
+    if (curve != CX_CURVE_256K1 || !keep_private || !native_public_key(privkey->d, pubkey->W)) {
+        return CX_INVALID_PARAMETER;
+    }
+
+    pubkey->curve = curve;
+    pubkey->W_len = 65;
+
+    return CX_OK;
+}
+
+int __wrap_cx_ecfp_generate_pair(cx_curve_t curve, cx_ecfp_public_key_t *pubkey, cx_ecfp_private_key_t *privkey, int keep_private) {
+    if (__wrap_cx_ecfp_generate_pair_no_throw(curve, pubkey, privkey, keep_private) != CX_OK) {
+        THROW(INVALID_PARAMETER);
+    }
+    return 0;
+}
+
+/**
+ * Append DER encoded positive integer
+ */
+static size_t native_der_integer(const BIGNUM *value, uint8_t *out) {
+    uint8_t raw[33] = {0};
+    size_t len = BN_num_bytes(value);
+    size_t offset = 0;
+
+    BN_bn2binpad(value, raw + 1, 32);
+    offset = 33 - len;
+    // keep leading zero byte when the value would be negative
+    if (raw[offset] & 0x80) {
+        offset--;
+    }
+
+    out[0] = 0x02;
+    out[1] = 33 - offset;
+    memcpy(out + 2, raw + offset, 33 - offset);
+
+    return 2 + 33 - offset;
+}
+
+cx_err_t __wrap_cx_ecdsa_sign_no_throw(const cx_ecfp_private_key_t *pvkey,
+                                       uint32_t mode,
+                                       cx_md_t hash_id,
+                                       const uint8_t *hash,
+                                       size_t hash_len,
+                                       uint8_t *sig,
+                                       size_t *sig_len,
+                                       uint32_t *info) {
+    const EC_GROUP *group = native_group();
+    BN_CTX *ctx = BN_CTX_new();
+    BIGNUM *n = BN_new();
+    BIGNUM *k = NULL, *d = NULL, *e = NULL, *r = BN_new(), *s = BN_new(), *x = BN_new(), *y = BN_new();
+    EC_POINT *R = EC_POINT_new(group);
+    cx_err_t err = CX_INVALID_PARAMETER;
+    uint8_t der[MAX_DER_SIG_LEN] = {0};
+    size_t offset = 2;
+
+    UNUSED(hash_id);
+
+    // nonce is always provided by the application (RFC 6979 variant compatible with Hive)
+    if ((mode & CX_RND_PROVIDED) == 0 || *sig_len < 32) {
+        goto end;
+    }
+
+    EC_GROUP_get_order(group, n, ctx);
+    k = BN_bin2bn(sig, 32, NULL);
+    d = BN_bin2bn(pvkey->d, pvkey->d_len, NULL);
+    e = BN_bin2bn(hash, hash_len, NULL);
+
+    if (EC_POINT_mul(group, R, k, NULL, NULL, ctx) != 1 || EC_POINT_get_affine_coordinates(group, R, x, y, ctx) != 1) {
+        goto end;
+    }
+
+    *info = 0;
+    if (BN_is_odd(y)) {
+        *info |= CX_ECCINFO_PARITY_ODD;
+    }
+    if (BN_cmp(x, n) >= 0) {
+        *info |= CX_ECCINFO_xGTn;
+    }
+
+    // r = x mod n, s = k^-1 (e + r * d) mod n, s is not normalized (CX_NO_CANONICAL)
+    BN_nnmod(r, x, n, ctx);
+    BN_mod_mul(s, r, d, n, ctx);
+    BN_mod_add(s, s, e, n, ctx);
+    BN_mod_inverse(k, k, n, ctx);
+    BN_mod_mul(s, s, k, n, ctx);
+
+    offset += native_der_integer(r, der + offset);
+    offset += native_der_integer(s, der + offset);
+    der[0] = 0x30;
+    der[1] = offset - 2;
+
+    if (offset > *sig_len) {
+        goto end;
+    }
+
+    memcpy(sig, der, offset);
+    *sig_len = offset;
+    err = CX_OK;
+
+end:
+    EC_POINT_free(R);
+    BN_clear_free(k);
+    BN_clear_free(d);
+    BN_free(e);
+    BN_free(n);
+    BN_free(r);
+    BN_free(s);
+    BN_free(x);
+    BN_free(y);
+    BN_CTX_free(ctx);
+
+    return err;
+}
+
+int __wrap_cx_ecdsa_sign(const cx_ecfp_private_key_t *pvkey,
+                         int mode,
+                         cx_md_t hash_id,
+                         const unsigned char *hash,
+                         unsigned int hash_len,
+                         unsigned char *sig,
+                         unsigned int sig_len,
+                         unsigned int *info) {
+    size_t len = sig_len;
+    uint32_t out_info = 0;
+
+    if (__wrap_cx_ecdsa_sign_no_throw(pvkey, mode, hash_id, hash, hash_len, sig, &len, &out_info) != CX_OK) {
+        THROW(INVALID_PARAMETER);
+    }
+    if (info != NULL) {
+        *info = out_info;
+    }
+
+    return len;
+}
+
+cx_err_t __wrap_cx_ecdh_no_throw(const cx_ecfp_private_key_t *pvkey, uint32_t mode, const uint8_t *P, size_t P_len, uint8_t *secret, size_t secret_len) {
+    uint8_t point[65] = {0};
+
+    if (!native_point_mul(pvkey->d, pvkey->d_len, P, P_len, point)) {
+        return CX_INVALID_PARAMETER;
+    }
+
+    if ((mode & CX_ECDH_X) && secret_len >= 32) {
+        memcpy(secret, point + 1, 32);
+    } else if ((mode & CX_ECDH_POINT) && secret_len >= 65) {
+        memcpy(secret, point, 65);
+    } else {
+        return CX_INVALID_PARAMETER;
+    }
+
+    return CX_OK;
+}
+
+int __wrap_cx_ecdh(const cx_ecfp_private_key_t *pvkey, int mode, const unsigned char *P, unsigned int P_len, unsigned char *secret, unsigned int secret_len) {
+    if (__wrap_cx_ecdh_no_throw(pvkey, mode, P, P_len, secret, secret_len) != CX_OK) {
+        THROW(INVALID_PARAMETER);
+    }
+    return (mode & CX_ECDH_X) ? 32 : 65;
+}
+
+cx_err_t __wrap_cx_aes_init_key_no_throw(const uint8_t *raw_key, size_t key_len, cx_aes_key_t *key) {
+    if (key_len != 16 && key_len != 24 && key_len != 32) {
+        return CX_INVALID_PARAMETER;
+    }
+
+    key->size = key_len;
+    memcpy(key->keys, raw_key, key_len);
+
+    return CX_OK;
+}
+
+int __wrap_cx_aes_init_key(const unsigned char *raw_key, unsigned int key_len, cx_aes_key_t *key) {
+    if (__wrap_cx_aes_init_key_no_throw(raw_key, key_len, key) != CX_OK) {
+        THROW(INVALID_PARAMETER);
+    }
+    return key_len;
+}
+
+cx_err_t __wrap_cx_aes_iv_no_throw(const cx_aes_key_t *key,
+                                   uint32_t mode,
+                                   const uint8_t *iv,
+                                   size_t iv_len,
+                                   const uint8_t *in,
+                                   size_t in_len,
+                                   uint8_t *out,
+                                   size_t *out_len) {
+    const EVP_CIPHER *cipher = key->size == 32 ? EVP_aes_256_cbc() : (key->size == 24 ? EVP_aes_192_cbc() : EVP_aes_128_cbc());
+    EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+    int len = 0, final_len = 0;
+    cx_err_t err = CX_INVALID_PARAMETER;
+
+    // only CBC without padding is used by the application
+    if ((mode & CX_CHAIN_CBC) == 0 || (mode & CX_PAD_ISO9797M2) || iv_len != 16 || in_len % 16 != 0 || *out_len < in_len) {
+        goto end;
+    }
+
+    if (EVP_CipherInit_ex(ctx, cipher, NULL, key->keys, iv, (mode & CX_DECRYPT) ? 0 : 1) != 1) {
+        goto end;
+    }
+    EVP_CIPHER_CTX_set_padding(ctx, 0);
+
+    if (EVP_CipherUpdate(ctx, out, &len, in, in_len) != 1 || EVP_CipherFinal_ex(ctx, out + len, &final_len) != 1) {
+        goto end;
+    }
+
+    *out_len = len + final_len;
+    err = CX_OK;
+
+end:
+    EVP_CIPHER_CTX_free(ctx);
+
+    return err;
+}
+
+int __wrap_cx_aes_iv(const cx_aes_key_t *key,
+                     int mode,
+                     const unsigned char *iv,
+                     unsigned int iv_len,
+                     const unsigned char *in,
+                     unsigned int in_len,
+                     unsigned char *out,
+                     unsigned int out_len) {
+    size_t len = out_len;
+
+    if (__wrap_cx_aes_iv_no_throw(key, mode, iv, iv_len, in, in_len, out, &len) != CX_OK) {
+        THROW(INVALID_PARAMETER);
+    }
+
+    return len;
+}
+
+/**
+ * Big number arithmetic on big endian buffers of the same length
+ */
+typedef enum { NATIVE_ADDM, NATIVE_MULTM, NATIVE_POWM } native_math_op_t;
+
+static void native_math(native_math_op_t op, uint8_t *r, const uint8_t *a, const uint8_t *b, size_t b_len, const uint8_t *m, size_t len) {
+    BN_CTX *ctx = BN_CTX_new();
+    BIGNUM *A = BN_bin2bn(a, len, NULL);
+    BIGNUM *B = BN_bin2bn(b, b_len, NULL);
+    BIGNUM *M = BN_bin2bn(m, len, NULL);
+    BIGNUM *R = BN_new();
+
+    switch (op) {
+        case NATIVE_ADDM:
+            BN_mod_add(R, A, B, M, ctx);
+            break;
+        case NATIVE_MULTM:
+            BN_mod_mul(R, A, B, M, ctx);
+            break;
+        case NATIVE_POWM:
+            BN_mod_exp(R, A, B, M, ctx);
+            break;
+    }
+
+    native_bn_to_bytes(R, r, len);
+
+    BN_free(A);
+    BN_free(B);
+    BN_free(M);
+    BN_free(R);
+    BN_CTX_free(ctx);
+}
+
+cx_err_t __wrap_cx_math_addm_no_throw(uint8_t *r, const uint8_t *a, const uint8_t *b, const uint8_t *m, size_t len) {
+    native_math(NATIVE_ADDM, r, a, b, len, m, len);
+    return CX_OK;
+}
+
+void __wrap_cx_math_addm(uint8_t *r, const uint8_t *a, const uint8_t *b, const uint8_t *m, size_t len) {
+    __wrap_cx_math_addm_no_throw(r, a, b, m, len);
+}
+
+cx_err_t __wrap_cx_math_multm_no_throw(uint8_t *r, const uint8_t *a, const uint8_t *b, const uint8_t *m, size_t len) {
+    native_math(NATIVE_MULTM, r, a, b, len, m, len);
+    return CX_OK;
+}
+
+void __wrap_cx_math_multm(uint8_t *r, const uint8_t *a, const uint8_t *b, const uint8_t *m, size_t len) {
+    __wrap_cx_math_multm_no_throw(r, a, b, m, len);
+}
+
+cx_err_t __wrap_cx_math_powm_no_throw(uint8_t *r, const uint8_t *a, const uint8_t *e, size_t len_e, const uint8_t *m, size_t len) {
+    native_math(NATIVE_POWM, r, a, e, len_e, m, len);
+    return CX_OK;
+}
+
+void __wrap_cx_math_powm(uint8_t *r, const uint8_t *a, const uint8_t *e, size_t len_e, const uint8_t *m, size_t len) {
+    __wrap_cx_math_powm_no_throw(r, a, e, len_e, m, len);
+}
+
+cx_err_t __wrap_cx_math_sub_no_throw(uint8_t *r, const uint8_t *a, const uint8_t *b, size_t len) {
+    int borrow = 0;
+
+    for (size_t i = len; i > 0; i--) {
+        int value = a[i - 1] - b[i - 1] - borrow;
+        borrow = value < 0;
+        r[i - 1] = (uint8_t) value;
+    }
+
+    return CX_OK;
+}
+
+int __wrap_cx_math_sub(uint8_t *r, const uint8_t *a, const uint8_t *b, size_t len) {
+    int borrow = memcmp(a, b, len) < 0;
+    __wrap_cx_math_sub_no_throw(r, a, b, len);
+    return borrow;
+}
+
+cx_err_t __wrap_cx_math_cmp_no_throw(const uint8_t *a, const uint8_t *b, size_t len, int *diff) {
+    *diff = memcmp(a, b, len);
+    return CX_OK;
+}
+
+int __wrap_cx_math_cmp(const uint8_t *a, const uint8_t *b, size_t len) {
+    return memcmp(a, b, len);
+}
+
+bool __wrap_cx_math_is_zero(const uint8_t *a, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (a[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,104 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+/**
+ * Host replacement of src/io.c and of the APDU loop of src/main.c, responses are written to a buffer
+ * instead of being sent over SPI.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "os.h"
+
+#include "io.h"
+#include "sw.h"
+#include "globals.h"
+#include "apdu/parser.h"
+#include "apdu/dispatcher.h"
+#include "common/buffer.h"
+#include "common/write.h"
+
+#include "native.h"
+
+uint32_t G_output_len = 0;
+
+// command and response share the buffer, as on the device
+uint8_t G_io_apdu_buffer[IO_APDU_BUFFER_SIZE];
+
+static size_t g_response_len = 0;
+
+int io_send_response(const buffer_t *rdata, uint16_t sw) {
+    if (rdata == NULL) {
+        return io_send_response_length(0, sw);
+    }
+
+    if (!buffer_copy(rdata, G_io_apdu_buffer, sizeof(G_io_apdu_buffer) - 2)) {
+        return io_send_sw(SW_WRONG_RESPONSE_LENGTH);
+    }
+
+    return io_send_response_length(rdata->size - rdata->offset, sw);
+}
+
+int io_send_response_length(size_t length, uint16_t sw) {
+    if (length > sizeof(G_io_apdu_buffer) - 2) {
+        return io_send_sw(SW_WRONG_RESPONSE_LENGTH);
+    }
+
+    write_u16_be(G_io_apdu_buffer, length, sw);
+    g_response_len = length + 2;
+    G_output_len = g_response_len;
+
+    return (int) g_response_len;
+}
+
+int io_send_sw(uint16_t sw) {
+    return io_send_response(NULL, sw);
+}
+
+size_t native_exchange(uint8_t *apdu, size_t apdu_len, uint8_t response[static NATIVE_MAX_RESPONSE_LEN]) {
+    command_t cmd;
+
+    memset(&cmd, 0, sizeof(cmd));
+    g_response_len = 0;
+
+    // command is received in the APDU buffer, too long one is left empty and rejected by the parser
+    if (apdu_len > sizeof(G_io_apdu_buffer)) {
+        apdu_len = 0;
+    }
+    memmove(G_io_apdu_buffer, apdu, apdu_len);
+
+    BEGIN_TRY {
+        TRY {
+            if (!apdu_parser(&cmd, G_io_apdu_buffer, apdu_len)) {
+                io_send_sw(SW_WRONG_DATA_LENGTH);
+            } else {
+                apdu_dispatcher(&cmd);
+            }
+        }
+        CATCH_OTHER(e) {
+            io_send_sw(e);
+        }
+        FINALLY {
+        }
+    }
+    END_TRY;
+
+    memmove(response, G_io_apdu_buffer, g_response_len);
+
+    return g_response_len;
+}
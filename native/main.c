@@ -0,0 +1,312 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+/**
+ * Native host simulator of the application.
+ *
+ * Usage: hive_native [options]
+ *   --script FILE        replay APDU script ("=> apdu" and expected "<= response" lines), fail on mismatch
+ *   --iterations N       replay the script N times and report throughput
+ *   --port PORT          serve APDUs over TCP with Speculos APDU protocol (functional tests use 40000)
+ *   --mnemonic WORDS     BIP39 mnemonic of the simulated device
+ *   --hash-signing       enable hash signing in settings
+ *   --session-signing    enable session signing in settings
+ *   --summary-review     enable summary review in settings
+ *   --reject             simulated user rejects every review
+ *
+ * Without --script and --port APDUs are read from stdin, one hex encoded command per line, and responses are
+ * written to stdout the same way.
+ */
+
+#include <arpa/inet.h>
+#include <ctype.h>
+#include <netinet/in.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "os.h"
+
+#include "globals.h"
+#include "types.h"
+
+#include "native.h"
+
+#define MAX_LINE_LEN 1024
+
+static size_t hex_decode(const char *hex, uint8_t *out, size_t out_len) {
+    size_t len = 0;
+
+    while (*hex != '\0' && !isspace((unsigned char) *hex)) {
+        unsigned int byte = 0;
+
+        if (len >= out_len || sscanf(hex, "%2x", &byte) != 1 || !isxdigit((unsigned char) hex[1])) {
+            return 0;
+        }
+        out[len++] = (uint8_t) byte;
+        hex += 2;
+    }
+
+    return len;
+}
+
+static void hex_print(FILE *stream, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        fprintf(stream, "%02x", data[i]);
+    }
+    fprintf(stream, "\n");
+}
+
+static const char *skip_spaces(const char *line) {
+    while (isspace((unsigned char) *line)) {
+        line++;
+    }
+    return line;
+}
+
+static int run_stdin(void) {
+    char line[MAX_LINE_LEN];
+    uint8_t apdu[MAX_LINE_LEN / 2];
+    uint8_t response[NATIVE_MAX_RESPONSE_LEN];
+
+    while (fgets(line, sizeof(line), stdin) != NULL) {
+        const char *hex = skip_spaces(line);
+        if (*hex == '\0' || *hex == '#') {
+            continue;
+        }
+
+        size_t apdu_len = hex_decode(hex, apdu, sizeof(apdu));
+        if (apdu_len == 0) {
+            fprintf(stderr, "invalid APDU: %s", line);
+            return EXIT_FAILURE;
+        }
+
+        hex_print(stdout, response, native_exchange(apdu, apdu_len, response));
+        fflush(stdout);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Replay script once, return number of exchanges or -1 on mismatch
+ */
+static int replay_script(FILE *script, const char *name, bool verbose) {
+    char line[MAX_LINE_LEN];
+    uint8_t apdu[MAX_LINE_LEN / 2];
+    uint8_t expected[NATIVE_MAX_RESPONSE_LEN];
+    uint8_t response[NATIVE_MAX_RESPONSE_LEN];
+    size_t response_len = 0;
+    unsigned int line_number = 0;
+    int exchanges = 0;
+
+    rewind(script);
+
+    while (fgets(line, sizeof(line), script) != NULL) {
+        const char *text = skip_spaces(line);
+        line_number++;
+
+        if (strncmp(text, "=>", 2) == 0) {
+            size_t apdu_len = hex_decode(skip_spaces(text + 2), apdu, sizeof(apdu));
+            if (apdu_len == 0) {
+                fprintf(stderr, "%s:%u: invalid APDU\n", name, line_number);
+                return -1;
+            }
+            response_len = native_exchange(apdu, apdu_len, response);
+            exchanges++;
+        } else if (strncmp(text, "<=", 2) == 0) {
+            size_t expected_len = hex_decode(skip_spaces(text + 2), expected, sizeof(expected));
+            if (expected_len != response_len || memcmp(expected, response, response_len) != 0) {
+                fprintf(stderr, "%s:%u: unexpected response\n  expected: ", name, line_number);
+                hex_print(stderr, expected, expected_len);
+                fprintf(stderr, "  received: ");
+                hex_print(stderr, response, response_len);
+                return -1;
+            }
+            if (verbose) {
+                printf("%s:%u: ok\n", name, line_number);
+            }
+        } else if (*text != '\0' && *text != '#') {
+            fprintf(stderr, "%s:%u: invalid line\n", name, line_number);
+            return -1;
+        }
+    }
+
+    return exchanges;
+}
+
+static int run_script(const char *name, unsigned long iterations) {
+    FILE *script = fopen(name, "r");
+    struct timespec start, end;
+    long exchanges = 0;
+
+    if (script == NULL) {
+        perror(name);
+        return EXIT_FAILURE;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (unsigned long i = 0; i < iterations; i++) {
+        int result = replay_script(script, name, iterations == 1);
+        if (result < 0) {
+            fclose(script);
+            return EXIT_FAILURE;
+        }
+        exchanges += result;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    fclose(script);
+
+    if (iterations > 1) {
+        double elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        printf("%s: %ld exchanges in %.3f s, %.0f exchanges/s\n", name, exchanges, elapsed, exchanges / elapsed);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+static bool read_exact(int fd, uint8_t *data, size_t len) {
+    while (len > 0) {
+        ssize_t received = read(fd, data, len);
+        if (received <= 0) {
+            return false;
+        }
+        data += received;
+        len -= received;
+    }
+    return true;
+}
+
+static bool write_exact(int fd, const uint8_t *data, size_t len) {
+    while (len > 0) {
+        ssize_t sent = write(fd, data, len);
+        if (sent <= 0) {
+            return false;
+        }
+        data += sent;
+        len -= sent;
+    }
+    return true;
+}
+
+/**
+ * Speculos APDU protocol: command is prefixed with its length (4 bytes, big endian), response with length of the
+ * response data without status word.
+ */
+static int run_server(uint16_t port) {
+    struct sockaddr_in address = {.sin_family = AF_INET, .sin_port = htons(port), .sin_addr.s_addr = htonl(INADDR_LOOPBACK)};
+    int enable = 1;
+    int server = socket(AF_INET, SOCK_STREAM, 0);
+
+    if (server < 0 || setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable)) < 0 ||
+        bind(server, (struct sockaddr *) &address, sizeof(address)) < 0 || listen(server, 1) < 0) {
+        perror("socket");
+        return EXIT_FAILURE;
+    }
+
+    fprintf(stderr, "listening for APDUs on 127.0.0.1:%u\n", port);
+
+    for (;;) {
+        int client = accept(server, NULL, NULL);
+        uint8_t header[4];
+        uint8_t apdu[MAX_APDU_LEN + 5];
+        uint8_t response[4 + NATIVE_MAX_RESPONSE_LEN];
+
+        if (client < 0) {
+            continue;
+        }
+
+        while (read_exact(client, header, sizeof(header))) {
+            uint32_t apdu_len = (uint32_t) header[0] << 24 | (uint32_t) header[1] << 16 | (uint32_t) header[2] << 8 | header[3];
+
+            if (apdu_len > sizeof(apdu) || !read_exact(client, apdu, apdu_len)) {
+                break;
+            }
+
+            size_t response_len = native_exchange(apdu, apdu_len, response + 4);
+            uint32_t data_len = response_len - 2;
+            response[0] = data_len >> 24;
+            response[1] = data_len >> 16;
+            response[2] = data_len >> 8;
+            response[3] = data_len;
+
+            if (!write_exact(client, response, 4 + response_len)) {
+                break;
+            }
+        }
+
+        close(client);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[]) {
+    const char *script = NULL;
+    const char *mnemonic = NATIVE_DEFAULT_MNEMONIC;
+    unsigned long iterations = 1;
+    long port = 0;
+    settings_t settings = {.initialized = 0x01,
+                           .sign_hash_policy = DISABLED,
+                           .session_signing_policy = SESSION_SIGNING_DISABLED,
+                           .summary_review_policy = SUMMARY_REVIEW_DISABLED};
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--script") == 0 && i + 1 < argc) {
+            script = argv[++i];
+        } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--port") == 0 && i + 1 < argc) {
+            port = strtol(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--mnemonic") == 0 && i + 1 < argc) {
+            mnemonic = argv[++i];
+        } else if (strcmp(argv[i], "--hash-signing") == 0) {
+            settings.sign_hash_policy = ENABLED;
+        } else if (strcmp(argv[i], "--session-signing") == 0) {
+            settings.session_signing_policy = SESSION_SIGNING_ENABLED;
+        } else if (strcmp(argv[i], "--summary-review") == 0) {
+            settings.summary_review_policy = SUMMARY_REVIEW_ENABLED;
+        } else if (strcmp(argv[i], "--reject") == 0) {
+            G_native_approve = false;
+        } else {
+            fprintf(stderr, "unknown option: %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (iterations == 0 || port < 0 || port > UINT16_MAX || !native_seed_init(mnemonic)) {
+        fprintf(stderr, "invalid options\n");
+        return EXIT_FAILURE;
+    }
+
+    nvm_write((void *) &N_settings, (void *) &settings, sizeof(settings_t));
+    explicit_bzero(&G_context, sizeof(G_context));
+
+    if (script != NULL) {
+        return run_script(script, iterations);
+    }
+    if (port != 0) {
+        return run_server((uint16_t) port);
+    }
+
+    return run_stdin();
+}
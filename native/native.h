@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "os.h"
+
+#include "constants.h"
+
+/**
+ * Mnemonic used by the functional tests (see test/README.md), default seed of the native build.
+ */
+#define NATIVE_DEFAULT_MNEMONIC                                                                                         \
+    "salon stock memory business develop elegant chronic kite aspect nothing tone essay huge knock flip bar noise main " \
+    "cloth coin flavor only melody gain"
+
+/**
+ * Maximum length of APDU response (data and status word).
+ */
+#define NATIVE_MAX_RESPONSE_LEN IO_APDU_BUFFER_SIZE
+
+/**
+ * Whether simulated user approves or rejects every confirmation.
+ */
+extern bool G_native_approve;
+
+/**
+ * Derive BIP32 master node from BIP39 mnemonic (without passphrase).
+ *
+ * @param[in] mnemonic
+ *   Space separated mnemonic words.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool native_seed_init(const char *mnemonic);
+
+/**
+ * Compute uncompressed secp256k1 public key.
+ *
+ * @param[in]  private_key
+ *   32 bytes private key.
+ * @param[out] public_key
+ *   65 bytes uncompressed public key.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool native_public_key(const uint8_t private_key[static 32], uint8_t public_key[static 65]);
+
+/**
+ * Process single APDU command with the application dispatcher.
+ *
+ * @param[in]  apdu
+ *   Raw APDU command.
+ * @param[in]  apdu_len
+ *   Length of APDU command.
+ * @param[out] response
+ *   Buffer for response data followed by status word.
+ *
+ * @return length of the response.
+ *
+ */
+size_t native_exchange(uint8_t *apdu, size_t apdu_len, uint8_t response[static NATIVE_MAX_RESPONSE_LEN]);
@@ -0,0 +1,180 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+/**
+ * Host implementation of the BOLOS system calls used by the application: exceptions, PIC, NVM and BIP32 derivation
+ * from a mnemonic (the default one is the mnemonic of the functional tests, so keys match).
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include <openssl/bn.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+#include "os.h"
+#include "cx.h"
+
+#include "native.h"
+
+#define BIP32_HARDENED 0x80000000u
+
+static try_context_t *current_context = NULL;
+static uint8_t g_master_key[32];
+static uint8_t g_master_chain_code[32];
+
+try_context_t *try_context_get(void) {
+    return current_context;
+}
+
+try_context_t *try_context_set(try_context_t *ctx) {
+    try_context_t *previous_ctx = current_context;
+    current_context = ctx;
+    return previous_ctx;
+}
+
+void __wrap_os_longjmp(unsigned int exception) {
+    longjmp(try_context_get()->jmp_buf, exception);
+}
+
+void *__wrap_pic(void *link_address) {
+    return link_address;
+}
+
+void __wrap_nvm_write(void *dst_adr, void *src_adr, unsigned int src_len) {
+    // NVM variables are const, make their page writable as flash would be
+    long page_size = sysconf(_SC_PAGESIZE);
+    uintptr_t start = (uintptr_t) dst_adr & ~((uintptr_t) page_size - 1);
+    uintptr_t end = (uintptr_t) dst_adr + src_len;
+
+    mprotect((void *) start, end - start, PROT_READ | PROT_WRITE);
+
+    if (src_adr == NULL) {
+        memset(dst_adr, 0, src_len);
+    } else {
+        memmove(dst_adr, src_adr, src_len);
+    }
+}
+
+void __wrap_io_seproxyhal_io_heartbeat(void) {
+}
+
+void __wrap_os_sched_exit(bolos_task_status_t exit_code) {
+    exit(exit_code);
+}
+
+bool native_seed_init(const char *mnemonic) {
+    uint8_t seed[64] = {0};
+    uint8_t node[64] = {0};
+    unsigned int node_len = sizeof(node);
+    static const char SALT[] = "mnemonic";
+
+    // BIP39 seed without passphrase, BIP32 master node
+    if (PKCS5_PBKDF2_HMAC(mnemonic, strlen(mnemonic), (const uint8_t *) SALT, strlen(SALT), 2048, EVP_sha512(), sizeof(seed), seed) != 1 ||
+        HMAC(EVP_sha512(), "Bitcoin seed", 12, seed, sizeof(seed), node, &node_len) == NULL) {
+        return false;
+    }
+
+    memcpy(g_master_key, node, 32);
+    memcpy(g_master_chain_code, node + 32, 32);
+
+    explicit_bzero(seed, sizeof(seed));
+    explicit_bzero(node, sizeof(node));
+
+    return true;
+}
+
+/**
+ * BIP32 private child key derivation
+ */
+static bool native_derive_child(uint8_t key[static 32], uint8_t chain_code[static 32], uint32_t index) {
+    uint8_t data[1 + 32 + 4] = {0};
+    uint8_t node[64] = {0};
+    uint8_t public_key[65] = {0};
+    unsigned int node_len = sizeof(node);
+    bool is_valid = false;
+
+    if (index & BIP32_HARDENED) {
+        data[0] = 0x00;
+        memcpy(data + 1, key, 32);
+    } else {
+        if (!native_public_key(key, public_key)) {
+            return false;
+        }
+        data[0] = 0x02 | (public_key[64] & 0x01);
+        memcpy(data + 1, public_key + 1, 32);
+    }
+    data[33] = index >> 24;
+    data[34] = index >> 16;
+    data[35] = index >> 8;
+    data[36] = index;
+
+    if (HMAC(EVP_sha512(), chain_code, 32, data, sizeof(data), node, &node_len) != NULL) {
+        BN_CTX *ctx = BN_CTX_new();
+        BIGNUM *n = BN_new();
+        BIGNUM *k = BN_bin2bn(key, 32, NULL);
+        BIGNUM *tweak = BN_bin2bn(node, 32, NULL);
+
+        BN_hex2bn(&n, "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141");
+        BN_mod_add(k, k, tweak, n, ctx);
+        BN_bn2binpad(k, key, 32);
+        memcpy(chain_code, node + 32, 32);
+        is_valid = !BN_is_zero(k);
+
+        BN_clear_free(k);
+        BN_clear_free(tweak);
+        BN_free(n);
+        BN_CTX_free(ctx);
+    }
+
+    explicit_bzero(data, sizeof(data));
+    explicit_bzero(node, sizeof(node));
+
+    return is_valid;
+}
+
+void __wrap_os_perso_derive_node_bip32(cx_curve_t curve, const unsigned int *path, unsigned int path_len, unsigned char *private_key, unsigned char *chain) {
+    uint8_t key[32] = {0};
+    uint8_t chain_code[32] = {0};
+
+    if (curve != CX_CURVE_256K1) {
+        THROW(INVALID_PARAMETER);
+    }
+
+    memcpy(key, g_master_key, sizeof(key));
+    memcpy(chain_code, g_master_chain_code, sizeof(chain_code));
+
+    for (unsigned int i = 0; i < path_len; i++) {
+        if (!native_derive_child(key, chain_code, path[i])) {
+            THROW(INVALID_PARAMETER);
+        }
+    }
+
+    if (private_key != NULL) {
+        memcpy(private_key, key, sizeof(key));
+    }
+    if (chain != NULL) {
+        memcpy(chain, chain_code, sizeof(chain_code));
+    }
+
+    explicit_bzero(key, sizeof(key));
+}
@@ -0,0 +1,90 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+/**
+ * Point decompression of crypto.c, which is built on cx_math_* primitives, checked against points computed by OpenSSL.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "crypto.h"
+#include "constants.h"
+
+#include "native.h"
+
+#define POINTS_COUNT 64
+
+static int failures = 0;
+
+static void check(bool condition, const char *name) {
+    if (!condition) {
+        fprintf(stderr, "FAIL %s\n", name);
+        failures++;
+    }
+}
+
+int main(void) {
+    uint8_t private_key[32] = {0};
+    uint8_t expected[PUBKEY_UNCOMPRESSED_LEN + 1];
+    uint8_t point[PUBKEY_UNCOMPRESSED_LEN + 1];
+    uint8_t compressed[PUBKEY_COMPRESSED_LEN];
+    uint8_t parities = 0;
+
+    // points k * G of both parities are recovered whole from their x-coordinate
+    for (uint8_t k = 1; k <= POINTS_COUNT; k++) {
+        private_key[31] = k;
+        if (!native_public_key(private_key, expected)) {
+            check(false, "native_public_key");
+            continue;
+        }
+
+        compressed[0] = 0x02 | (expected[PUBKEY_UNCOMPRESSED_LEN] & 0x01);
+        memcpy(compressed + 1, expected + 1, 32);
+        parities |= 1 << (compressed[0] & 0x01);
+
+        check(crypto_decompress_public_key(compressed, point), "decompress k * G");
+        check(memcmp(point, expected, sizeof(point)) == 0, "y of k * G");
+
+        // other prefix selects the negated point, x stays the same
+        compressed[0] ^= 0x01;
+        check(crypto_decompress_public_key(compressed, point), "decompress -k * G");
+        check(memcmp(point + 1, expected + 1, 32) == 0 && (point[PUBKEY_UNCOMPRESSED_LEN] & 0x01) == (compressed[0] & 0x01), "y of -k * G");
+    }
+    check(parities == 0x03, "both parities");
+
+    // x = 5 is not on the curve, 5^3 + 7 is not a square modulo p
+    memset(compressed, 0, sizeof(compressed));
+    compressed[32] = 5;
+    compressed[0] = 0x02;
+    check(!crypto_decompress_public_key(compressed, point), "even point not on the curve");
+    compressed[0] = 0x03;
+    check(!crypto_decompress_public_key(compressed, point), "odd point not on the curve");
+
+    // x not lower than p, prefix of uncompressed point
+    memset(compressed + 1, 0xff, 32);
+    check(!crypto_decompress_public_key(compressed, point), "x above p");
+    compressed[0] = 0x04;
+    memcpy(compressed + 1, expected + 1, 32);
+    check(!crypto_decompress_public_key(compressed, point), "uncompressed prefix");
+
+    printf("%s: %s\n", __FILE__, failures == 0 ? "ok" : "failed");
+
+    return failures == 0 ? 0 : 1;
+}
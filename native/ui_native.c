@@ -0,0 +1,188 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+/**
+ * Host replacement of src/ui: nothing is drawn, every review is answered right away by the simulated user
+ * (approve by default). Transaction fields are still decoded page by page, as the device does while reviewing.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "os.h"
+
+#include "globals.h"
+#include "io.h"
+#include "sw.h"
+#include "common/bip32.h"
+#include "transaction/field.h"
+#include "transaction/field_pager.h"
+#include "transaction/summary.h"
+#include "transaction/template_diff.h"
+#include "ui/menu.h"
+#include "ui/action/validate.h"
+#include "ui/screens/settings.h"
+#include "ui/screens/signing_progress.h"
+#include "perf.h"
+
+#include "native.h"
+
+bool G_native_approve = true;
+
+/**
+ * Decode every page of every field which would be displayed
+ */
+static void native_render_transaction(void) {
+    field_t field = {0};
+    char summary[MEMBER_SIZE(field_t, value)] = {0};
+
+    if (N_settings.summary_review_policy == SUMMARY_REVIEW_ENABLED) {
+        summary_format(summary, sizeof(summary));
+    }
+
+    field_pager_reset();
+    while (parse_field(&field, false, false)) {
+    }
+}
+
+static bool native_format_path(void) {
+    char path[60] = {0};
+
+    return bip32_path_format(G_context.bip32_path, G_context.bip32_path_len, path, sizeof(path));
+}
+
+void ui_menu_main(const ux_flow_step_t *const start_step) {
+    UNUSED(start_step);
+}
+
+void ui_display_hash_signing_disabled_warning(void) {
+}
+
+void ui_display_session_signing_disabled_warning(void) {
+}
+
+void ui_display_computing_ecdh_message(void) {
+}
+
+void ui_display_signing_progress(const char *subject) {
+    UNUSED(subject);
+}
+
+void ui_update_signing_progress(uint32_t attempts) {
+    UNUSED(attempts);
+}
+
+int ui_display_public_key(void) {
+    if (!native_format_path()) {
+        return io_send_sw(SW_WRONG_BIP32_PATH);
+    }
+
+    ui_action_validate_pubkey(G_native_approve);
+
+    return 0;
+}
+
+int ui_display_transaction(void) {
+    if (G_context.req_type != CONFIRM_TRANSACTION || G_context.state != STATE_PARSED) {
+        G_context.state = STATE_NONE;
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    if (!native_format_path()) {
+        return io_send_sw(SW_WRONG_BIP32_PATH);
+    }
+
+    PERF_STATS_REVIEW();
+    template_diff_compute();
+    native_render_transaction();
+
+    ui_action_validate_transaction(G_native_approve);
+
+    return 0;
+}
+
+int ui_display_session_transaction(void) {
+    PERF_STATS_REVIEW();
+    ui_action_validate_session_transaction(G_native_approve);
+
+    return 0;
+}
+
+int ui_display_hash(void) {
+    if (!native_format_path()) {
+        return io_send_sw(SW_WRONG_BIP32_PATH);
+    }
+
+    ui_action_validate_hash(G_native_approve);
+
+    return 0;
+}
+
+int ui_display_session_policy(void) {
+    ui_action_validate_session_policy(G_native_approve);
+
+    return 0;
+}
+
+int ui_display_message(void) {
+    if (!native_format_path()) {
+        return io_send_sw(SW_WRONG_BIP32_PATH);
+    }
+
+    ui_action_validate_message(G_native_approve);
+
+    return 0;
+}
+
+int ui_display_ecdh(void) {
+    if (!native_format_path()) {
+        return io_send_sw(SW_WRONG_BIP32_PATH);
+    }
+
+    ui_action_validate_ecdh(G_native_approve);
+
+    return 0;
+}
+
+int ui_display_memo(bool last) {
+    UNUSED(last);
+
+    ui_action_validate_memo(G_native_approve);
+
+    return 0;
+}
+
+int ui_display_account(uint32_t account_index) {
+    UNUSED(account_index);
+
+    if (G_context.req_type != CONFIRM_ACCOUNT || G_context.state != STATE_PARSED) {
+        G_context.state = STATE_NONE;
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    if (!native_format_path()) {
+        return io_send_sw(SW_WRONG_BIP32_PATH);
+    }
+
+    PERF_STATS_REVIEW();
+    native_render_transaction();
+
+    ui_action_validate_account(G_native_approve);
+
+    return 0;
+}
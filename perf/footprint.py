@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""
+Footprint report: flash and RAM used by every source module of the app (objects of obj/) and by every operation
+parser descriptor and the name pool (symbols of bin/app.elf). Run through `make footprint` after a build.
+
+Usage: footprint.py [--size arm-none-eabi-size] [--nm arm-none-eabi-nm] [--obj obj] [--elf bin/app.elf]
+                    [--report report.json] [--baseline baseline.json]
+"""
+
+import argparse
+import glob
+import json
+import os
+import subprocess
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+# Data symbols reported one by one, parsers are named <operation>_parser in src/transaction/parsers.c
+SYMBOL_SUFFIXES = ("_parser",)
+SYMBOLS = ("NAME_POOL", "operation_offsets", "G_context")
+
+
+def modules(size, objects):
+    """Berkeley sizes of object files, const data is part of text and stays in flash"""
+    report = {}
+    if not objects:
+        return report
+    output = subprocess.run([size] + objects, check=True, capture_output=True, text=True).stdout
+    for line in output.splitlines()[1:]:
+        fields = line.split()
+        text, data, bss = int(fields[0]), int(fields[1]), int(fields[2])
+        name = os.path.splitext(os.path.basename(fields[5]))[0]
+        report[name] = {"flash": text + data, "ram": data + bss}
+    return report
+
+
+def symbols(nm, elf):
+    report = {}
+    output = subprocess.run([nm, "--print-size", elf], check=True, capture_output=True, text=True).stdout
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) != 4:
+            continue
+        size, kind, name = int(fields[1], 16), fields[2], fields[3]
+        if kind in "tT":
+            continue
+        if name.endswith(SYMBOL_SUFFIXES) or name in SYMBOLS:
+            ram = kind in "bBdD"
+            report[name] = {"flash": 0 if kind in "bB" else size, "ram": size if ram else 0}
+    return report
+
+
+def total(entries):
+    return {key: sum(entry[key] for entry in entries.values()) for key in ("flash", "ram")}
+
+
+def print_section(title, entries, baseline):
+    width = max([len(title)] + [len(name) for name in entries])
+    print("%-*s %8s %8s" % (width, title, "flash", "ram"))
+    for name in sorted(entries, key=lambda name: (-entries[name]["flash"], name)):
+        entry = entries[name]
+        reference = baseline.get(name)
+        delta = ""
+        if reference is not None and reference != entry:
+            delta = "  (%+d flash, %+d ram)" % (entry["flash"] - reference["flash"], entry["ram"] - reference["ram"])
+        elif baseline and reference is None:
+            delta = "  (new)"
+        print("%-*s %8d %8d%s" % (width, name, entry["flash"], entry["ram"], delta))
+    summary = total(entries)
+    print("%-*s %8d %8d\n" % (width, "total", summary["flash"], summary["ram"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Report flash and RAM footprint per module and per parser")
+    parser.add_argument("--size", default="arm-none-eabi-size")
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    parser.add_argument("--obj", default=os.path.join(ROOT, "obj"))
+    parser.add_argument("--elf", default=os.path.join(ROOT, "bin", "app.elf"))
+    parser.add_argument("--report", help="write report as JSON")
+    parser.add_argument("--baseline", help="JSON report to show differences against")
+    options = parser.parse_args()
+
+    report = {
+        "modules": modules(options.size, sorted(glob.glob(os.path.join(options.obj, "*.o")))),
+        "symbols": symbols(options.nm, options.elf),
+    }
+
+    baseline = {}
+    if options.baseline:
+        with open(options.baseline) as f:
+            baseline = json.load(f)
+
+    print_section("module", report["modules"], baseline.get("modules", {}))
+    print_section("symbol", report["symbols"], baseline.get("symbols", {}))
+
+    if options.report:
+        with open(options.report, "w") as f:
+            json.dump(report, f, indent=2, sort_keys=True)
+            f.write("\n")
+
+
+if __name__ == "__main__":
+    main()
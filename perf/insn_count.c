@@ -0,0 +1,153 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+/**
+ * QEMU TCG plugin counting instructions retired between phase markers of an app built with PERF_MARKERS=1.
+ *
+ * Every executed instruction increments a counter. When `perf_marker(phase, begin)` is entered, phase and begin
+ * are read from r0 and r1; at the end of a phase a line `<phase> <instructions>` is appended to the output file.
+ *
+ *   -plugin libinsn_count.so,marker=0xc0d01234,output=phases.txt
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <glib.h>
+#include <qemu-plugin.h>
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define MAX_PHASES 32
+
+static uint64_t marker_address;
+static FILE *output;
+static struct qemu_plugin_scoreboard *counters;
+static qemu_plugin_u64 instructions;
+static struct qemu_plugin_register *reg_phase;
+static struct qemu_plugin_register *reg_begin;
+static GByteArray *reg_value;
+static uint64_t phase_start[MAX_PHASES];
+static bool phase_open[MAX_PHASES];
+
+static uint32_t read_register(struct qemu_plugin_register *reg) {
+    uint32_t value = 0;
+
+    g_byte_array_set_size(reg_value, 0);
+    if (qemu_plugin_read_register(reg, reg_value) >= (int) sizeof(value)) {
+        // target is little endian
+        value = (uint32_t) reg_value->data[0] | (uint32_t) reg_value->data[1] << 8 | (uint32_t) reg_value->data[2] << 16 |
+                (uint32_t) reg_value->data[3] << 24;
+    }
+
+    return value;
+}
+
+static void vcpu_init(qemu_plugin_id_t id, unsigned int vcpu_index) {
+    GArray *registers = qemu_plugin_get_registers();
+
+    for (guint i = 0; i < registers->len; i++) {
+        qemu_plugin_reg_descriptor *descriptor = &g_array_index(registers, qemu_plugin_reg_descriptor, i);
+        if (strcmp(descriptor->name, "r0") == 0) {
+            reg_phase = descriptor->handle;
+        } else if (strcmp(descriptor->name, "r1") == 0) {
+            reg_begin = descriptor->handle;
+        }
+    }
+
+    g_array_free(registers, TRUE);
+}
+
+static void marker_exec(unsigned int vcpu_index, void *userdata) {
+    const uint64_t now = qemu_plugin_u64_get(instructions, vcpu_index);
+    const uint32_t phase = read_register(reg_phase);
+    const bool begin = (read_register(reg_begin) & 0xFF) != 0;
+
+    if (phase >= MAX_PHASES) {
+        return;
+    }
+
+    if (begin) {
+        phase_start[phase] = now;
+        phase_open[phase] = true;
+    } else if (phase_open[phase]) {
+        // phases left through an error path are never closed and simply restarted
+        fprintf(output, "%" PRIu32 " %" PRIu64 "\n", phase, now - phase_start[phase]);
+        fflush(output);
+        phase_open[phase] = false;
+    }
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb) {
+    const size_t count = qemu_plugin_tb_n_insns(tb);
+
+    for (size_t i = 0; i < count; i++) {
+        struct qemu_plugin_insn *insn = qemu_plugin_tb_get_insn(tb, i);
+
+        qemu_plugin_register_vcpu_insn_exec_inline_per_vcpu(insn, QEMU_PLUGIN_INLINE_ADD_U64, instructions, 1);
+
+        if (qemu_plugin_insn_vaddr(insn) == marker_address) {
+            qemu_plugin_register_vcpu_insn_exec_cb(insn, marker_exec, QEMU_PLUGIN_CB_R_REGS, NULL);
+        }
+    }
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *userdata) {
+    fclose(output);
+    qemu_plugin_scoreboard_free(counters);
+    g_byte_array_free(reg_value, TRUE);
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id, const qemu_info_t *info, int argc, char **argv) {
+    const char *path = NULL;
+
+    for (int i = 0; i < argc; i++) {
+        if (g_str_has_prefix(argv[i], "marker=")) {
+            // Thumb bit of the symbol value is not part of the instruction address
+            marker_address = g_ascii_strtoull(argv[i] + strlen("marker="), NULL, 0) & ~1ULL;
+        } else if (g_str_has_prefix(argv[i], "output=")) {
+            path = argv[i] + strlen("output=");
+        } else {
+            fprintf(stderr, "insn_count: unknown argument %s\n", argv[i]);
+            return -1;
+        }
+    }
+
+    if (marker_address == 0 || path == NULL) {
+        fprintf(stderr, "insn_count: marker and output arguments are required\n");
+        return -1;
+    }
+
+    output = fopen(path, "w");
+    if (output == NULL) {
+        perror("insn_count");
+        return -1;
+    }
+
+    counters = qemu_plugin_scoreboard_new(sizeof(uint64_t));
+    instructions = qemu_plugin_scoreboard_u64(counters);
+    reg_value = g_byte_array_new();
+
+    qemu_plugin_register_vcpu_init_cb(id, vcpu_init);
+    qemu_plugin_register_vcpu_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+
+    return 0;
+}
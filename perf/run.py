@@ -0,0 +1,254 @@
+#!/usr/bin/env python3
+"""
+Instruction counting suite: sign every functional test transaction (test/transactions/*.json) in Speculos with the
+QEMU plugin of this directory loaded, and report instructions retired in each phase of the signing flow. The app has
+to be built with phase markers (`make PERF_MARKERS=1`).
+
+Usage: run.py --qemu QEMU_ARM --plugin libinsn_count.so [--elf bin/app.elf] [--speculos speculos.py] [--model nanos]
+              [--nm arm-none-eabi-nm] [--report report.json] [--baseline baseline.json] [--update-baseline]
+              [--threshold 1] [TRANSACTION.json...]
+"""
+
+import argparse
+import glob
+import json
+import os
+import socket
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+import urllib.request
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "bench"))
+import transactions  # noqa: E402
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+MNEMONIC = ("salon stock memory business develop elegant chronic kite aspect nothing tone essay huge knock flip bar noise "
+            "main cloth coin flavor only melody gain")
+
+# perf_phase_e of src/perf.h
+PHASES = {
+    1: "chunk_receive",
+    2: "transaction_parse",
+    3: "review_step",
+    4: "hash_final",
+    5: "sign_digest",
+    6: "sign_attempt",
+}
+
+CLA = 0xD4
+INS_SIGN_TRANSACTION = 0x04
+MAX_CHUNK_LEN = 250  # whole APDU including 5 bytes header must fit MAX_APDU_LEN
+MAX_REVIEW_SCREENS = 500
+
+
+def marker_address(nm, elf):
+    symbols = subprocess.run([nm, elf], check=True, capture_output=True, text=True).stdout
+    for line in symbols.splitlines():
+        fields = line.split()
+        if len(fields) == 3 and fields[2] == "perf_marker":
+            return int(fields[0], 16)
+    raise RuntimeError("perf_marker not found in %s, build the app with PERF_MARKERS=1" % elf)
+
+
+def qemu_wrapper(directory, qemu, plugin, marker, output):
+    """Speculos runs qemu-arm-static from PATH, shadow it with a wrapper loading the plugin"""
+    path = os.path.join(directory, "qemu-arm-static")
+    with open(path, "w") as f:
+        f.write('#!/bin/sh\nexec "%s" -plugin "%s,marker=0x%x,output=%s" "$@"\n' % (qemu, plugin, marker, output))
+    os.chmod(path, 0o755)
+
+
+class Speculos:
+    def __init__(self, options, path):
+        env = dict(os.environ, PATH=path + os.pathsep + os.environ["PATH"])
+        command = [options.speculos, options.elf, "--model", options.model, "--display", "headless", "--apdu-port",
+                   str(options.apdu_port), "--api-port", str(options.api_port), "--seed", MNEMONIC]
+        self.api = "http://127.0.0.1:%d" % options.api_port
+        self.process = subprocess.Popen(command, env=env, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        self.socket = self.connect(options.apdu_port)
+
+    def connect(self, port, timeout=60):
+        deadline = time.time() + timeout
+        while True:
+            try:
+                return socket.create_connection(("127.0.0.1", port))
+            except OSError:
+                if time.time() > deadline or self.process.poll() is not None:
+                    raise RuntimeError("Speculos did not start")
+                time.sleep(0.5)
+
+    def send(self, apdu):
+        self.socket.sendall(struct.pack(">I", len(apdu)) + apdu)
+
+    def receive(self):
+        length = struct.unpack(">I", self.read(4))[0]
+        response = self.read(length + 2)
+        return response[:-2], struct.unpack(">H", response[-2:])[0]
+
+    def read(self, length):
+        data = b""
+        while len(data) < length:
+            chunk = self.socket.recv(length - len(data))
+            if not chunk:
+                raise RuntimeError("Speculos closed the connection")
+            data += chunk
+        return data
+
+    def request(self, method, endpoint, body=None):
+        data = json.dumps(body).encode() if body is not None else None
+        request = urllib.request.Request(self.api + endpoint, data=data, method=method, headers={"Content-Type": "application/json"})
+        with urllib.request.urlopen(request) as response:
+            return json.loads(response.read() or b"{}")
+
+    def press(self, button):
+        self.request("DELETE", "/events")
+        self.request("POST", "/button/%s" % button, {"action": "press-and-release"})
+        return self.screen()
+
+    def screen(self, timeout=10):
+        deadline = time.time() + timeout
+        while time.time() < deadline:
+            events = self.request("GET", "/events?currentscreenonly=true").get("events", [])
+            if events:
+                return [event["text"] for event in events]
+            time.sleep(0.05)
+        raise RuntimeError("screen did not change")
+
+    def close(self):
+        self.socket.close()
+        self.process.terminate()
+        self.process.wait()
+
+
+def sign(speculos, payload):
+    """Send transaction, browse every review screen and approve it"""
+    chunks = [payload[i:i + MAX_CHUNK_LEN] for i in range(0, len(payload), MAX_CHUNK_LEN)]
+    for index, chunk in enumerate(chunks):
+        p1 = 0x00 if index == 0 else 0x80
+        p2 = 0x80 if index + 1 < len(chunks) else 0x00
+        if p2 == 0x00:
+            speculos.request("DELETE", "/events")
+        speculos.send(bytes([CLA, INS_SIGN_TRANSACTION, p1, p2, len(chunk)]) + chunk)
+        if p2 == 0x80:
+            _, sw = speculos.receive()
+            if sw != 0x9000:
+                raise RuntimeError("chunk rejected with %04x" % sw)
+
+    screen = speculos.screen()
+    for _ in range(MAX_REVIEW_SCREENS):
+        if "Approve" in screen:
+            break
+        screen = speculos.press("right")
+    else:
+        raise RuntimeError("approve screen not reached")
+    speculos.press("both")
+
+    _, sw = speculos.receive()
+    if sw != 0x9000:
+        raise RuntimeError("signing failed with %04x" % sw)
+
+
+def collect(output, position):
+    """Sum instructions and occurrences of each phase appended to plugin output since position"""
+    phases = {}
+    with open(output) as f:
+        f.seek(position)
+        lines = f.read().splitlines()
+        position = f.tell()
+    for line in lines:
+        phase, instructions = line.split()
+        name = PHASES.get(int(phase), "phase_%s" % phase)
+        entry = phases.setdefault(name, {"count": 0, "instructions": 0})
+        entry["count"] += 1
+        entry["instructions"] += int(instructions)
+    return phases, position
+
+
+def regressions(report, baseline, threshold):
+    """Instruction counts are deterministic, any growth beyond threshold percent is reported"""
+    failures = []
+    for name, phases in report.items():
+        for phase, entry in phases.items():
+            reference = baseline.get(name, {}).get(phase)
+            if reference is None:
+                continue
+            if entry["instructions"] > reference["instructions"] * (1 + threshold / 100):
+                failures.append("%s %s: %d instructions, baseline %d" % (name, phase, entry["instructions"], reference["instructions"]))
+            if entry["count"] != reference["count"]:
+                print("%s %s: %d occurrences, baseline %d" % (name, phase, entry["count"], reference["count"]))
+    return failures
+
+
+def print_table(report):
+    columns = list(PHASES.values())
+    width = max([len("transaction")] + [len(name) for name in report])
+    print("%-*s %s" % (width, "transaction", " ".join("%17s" % column for column in columns)))
+    for name, phases in report.items():
+        cells = []
+        for column in columns:
+            entry = phases.get(column)
+            cells.append("%17s" % ("%d (%d)" % (entry["instructions"], entry["count"]) if entry else "-"))
+        print("%-*s %s" % (width, name, " ".join(cells)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Count instructions of signing flows in Speculos")
+    parser.add_argument("--qemu", required=True, help="qemu-arm built with plugin support (QEMU >= 9.0)")
+    parser.add_argument("--plugin", required=True, help="path to libinsn_count.so")
+    parser.add_argument("--elf", default=os.path.join(ROOT, "bin", "app.elf"))
+    parser.add_argument("--speculos", default="speculos")
+    parser.add_argument("--model", default="nanos")
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    parser.add_argument("--apdu-port", type=int, default=40000)
+    parser.add_argument("--api-port", type=int, default=5000)
+    parser.add_argument("--report")
+    parser.add_argument("--baseline")
+    parser.add_argument("--update-baseline", action="store_true", help="write results to --baseline instead of comparing")
+    parser.add_argument("--threshold", type=float, default=1.0, help="allowed growth in percent")
+    parser.add_argument("transactions", nargs="*")
+    options = parser.parse_args()
+
+    sources = sorted(options.transactions or glob.glob(os.path.join(ROOT, "test", "transactions", "*.json")))
+    marker = marker_address(options.nm, options.elf)
+    report = {}
+
+    with tempfile.TemporaryDirectory() as directory:
+        output = os.path.join(directory, "phases.txt")
+        qemu_wrapper(directory, os.path.abspath(options.qemu), os.path.abspath(options.plugin), marker, output)
+        speculos = Speculos(options, directory)
+        position = 0
+        try:
+            for source in sources:
+                with open(source) as f:
+                    payload, _ = transactions.transaction(json.load(f))
+                sign(speculos, payload)
+                name = os.path.splitext(os.path.basename(source))[0]
+                report[name], position = collect(output, position)
+        finally:
+            speculos.close()
+
+    print_table(report)
+
+    if options.report:
+        with open(options.report, "w") as f:
+            json.dump(report, f, indent=2, sort_keys=True)
+            f.write("\n")
+
+    if options.baseline and options.update_baseline:
+        with open(options.baseline, "w") as f:
+            json.dump(report, f, indent=2, sort_keys=True)
+            f.write("\n")
+    elif options.baseline:
+        with open(options.baseline) as f:
+            failures = regressions(report, json.load(f), options.threshold)
+        for failure in failures:
+            print(failure, file=sys.stderr)
+        if failures:
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -24,6 +24,7 @@
 #include "globals.h"
 #include "types.h"
 #include "io.h"
+#include "response.h"
 #include "sw.h"
 #include "common/buffer.h"
 #include "handler/get_version.h"
@@ -32,8 +33,22 @@
 #include "handler/get_settings.h"
 #include "handler/sign_tx.h"
 #include "handler/sign_hash.h"
+#include "handler/set_session_policy.h"
+#include "handler/sign_message.h"
+#include "handler/get_ecdh_secrets.h"
+#include "handler/decrypt_memo.h"
+#include "handler/get_perf_stats.h"
+#include "handler/get_last_signature.h"
+#include "handler/preview_tx.h"
+#include "handler/create_account.h"
+#include "handler/set_key_index.h"
 
 int apdu_dispatcher(const command_t *cmd) {
+    // chained response is abandoned by any other command
+    if (cmd->ins != GET_RESPONSE) {
+        response_cancel();
+    }
+
     if (cmd->cla != CLA) {
         return io_send_sw(SW_CLA_NOT_SUPPORTED);
     }
@@ -101,6 +116,136 @@ int apdu_dispatcher(const command_t *cmd) {
             }
 
             return handler_get_settings();
+
+        case SET_SESSION_POLICY:
+            if (cmd->p1 > P1_SESSION_POLICY_CLEAR || cmd->p2 != 0) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            if (cmd->p1 == P1_SESSION_POLICY_SET && !cmd->data) {
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+            }
+
+            buf.ptr = cmd->data;
+            buf.size = cmd->lc;
+            buf.offset = 0;
+
+            return handler_set_session_policy(&buf, cmd->p1 == P1_SESSION_POLICY_CLEAR);
+
+        case SIGN_MESSAGE:
+            if ((cmd->p1 != P1_FIRST_CHUNK && cmd->p1 != P1_SUBSEQUENT_CHUNK) || (cmd->p2 != P2_LAST && cmd->p2 != P2_MORE)) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            if (!cmd->data) {
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+            }
+
+            buf.ptr = cmd->data;
+            buf.size = cmd->lc;
+            buf.offset = 0;
+
+            return handler_sign_message(&buf, cmd->p1, (bool) (cmd->p2 & P2_MORE));
+
+        case GET_ECDH_SECRETS:
+            if (cmd->p1 != 0 || cmd->p2 != 0) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            if (!cmd->data) {
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+            }
+
+            buf.ptr = cmd->data;
+            buf.size = cmd->lc;
+            buf.offset = 0;
+
+            return handler_get_ecdh_secrets(&buf);
+
+        case DECRYPT_MEMO:
+            if ((cmd->p1 != P1_FIRST_CHUNK && cmd->p1 != P1_SUBSEQUENT_CHUNK) || (cmd->p2 != P2_LAST && cmd->p2 != P2_MORE)) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            if (!cmd->data) {
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+            }
+
+            buf.ptr = cmd->data;
+            buf.size = cmd->lc;
+            buf.offset = 0;
+
+            return handler_decrypt_memo(&buf, cmd->p1, (bool) (cmd->p2 & P2_MORE));
+        case GET_LAST_SIGNATURE:
+            if (cmd->p1 != 0 || cmd->p2 != 0) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            if (!cmd->data) {
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+            }
+
+            buf.ptr = cmd->data;
+            buf.size = cmd->lc;
+            buf.offset = 0;
+
+            return handler_get_last_signature(&buf);
+        case PREVIEW_TRANSACTION:
+            if ((cmd->p1 != P1_FIRST_CHUNK && cmd->p1 != P1_SUBSEQUENT_CHUNK) || (cmd->p2 != P2_LAST && cmd->p2 != P2_MORE)) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            if (!cmd->data) {
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+            }
+
+            buf.ptr = cmd->data;
+            buf.size = cmd->lc;
+            buf.offset = 0;
+
+            return handler_preview_tx(&buf, cmd->p1, (bool) (cmd->p2 & P2_MORE));
+        case CREATE_ACCOUNT:
+            if (cmd->p1 != 0 || cmd->p2 != 0) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            if (!cmd->data) {
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+            }
+
+            buf.ptr = cmd->data;
+            buf.size = cmd->lc;
+            buf.offset = 0;
+
+            return handler_create_account(&buf);
+        case SET_KEY_INDEX:
+            if (cmd->p1 > P1_KEY_INDEX_RESET || cmd->p2 != 0) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            if (cmd->p1 == P1_KEY_INDEX_SET && !cmd->data) {
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+            }
+
+            buf.ptr = cmd->data;
+            buf.size = cmd->lc;
+            buf.offset = 0;
+
+            return handler_set_key_index(&buf, cmd->p1 == P1_KEY_INDEX_RESET);
+        case GET_RESPONSE:
+            if (cmd->p1 != 0 || cmd->p2 != 0) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            return response_send_next_part();
+#ifdef HAVE_PERF_STATS
+        case GET_PERF_STATS:
+            if (cmd->p1 != 0 || cmd->p2 != 0) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            return handler_get_perf_stats();
+#endif
         default:
             return io_send_sw(SW_INS_NOT_SUPPORTED);
     }
@@ -117,6 +117,33 @@ bool buffer_read_u64(buffer_t *buffer, uint64_t *value, endianness_t endianness)
     return true;
 }
 
+bool buffer_read_varint(buffer_t *buffer, uint32_t *value) {
+    uint32_t result = 0;
+
+    // 32-bit value is encoded on at most 5 bytes
+    for (size_t i = 0; i < 5; i++) {
+        if (!buffer_can_read(buffer, 1 + i)) {
+            break;
+        }
+
+        uint8_t byte = buffer->ptr[buffer->offset + i];
+        result |= (uint32_t) (byte & 0x7f) << (7 * i);
+
+        if ((byte & 0x80) == 0) {
+            if (i == 4 && byte > 0x0f) {
+                break;
+            }
+            *value = result;
+            buffer_seek_cur(buffer, 1 + i);
+            return true;
+        }
+    }
+
+    *value = 0;
+
+    return false;
+}
+
 bool buffer_read_bip32_path(buffer_t *buffer, uint32_t *out, size_t out_len) {
     if (!bip32_path_read(buffer->ptr + buffer->offset, buffer->size - buffer->offset, out, out_len)) {
         return false;
@@ -158,7 +185,7 @@ bool buffer_copy(const buffer_t *buffer, uint8_t *out, size_t out_len) {
     return true;
 }
 
-bool buffer_copy_partial(const buffer_t *buffer, uint8_t *out, size_t out_len, uint8_t length) {
+bool buffer_copy_partial(const buffer_t *buffer, uint8_t *out, size_t out_len, size_t length) {
     if (length > out_len || buffer->size - buffer->offset < length) {
         return false;
     }
@@ -177,7 +204,7 @@ bool buffer_move(buffer_t *buffer, uint8_t *out, size_t out_len) {
     return true;
 }
 
-bool buffer_move_partial(buffer_t *buffer, uint8_t *out, size_t out_len, uint8_t length) {
+bool buffer_move_partial(buffer_t *buffer, uint8_t *out, size_t out_len, size_t length) {
     if (!buffer_copy_partial(buffer, out, out_len, length)) {
         return false;
     }
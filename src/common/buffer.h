@@ -131,6 +131,19 @@ bool buffer_read_u32(buffer_t *buffer, uint32_t *value, endianness_t endianness)
  */
 bool buffer_read_u64(buffer_t *buffer, uint64_t *value, endianness_t endianness);
 
+/**
+ * Read unsigned LEB128 variable length integer (as used by Hive serialization) from buffer.
+ *
+ * @param[in,out]  buffer
+ *   Pointer to input buffer struct.
+ * @param[out]     value
+ *   Pointer to 32-bit unsigned integer read from buffer.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool buffer_read_varint(buffer_t *buffer, uint32_t *value);
+
 /**
  * Read BIP32 path from buffer.
  *
@@ -176,7 +189,7 @@ bool buffer_copy(const buffer_t *buffer, uint8_t *out, size_t out_len);
  * @return true if success, false otherwise.
  *
  */
-bool buffer_copy_partial(const buffer_t *buffer, uint8_t *out, size_t out_len, uint8_t length);
+bool buffer_copy_partial(const buffer_t *buffer, uint8_t *out, size_t out_len, size_t length);
 
 /**
  * Move bytes from buffer.
@@ -207,7 +220,7 @@ bool buffer_move(buffer_t *buffer, uint8_t *out, size_t out_len);
  * @return true if success, false otherwise.
  *
  */
-bool buffer_move_partial(buffer_t *buffer, uint8_t *out, size_t out_len, uint8_t length);
+bool buffer_move_partial(buffer_t *buffer, uint8_t *out, size_t out_len, size_t length);
 
 /**
  * Read TLV (Type–length–value) field endoded using asn1 DER standard
@@ -143,7 +143,9 @@ bool format_u64(const uint64_t i, char *out, uint8_t out_len) {
 }
 
 static bool insert_string(char *out, uint8_t out_len, const char *source, size_t position) {
-    if (strlen(source) + position > out_len - 1) {  // need space for null character
+    size_t out_length = strlen(out);
+
+    if (position > out_length || out_length + strlen(source) > (size_t) out_len - 1) {  // need space for null character
         return false;
     }
 
@@ -185,6 +187,9 @@ bool format_asset(asset_t *asset, char *out, size_t out_len) {
     // Because we're fork of Steem blockchain, our backend nodes require Steem assets during the serialization, but we want to display Hive assets for ledger
     // users. Here, we check the second character to determine asset.
     const char *symbol_ptr = NULL;
+    char symbol[sizeof(symbol_t) + 1] = {0};  // serialized symbol is not null terminated when all 7 characters are used
+
+    memcpy(symbol, asset->symbol, sizeof(symbol_t));
 
     if (memcmp(asset->symbol, "STEEM", strlen("STEEM")) == 0) {
         symbol_ptr = HIVE_ASSETS[0];
@@ -192,7 +197,7 @@ bool format_asset(asset_t *asset, char *out, size_t out_len) {
         symbol_ptr = HIVE_ASSETS[1];
     }
 
-    if (!insert_string(out, out_len, symbol_ptr ? symbol_ptr : asset->symbol, strlen(out))) {
+    if (!insert_string(out, out_len, symbol_ptr ? symbol_ptr : symbol, strlen(out))) {
         return false;
     }
 
@@ -0,0 +1,319 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <string.h>
+
+#include "common/json.h"
+
+typedef enum {
+    PATH_MATCH_NONE = 0,  /// path selects neither the value nor anything inside it
+    PATH_MATCH_PREFIX,    /// path selects a value nested in the value
+    PATH_MATCH_EXACT,     /// path selects the value
+} path_match_e;
+
+/* Position of a value in its container, member name or array index */
+typedef struct {
+    const char *key;
+    size_t key_length;
+    uint16_t index;
+} segment_t;
+
+void json_init(json_t *json, const char *ptr, size_t size) {
+    memset(json, 0, sizeof(*json));
+    json->ptr = ptr;
+    json->size = size;
+    json->state = JSON_STATE_VALUE;
+}
+
+static void skip_whitespace(json_t *json) {
+    while (json->offset < json->size) {
+        char c = json->ptr[json->offset];
+
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+            break;
+        }
+        json->offset++;
+    }
+}
+
+/**
+ * Read string starting at the opening quote, escape sequences are skipped but not decoded
+ */
+static bool read_string(json_t *json, const char **ptr, size_t *length) {
+    size_t start = ++json->offset;
+
+    while (json->offset < json->size) {
+        char c = json->ptr[json->offset];
+
+        if (c == '"') {
+            *ptr = json->ptr + start;
+            *length = json->offset - start;
+            json->offset++;
+            return true;
+        }
+        if ((uint8_t) c < 0x20) {
+            // control characters have to be escaped
+            return false;
+        }
+        json->offset += (c == '\\') ? 2 : 1;
+    }
+
+    return false;
+}
+
+static bool is_primitive_char(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || c == 'E' || c == '.' || c == '+' || c == '-';
+}
+
+/**
+ * Check if characters of the token form a literal or a number
+ */
+static bool is_primitive(const json_token_t *token) {
+    if (json_token_equal(token, "true") || json_token_equal(token, "false") || json_token_equal(token, "null")) {
+        return true;
+    }
+    if (token->length == 0 || !((token->ptr[0] >= '0' && token->ptr[0] <= '9') || token->ptr[0] == '-')) {
+        return false;
+    }
+    for (size_t i = 0; i < token->length; i++) {
+        char c = token->ptr[i];
+
+        if (!((c >= '0' && c <= '9') || c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-')) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool read_value(json_t *json, json_token_t *token) {
+    if (json->offset >= json->size) {
+        return false;
+    }
+
+    char c = json->ptr[json->offset];
+    token->ptr = json->ptr + json->offset;
+    token->depth = json->depth;
+
+    if (c == '{' || c == '[') {
+        if (json->depth == JSON_MAX_DEPTH) {
+            return false;
+        }
+        if (c == '{') {
+            json->objects |= 1u << json->depth;
+        }
+        token->type = (c == '{') ? JSON_TOKEN_OBJECT : JSON_TOKEN_ARRAY;
+        token->length = 1;
+        json->counts[json->depth] = 0;
+        json->depth++;
+        json->offset++;
+        json->state = JSON_STATE_FIRST;
+        return true;
+    }
+
+    if (c == '"') {
+        token->type = JSON_TOKEN_STRING;
+        if (!read_string(json, &token->ptr, &token->length)) {
+            return false;
+        }
+    } else {
+        size_t start = json->offset;
+
+        while (json->offset < json->size && is_primitive_char(json->ptr[json->offset])) {
+            json->offset++;
+        }
+        token->type = JSON_TOKEN_PRIMITIVE;
+        token->length = json->offset - start;
+        if (!is_primitive(token)) {
+            return false;
+        }
+    }
+
+    json->state = (json->depth == 0) ? JSON_STATE_DONE : JSON_STATE_NEXT;
+    return true;
+}
+
+bool json_next(json_t *json, json_token_t *token) {
+    memset(token, 0, sizeof(*token));
+    skip_whitespace(json);
+
+    if (json->state == JSON_STATE_DONE) {
+        // nothing but whitespace may follow the root value
+        return json->offset == json->size;
+    }
+
+    if (json->offset >= json->size) {
+        return false;
+    }
+
+    if (json->state != JSON_STATE_VALUE) {
+        bool object = (json->objects & (1u << (json->depth - 1))) != 0;
+        char c = json->ptr[json->offset];
+
+        if (c == (object ? '}' : ']')) {
+            json->offset++;
+            json->depth--;
+            json->objects &= ~(1u << json->depth);
+            json->state = (json->depth == 0) ? JSON_STATE_DONE : JSON_STATE_NEXT;
+
+            token->type = JSON_TOKEN_END;
+            token->ptr = json->ptr + json->offset - 1;
+            token->length = 1;
+            token->depth = json->depth;
+            return true;
+        }
+
+        if (json->state == JSON_STATE_NEXT) {
+            if (c != ',') {
+                return false;
+            }
+            json->offset++;
+            skip_whitespace(json);
+        }
+
+        if (object) {
+            if (json->offset >= json->size || json->ptr[json->offset] != '"' || !read_string(json, &token->key, &token->key_length)) {
+                return false;
+            }
+            skip_whitespace(json);
+            if (json->offset >= json->size || json->ptr[json->offset] != ':') {
+                return false;
+            }
+            json->offset++;
+            skip_whitespace(json);
+        }
+
+        token->index = json->counts[json->depth - 1]++;
+    }
+
+    return read_value(json, token);
+}
+
+bool json_token_equal(const json_token_t *token, const char *str) {
+    size_t length = strlen(str);
+
+    return token->length == length && memcmp(token->ptr, str, length) == 0;
+}
+
+static bool segment_equal(const segment_t *segment, const char *path, size_t length) {
+    if (segment->key != NULL) {
+        return segment->key_length == length && memcmp(segment->key, path, length) == 0;
+    }
+
+    // array index written in decimal
+    uint32_t index = 0;
+    for (size_t i = 0; i < length; i++) {
+        if (path[i] < '0' || path[i] > '9' || index > UINT16_MAX) {
+            return false;
+        }
+        index = index * 10 + (uint32_t) (path[i] - '0');
+    }
+
+    return length > 0 && index == segment->index;
+}
+
+static path_match_e match_path(const char *path, const segment_t *segments, uint8_t depth) {
+    const char *segment = (*path == '\0') ? NULL : path;
+
+    for (uint8_t i = 0; i < depth; i++) {
+        if (segment == NULL) {
+            // path is shorter than position of the value
+            return PATH_MATCH_NONE;
+        }
+
+        const char *end = strchr(segment, '.');
+        size_t length = (end != NULL) ? (size_t) (end - segment) : strlen(segment);
+
+        if (!segment_equal(&segments[i], segment, length)) {
+            return PATH_MATCH_NONE;
+        }
+        segment = (end != NULL) ? end + 1 : NULL;
+    }
+
+    return (segment == NULL) ? PATH_MATCH_EXACT : PATH_MATCH_PREFIX;
+}
+
+/**
+ * Read tokens up to the end of container at given depth
+ */
+static bool skip_container(json_t *json, uint8_t depth, json_token_t *end) {
+    do {
+        if (!json_next(json, end) || end->type == JSON_TOKEN_NONE) {
+            return false;
+        }
+    } while (end->type != JSON_TOKEN_END || end->depth != depth);
+
+    return true;
+}
+
+bool json_find(const char *ptr, size_t size, const char *const *paths, uint8_t count, json_token_t *values) {
+    segment_t segments[JSON_MAX_DEPTH];
+    json_token_t token, end;
+    json_t json;
+
+    memset(values, 0, count * sizeof(json_token_t));
+    json_init(&json, ptr, size);
+
+    while (true) {
+        if (!json_next(&json, &token)) {
+            return false;
+        }
+        if (token.type == JSON_TOKEN_NONE) {
+            return true;
+        }
+        if (token.type == JSON_TOKEN_END) {
+            // end of a container enclosing selected values
+            continue;
+        }
+
+        if (token.depth > 0) {
+            segments[token.depth - 1] = (segment_t){.key = token.key, .key_length = token.key_length, .index = token.index};
+        }
+
+        bool selected = false, enclosing = false;
+        for (uint8_t i = 0; i < count; i++) {
+            path_match_e match = match_path(paths[i], segments, token.depth);
+
+            if (match == PATH_MATCH_EXACT) {
+                if (values[i].type != JSON_TOKEN_NONE) {
+                    // duplicated member, it is not obvious which one would be used
+                    return false;
+                }
+                values[i] = token;
+                selected = true;
+            } else if (match == PATH_MATCH_PREFIX) {
+                enclosing = true;
+            }
+        }
+
+        bool container = token.type == JSON_TOKEN_OBJECT || token.type == JSON_TOKEN_ARRAY;
+        if (selected && container) {
+            // selected container is returned whole, values inside it are not looked at
+            if (!skip_container(&json, token.depth, &end)) {
+                return false;
+            }
+            for (uint8_t i = 0; i < count; i++) {
+                if (values[i].ptr == token.ptr && values[i].type == token.type) {
+                    values[i].length = (size_t) (end.ptr - token.ptr) + 1;
+                }
+            }
+        } else if (!selected && !(enclosing && container)) {
+            // value which would not be displayed
+            return false;
+        }
+    }
+}
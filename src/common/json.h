@@ -0,0 +1,103 @@
+#pragma once
+
+#include <stddef.h>   // size_t
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+
+// Deepest nesting of objects and arrays accepted by the tokenizer, it bounds the stack used by json_find
+#define JSON_MAX_DEPTH 8
+
+typedef enum {
+    JSON_TOKEN_NONE = 0,   /// end of document, or value not found
+    JSON_TOKEN_OBJECT,     /// '{', or whole object returned by json_find
+    JSON_TOKEN_ARRAY,      /// '[', or whole array returned by json_find
+    JSON_TOKEN_END,        /// '}' or ']'
+    JSON_TOKEN_STRING,     /// characters between quotes, escape sequences are kept as they are
+    JSON_TOKEN_PRIMITIVE,  /// number, true, false or null
+} json_token_type_e;
+
+typedef struct {
+    const char *ptr;  /// first character of the token in the document
+    size_t length;    /// number of characters of the token
+    const char *key;  /// member name (without quotes) when the token is a value of an object member, NULL otherwise
+    size_t key_length;
+    uint16_t index;  /// element index when the token is a value of an array
+    uint8_t type;    /// json_token_type_e
+    uint8_t depth;   /// number of containers enclosing the token, containers and their END share the depth
+} json_token_t;
+
+typedef enum {
+    JSON_STATE_VALUE = 0,  /// root value expected
+    JSON_STATE_FIRST,      /// first element or end of container expected
+    JSON_STATE_NEXT,       /// separator or end of container expected
+    JSON_STATE_DONE,       /// root value read, only whitespace may follow
+} json_state_e;
+
+/**
+ * Pull tokenizer reading the document in place, no token or character is copied
+ */
+typedef struct {
+    const char *ptr;
+    size_t size;
+    size_t offset;
+    uint8_t state;                    /// json_state_e
+    uint8_t depth;                    /// number of open containers
+    uint8_t objects;                  /// bit N set when the container at depth N + 1 is an object
+    uint16_t counts[JSON_MAX_DEPTH];  /// number of elements read in every open container
+} json_t;
+
+/**
+ * Start tokenizing a document
+ *
+ * @param[out] json
+ *  Pointer to the tokenizer
+ * @param[in] ptr
+ *  Pointer to the document, it has to outlive the tokenizer and the tokens
+ * @param[in] size
+ *  Length of the document
+ */
+void json_init(json_t *json, const char *ptr, size_t size);
+
+/**
+ * Read next token of the document. JSON_TOKEN_NONE is returned once the whole document is read.
+ *
+ * @param[in,out] json
+ *  Pointer to the tokenizer
+ * @param[out] token
+ *  Pointer to the token
+ * @return true if success, false if the document is malformed or nested deeper than JSON_MAX_DEPTH
+ */
+bool json_next(json_t *json, json_token_t *token);
+
+/**
+ * Find values of the document at given paths in a single pass. Path is a list of member names and array indexes
+ * separated by dots, i.e. "1.what.0", empty path selects the whole document. Objects and arrays are returned whole.
+ * Index segment also matches object member of the same name, callers check the type of containers on the path.
+ *
+ * Every value of the document has to be selected by one of the paths, or has to enclose a selected value, so that
+ * nothing but the selected values is left to display.
+ *
+ * @param[in] ptr
+ *  Pointer to the document
+ * @param[in] size
+ *  Length of the document
+ * @param[in] paths
+ *  Paths of values to find
+ * @param[in] count
+ *  Number of paths
+ * @param[out] values
+ *  Values found at the paths, JSON_TOKEN_NONE type for paths missing in the document
+ * @return true if success, false if the document is malformed, has duplicated member or a value not covered by paths
+ */
+bool json_find(const char *ptr, size_t size, const char *const *paths, uint8_t count, json_token_t *values);
+
+/**
+ * Check if the token has exactly given characters
+ *
+ * @param[in] token
+ *  Pointer to the token
+ * @param[in] str
+ *  Null terminated string to compare with
+ * @return true if equal, false otherwise
+ */
+bool json_token_equal(const json_token_t *token, const char *str);
@@ -1,5 +1,12 @@
 #pragma once
 
+#include "constants.h"
+
+/**
+ * Length of V state, rng_rfc6979 appends a separator byte to V before hashing it
+ */
+#define RNG_RFC6979_V_LEN (DIGEST_LEN + 1)
+
 void rng_rfc6979(unsigned char *rnd,
                  unsigned char *h1,
                  unsigned char *x,
@@ -19,54 +19,50 @@
 #include "signature.h"
 #include "string.h"  // memmove
 
-bool signature_check_canonical(uint8_t *der) {
-    // Hive way to check if a signature is canonical
-    return !(der[0] & 0x80) && !(der[0] == 0 && !(der[1] & 0x80)) && !(der[32] & 0x80) && !(der[32] == 0 && !(der[33] & 0x80));
+bool signature_check_canonical_integer(const uint8_t *value) {
+    /* Hive considers r or s canonical when its DER encoding is 32 bytes long: neither padded because of the high bit nor
+     * shortened because of a zero leading byte. Values with a zero leading byte followed by a byte with the high bit are
+     * canonical as well, but they were always rejected by the former DER conversion, so they still are to keep
+     * signatures identical to the ones produced by previous versions of the app. */
+    return value[0] != 0 && !(value[0] & 0x80);
 }
 
-bool signature_from_der(const uint8_t *der, uint8_t *sig, size_t sig_len) {
-    if (sig_len < SIGNATURE_LEN) {
-        return false;
-    }
-
-    int32_t length = 0, delta = 1, offset = 2;
+bool signature_check_canonical(uint8_t *der) {
+    return signature_check_canonical_integer(der) && signature_check_canonical_integer(der + 32);
+}
 
-    // Derive the recovery parameter, by adding 4 and 27 to stay compatible with other protocols
-    sig[0] = 27 + 4 + (der[0] & 0x01);
+/**
+ * Read single DER integer of a signature into 32 bytes big endian buffer, left padded with zeros
+ */
+static bool read_der_integer(const uint8_t *der, size_t *offset, uint8_t out[static 32]) {
+    int32_t length = der[*offset + 1];
+    size_t start = *offset + 2;
 
-    if (der[offset + 2] == 0) {
-        length = der[offset + 1] - 1;
-        offset += 3;
-    } else {
-        length = der[offset + 1];
-        offset += 2;
+    // leading zero added because of the high bit is not a part of the value
+    if (length > 0 && der[start] == 0) {
+        length--;
+        start++;
     }
     if ((length < 0) || (length > 32)) {
         return false;
     }
-    while ((length + delta) < 32) {
-        sig[delta++] = 0;
-    }
 
-    memmove(sig + delta, der + offset, length);
+    memset(out, 0, 32 - length);
+    memmove(out + 32 - length, der + start, length);
+    *offset = start + length;
 
-    delta = 1;
-    offset += length;
-    if (der[offset + 2] == 0) {
-        length = der[offset + 1] - 1;
-        offset += 3;
-    } else {
-        length = der[offset + 1];
-        offset += 2;
-    }
-    if ((length < 0) || (length > 32)) {
+    return true;
+}
+
+bool signature_from_der(const uint8_t *der, uint8_t *sig, size_t sig_len) {
+    size_t offset = 2;
+
+    if (sig_len < SIGNATURE_LEN) {
         return false;
     }
-    while ((length + delta) < 32) {
-        sig[32 + delta++] = 0;
-    }
 
-    memmove(sig + 32 + delta, der + offset, length);
+    // Derive the recovery parameter, by adding 4 and 27 to stay compatible with other protocols
+    sig[0] = 27 + 4 + (der[0] & 0x01);
 
-    return true;
-}
\ No newline at end of file
+    return read_der_integer(der, &offset, sig + 1) && read_der_integer(der, &offset, sig + 1 + 32);
+}
@@ -7,23 +7,33 @@
 #include "constants.h"
 
 /**
- * Check if provided DER signature is canonical
+ * Check if single 32 bytes integer of a signature (r or s) is canonical, i.e. its leading byte is within 0x01..0x7F
+ *
+ * @param[in] value
+ *  Pointer to big endian integer
+ * @return true if integer is canonical, false otherwise
+ */
+bool signature_check_canonical_integer(const uint8_t *value);
+
+/**
+ * Check if provided signature is canonical
  *
  * @param[in] der
- *  Pointer to signature candidate buffer
+ *  Pointer to r and s of signature candidate
  * @return true if signature is canonical, false otherwise
  */
 bool signature_check_canonical(uint8_t *der);
 
 /**
- * Convert raw DER signature into compact signature supported by Hive backend
+ * Convert raw DER signature into compact signature supported by Hive backend, r and s shorter than 32 bytes are left
+ * padded with zeros
  *
  * @param[in] der
- *  Pointer to a raw DER signature buffer
+ *  Pointer to a raw DER signature buffer, parity of R.y in the lowest bit of its first byte
  * @param[out] sig
  *  Pointer to output signature buffer
  * @param[in] sig_len
- *  Length of
+ *  Length of output signature buffer
  * @return true if success, false otherwise
  */
-bool signature_from_der(const uint8_t *der, uint8_t *sig, size_t sig_len);
\ No newline at end of file
+bool signature_from_der(const uint8_t *der, uint8_t *sig, size_t sig_len);
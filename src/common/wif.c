@@ -5,6 +5,7 @@
 #include "cx.h"
 #include "common/wif.h"
 #include "common/base58.h"
+#include "perf.h"
 
 #include "macros.h"
 
@@ -42,6 +43,8 @@ bool wif_from_compressed_public_key(uint8_t compressed_key[static PUBKEY_COMPRES
         return false;
     }
 
+    PERF_STATS_WIF();
+
     uint8_t temp[PUBKEY_COMPRESSED_LEN + 4] = {0};
     memmove(temp, compressed_key, PUBKEY_COMPRESSED_LEN);
 
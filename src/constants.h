@@ -64,4 +64,119 @@
 #define PUBKEY_COMPRESSED_LEN 33
 
 // [wif (53)][\0]
-#define PUBKEY_WIF_STR_LEN 54
\ No newline at end of file
+#define PUBKEY_WIF_STR_LEN 54
+
+/**
+ * Maximum number of fields of a single operation, including its name
+ */
+#define MAX_OPERATION_FIELDS 9
+
+/**
+ * Maximum length of Hive account name
+ */
+#define MAX_HIVE_ACCOUNT_NAME_LEN 16
+
+/**
+ * Maximum length of custom_json operation id
+ */
+#define MAX_CUSTOM_JSON_ID_LEN 32
+
+/**
+ * Maximum length of operation kept as a template for diff review
+ */
+#define MAX_TEMPLATE_LEN 256
+
+/**
+ * Number of operation types kept as a template for diff review
+ */
+#define TEMPLATE_OPERATIONS_COUNT 2
+
+/**
+ * Chain id length
+ */
+#define CHAIN_ID_LEN 32
+
+/**
+ * Maximum number of message characters displayed to the user
+ */
+#define MAX_MESSAGE_PREVIEW_LEN 128
+
+/**
+ * Maximum number of counterparties in a single shared secrets request, all secrets must fit one response
+ */
+#define MAX_ECDH_KEYS 4
+
+/**
+ * Length of Hive memo shared secret, SHA-512 of ECDH x-coordinate
+ */
+#define ECDH_SECRET_LEN 64
+
+/**
+ * Hardened index of owner key role in SLIP-48 path
+ */
+#define OWNER_KEY_ROLE 0x80000000
+
+/**
+ * Hardened index of active key role in SLIP-48 path
+ */
+#define ACTIVE_KEY_ROLE 0x80000001
+
+/**
+ * Hardened index of memo key role in SLIP-48 path
+ */
+#define MEMO_KEY_ROLE 0x80000003
+
+/**
+ * Hardened index of posting key role in SLIP-48 path
+ */
+#define POSTING_KEY_ROLE 0x80000004
+
+/**
+ * Number of keys of a new account: owner, active, posting and memo
+ */
+#define ACCOUNT_KEYS_COUNT 4
+
+/**
+ * Length of public key fingerprint in the key ownership index: prefix and 11 bytes of x-coordinate of compressed key
+ */
+#define KEY_FINGERPRINT_LEN 12
+
+/**
+ * Maximum number of keys in the key ownership index, i.e. all four roles of 4 accounts
+ */
+#define MAX_KEY_INDEX_ENTRIES 16
+
+/**
+ * Length of serialized transaction header: ref_block_num (2), ref_block_prefix (4) and expiration (4)
+ */
+#define TRANSACTION_HEADER_LEN 10
+
+/**
+ * AES block length
+ */
+#define AES_BLOCK_LEN 16
+
+/**
+ * Length of encrypted memo nonce
+ */
+#define MEMO_NONCE_LEN 8
+
+/**
+ * Length of encrypted memo checksum
+ */
+#define MEMO_CHECK_LEN 4
+
+/**
+ * Maximum length of encrypted memo, memo field of an operation is limited to 2 KB
+ */
+#define MAX_ENCRYPTED_MEMO_LEN 2048
+
+/**
+ * Maximum length of memo text decrypted from a single chunk, including a block carried over from the previous one
+ */
+#define MAX_MEMO_PAGE_LEN (MAX_APDU_LEN + AES_BLOCK_LEN)
+
+/**
+ * Number of ticker events the last signature is kept for, SDK ticker fires every 100 ms so it is kept for 30 seconds
+ */
+#define LAST_SIGNATURE_TTL_TICKS 300
@@ -29,10 +29,21 @@
 #include "common/rng_rfc6979.h"
 #include "common/signature.h"
 #include "common/macros.h"
+#include "perf.h"
 
 uint8_t const SECP256K1_N[32] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
                                  0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b, 0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x41};
 
+uint8_t const SECP256K1_P[32] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x2f};
+
+// (p + 1) / 4, exponent of modular square root as p = 3 mod 4
+uint8_t const SECP256K1_SQRT_EXP[32] = {0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x0c};
+
+uint8_t const SECP256K1_B[32] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07};
+
 int crypto_derive_private_key(cx_ecfp_private_key_t *private_key,
                               uint8_t chain_code[static CHAINCODE_LEN],
                               const uint32_t *bip32_path,
@@ -67,14 +78,45 @@ int crypto_init_public_key(cx_ecfp_private_key_t *private_key, cx_ecfp_public_ke
     return 0;
 }
 
-bool crypto_sign_digest(const uint8_t digest[static DIGEST_LEN], uint8_t signature[static SIGNATURE_LEN]) {
+void crypto_derive_compressed_public_key(const uint32_t *bip32_path, uint8_t bip32_path_len, uint8_t public_key[static PUBKEY_COMPRESSED_LEN]) {
+    cx_ecfp_private_key_t private_key = {0};
+    cx_ecfp_public_key_t point = {0};
+    uint8_t chain_code[CHAINCODE_LEN] = {0};
+    uint8_t raw_public_key[PUBKEY_UNCOMPRESSED_LEN] = {0};
+
+    BEGIN_TRY {
+        TRY {
+            crypto_derive_private_key(&private_key, chain_code, bip32_path, bip32_path_len);
+            crypto_init_public_key(&private_key, &point, raw_public_key);
+        }
+        CATCH_OTHER(e) {
+            THROW(e);
+        }
+        FINALLY {
+            explicit_bzero(&private_key, sizeof(private_key));
+            explicit_bzero(chain_code, sizeof(chain_code));
+        }
+    }
+    END_TRY;
+
+    // x-coordinate prefixed with parity of y-coordinate
+    public_key[0] = (raw_public_key[PUBKEY_UNCOMPRESSED_LEN - 1] & 0x01) ? 0x03 : 0x02;
+    memmove(public_key + 1, raw_public_key, PUBKEY_COMPRESSED_LEN - 1);
+}
+
+bool crypto_sign_digest(const uint8_t digest[static DIGEST_LEN], uint8_t signature[static SIGNATURE_LEN], crypto_progress_cb progress) {
     cx_ecfp_private_key_t private_key = {0};
+    cx_ecfp_private_key_t nonce = {0};
+    cx_ecfp_public_key_t nonce_point = {0};  // k * G
     uint8_t chain_code[CHAINCODE_LEN] = {0};
     uint8_t der_signature[MAX_DER_SIG_LEN] = {0};
+    uint8_t k[32] = {0};
+    uint8_t r[32] = {0};
     uint32_t info = 0;
-    uint8_t V[DIGEST_LEN];
+    uint8_t V[RNG_RFC6979_V_LEN];
     uint8_t K[DIGEST_LEN];
     int32_t counter = 0;
+    bool is_canonical = false;
     bool is_valid = true;
 
     PRINTF("Digest: %.*H\n", DIGEST_LEN, digest);
@@ -86,29 +128,54 @@ bool crypto_sign_digest(const uint8_t digest[static DIGEST_LEN], uint8_t signatu
         TRY {
             /* Hive backend only accepts canonical signatures but there is no way of knowing if the signature that is going to be produced will be canonical.
              * That's why we need to derive deterministic k parameter for ECDSA signing and while generating this parameter we will add our loop counter to the
-             * digest before hashing. This results in a new deterministic k each round which will result in either a canonical or non-canonical signature. */
+             * digest before hashing. This results in a new deterministic k each round which will result in either a canonical or non-canonical signature.
+             *
+             * r = (k * G).x mod n does not depend on the private key, so about half of the candidates are rejected on r before cx_ecdsa_sign is called. */
             while (true) {
+                PERF_BEGIN(PERF_SIGN_ATTEMPT);
+
                 if (counter == 0) {
-                    rng_rfc6979(der_signature, (uint8_t *) digest, private_key.d, private_key.d_len, SECP256K1_N, ARRAYLEN(SECP256K1_N), V, K);
+                    rng_rfc6979(k, (uint8_t *) digest, private_key.d, private_key.d_len, SECP256K1_N, ARRAYLEN(SECP256K1_N), V, K);
                 } else {
-                    rng_rfc6979(der_signature, (uint8_t *) digest, NULL, 0, SECP256K1_N, ARRAYLEN(SECP256K1_N), V, K);
+                    rng_rfc6979(k, (uint8_t *) digest, NULL, 0, SECP256K1_N, ARRAYLEN(SECP256K1_N), V, K);
                 }
 
-                cx_ecdsa_sign(&private_key, CX_NO_CANONICAL | CX_RND_PROVIDED | CX_LAST, CX_SHA256, digest, DIGEST_LEN, der_signature, MAX_DER_SIG_LEN, &info);
+                cx_ecfp_init_private_key(CX_CURVE_256K1, k, sizeof(k), &nonce);
+                cx_ecfp_generate_pair(CX_CURVE_256K1, &nonce_point, &nonce, 1);
 
-                if ((info & CX_ECCINFO_PARITY_ODD) != 0) {
-                    der_signature[0] |= 0x01;
+                // r = x mod n, x < p < 2n
+                memmove(r, nonce_point.W + 1, sizeof(r));
+                if (cx_math_cmp(r, SECP256K1_N, sizeof(r)) >= 0) {
+                    cx_math_sub(r, r, SECP256K1_N, sizeof(r));
                 }
 
-                if (!signature_from_der(der_signature, signature, MEMBER_SIZE(transaction_ctx_t, signature))) {
-                    is_valid = false;
-                    break;
+                if (signature_check_canonical_integer(r)) {
+                    // the same k is passed to cx_ecdsa_sign in the signature buffer
+                    memmove(der_signature, k, sizeof(k));
+                    cx_ecdsa_sign(&private_key, CX_NO_CANONICAL | CX_RND_PROVIDED | CX_LAST, CX_SHA256, digest, DIGEST_LEN, der_signature, MAX_DER_SIG_LEN, &info);
+
+                    if ((info & CX_ECCINFO_PARITY_ODD) != 0) {
+                        der_signature[0] |= 0x01;
+                    }
+
+                    if (!signature_from_der(der_signature, signature, SIGNATURE_LEN)) {
+                        is_valid = false;
+                        break;
+                    }
+
+                    is_canonical = signature_check_canonical(signature + 1);
                 }
 
-                if (signature_check_canonical(signature + 1)) {
+                PERF_END(PERF_SIGN_ATTEMPT);
+
+                if (is_canonical) {
+                    PERF_STATS_SIGNATURE(counter);
                     break;
-                } else {
-                    counter++;
+                }
+
+                counter++;
+                if (progress != NULL) {
+                    progress(counter);
                 }
             }
         }
@@ -117,9 +184,106 @@ bool crypto_sign_digest(const uint8_t digest[static DIGEST_LEN], uint8_t signatu
         }
         FINALLY {
             explicit_bzero(&private_key, sizeof(private_key));
+            explicit_bzero(&nonce, sizeof(nonce));
+            explicit_bzero(k, sizeof(k));
+            explicit_bzero(der_signature, sizeof(der_signature));
+            explicit_bzero(V, sizeof(V));
+            explicit_bzero(K, sizeof(K));
+        }
+    }
+    END_TRY;
+
+    return is_valid;
+}
+
+bool crypto_decompress_public_key(const uint8_t compressed[static PUBKEY_COMPRESSED_LEN], uint8_t point[static PUBKEY_UNCOMPRESSED_LEN + 1]) {
+    uint8_t *x = point + 1;
+    uint8_t *y = point + 1 + 32;
+    uint8_t rhs[32] = {0};
+    uint8_t check[32] = {0};
+
+    if ((compressed[0] != 0x02 && compressed[0] != 0x03) || cx_math_cmp(compressed + 1, SECP256K1_P, 32) >= 0) {
+        return false;
+    }
+
+    point[0] = 0x04;
+    memmove(x, compressed + 1, 32);
+
+    cx_math_multm(rhs, x, x, SECP256K1_P, 32);
+    cx_math_multm(rhs, rhs, x, SECP256K1_P, 32);
+    cx_math_addm(rhs, rhs, SECP256K1_B, SECP256K1_P, 32);
+    cx_math_powm(y, rhs, SECP256K1_SQRT_EXP, 32, SECP256K1_P, 32);
+
+    // x is not on the curve if x^3 + 7 has no square root
+    cx_math_multm(check, y, y, SECP256K1_P, 32);
+    if (cx_math_cmp(check, rhs, 32) != 0) {
+        return false;
+    }
+
+    if ((y[31] & 0x01) != (compressed[0] & 0x01)) {
+        cx_math_sub(y, SECP256K1_P, y, 32);
+    }
+
+    return true;
+}
+
+bool crypto_ecdh_shared_secret(const cx_ecfp_private_key_t *private_key,
+                               const uint8_t public_key[static PUBKEY_COMPRESSED_LEN],
+                               uint8_t secret[static ECDH_SECRET_LEN]) {
+    uint8_t point[PUBKEY_UNCOMPRESSED_LEN + 1] = {0};
+    uint8_t x[32] = {0};
+    bool is_valid = false;
+
+    if (!crypto_decompress_public_key(public_key, point)) {
+        return false;
+    }
+
+    BEGIN_TRY {
+        TRY {
+            cx_ecdh(private_key, CX_ECDH_X, point, sizeof(point), x, sizeof(x));
+            // Hive memo key is SHA-512 of the x-coordinate of the shared point
+            cx_hash_sha512(x, sizeof(x), secret, ECDH_SECRET_LEN);
+            is_valid = true;
+        }
+        CATCH_OTHER(e) {
+            THROW(e);
+        }
+        FINALLY {
+            explicit_bzero(x, sizeof(x));
         }
     }
     END_TRY;
 
     return is_valid;
-}
\ No newline at end of file
+}
+
+bool crypto_memo_encryption_key(const cx_ecfp_private_key_t *private_key,
+                                const uint8_t public_key[static PUBKEY_COMPRESSED_LEN],
+                                const uint8_t nonce[static MEMO_NONCE_LEN],
+                                const uint8_t check[static MEMO_CHECK_LEN],
+                                cx_aes_key_t *key,
+                                uint8_t iv[static AES_BLOCK_LEN]) {
+    uint8_t seed[MEMO_NONCE_LEN + ECDH_SECRET_LEN] = {0};  // nonce || shared secret
+    uint8_t encryption_key[CX_SHA512_SIZE] = {0};
+    uint8_t checksum[CX_SHA256_SIZE] = {0};
+    bool is_valid = false;
+
+    memmove(seed, nonce, MEMO_NONCE_LEN);
+
+    if (crypto_ecdh_shared_secret(private_key, public_key, seed + MEMO_NONCE_LEN)) {
+        cx_hash_sha512(seed, sizeof(seed), encryption_key, sizeof(encryption_key));
+        cx_hash_sha256(encryption_key, sizeof(encryption_key), checksum, sizeof(checksum));
+
+        // checksum detects wrong key before anything is decrypted
+        if (memcmp(checksum, check, MEMO_CHECK_LEN) == 0) {
+            cx_aes_init_key(encryption_key, 32, key);
+            memmove(iv, encryption_key + 32, AES_BLOCK_LEN);
+            is_valid = true;
+        }
+    }
+
+    explicit_bzero(seed, sizeof(seed));
+    explicit_bzero(encryption_key, sizeof(encryption_key));
+
+    return is_valid;
+}
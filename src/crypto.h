@@ -43,6 +43,30 @@ int crypto_derive_private_key(cx_ecfp_private_key_t *private_key, uint8_t chain_
  */
 int crypto_init_public_key(cx_ecfp_private_key_t *private_key, cx_ecfp_public_key_t *public_key, uint8_t raw_public_key[static PUBKEY_UNCOMPRESSED_LEN]);
 
+/**
+ * Derive compressed public key given BIP32 path, private key never leaves this function.
+ *
+ * @param[in]  bip32_path
+ *   Pointer to buffer with BIP32 path.
+ * @param[in]  bip32_path_len
+ *   Number of path in BIP32 path.
+ * @param[out] public_key
+ *   Compressed public key.
+ *
+ * @throw INVALID_PARAMETER
+ *
+ */
+void crypto_derive_compressed_public_key(const uint32_t *bip32_path, uint8_t bip32_path_len, uint8_t public_key[static PUBKEY_COMPRESSED_LEN]);
+
+/**
+ * Callback invoked by crypto_sign_digest after every rejected nonce candidate.
+ *
+ * @param[in] attempts
+ *   Number of candidates rejected so far.
+ *
+ */
+typedef void (*crypto_progress_cb)(uint32_t attempts);
+
 /**
  * Sign message hash in global context.
  *
@@ -50,6 +74,8 @@ int crypto_init_public_key(cx_ecfp_private_key_t *private_key, cx_ecfp_public_ke
  *   Pointer to transaction digest.
  * @param[out] signature
  *  Pointer to signature.
+ * @param[in]  progress
+ *   Called between nonce candidates, may be NULL.
  *
  * @see G_context.bip32_path
  *
@@ -58,4 +84,64 @@ int crypto_init_public_key(cx_ecfp_private_key_t *private_key, cx_ecfp_public_ke
  * @throw INVALID_PARAMETER
  *
  */
-bool crypto_sign_digest(const uint8_t digest[static DIGEST_LEN], uint8_t signature[static SIGNATURE_LEN]);
+bool crypto_sign_digest(const uint8_t digest[static DIGEST_LEN], uint8_t signature[static SIGNATURE_LEN], crypto_progress_cb progress);
+
+/**
+ * Recover y-coordinate of compressed secp256k1 point, y^2 = x^3 + 7 (mod p).
+ *
+ * @param[in]  compressed
+ *   Compressed public key, 0x02 or 0x03 prefix followed by x-coordinate.
+ * @param[out] point
+ *   Pointer to 65 bytes buffer for uncompressed point, 0x04 prefix followed by x and y coordinates.
+ *
+ * @return true if success, false if prefix is invalid or x-coordinate is not on the curve.
+ *
+ */
+bool crypto_decompress_public_key(const uint8_t compressed[static PUBKEY_COMPRESSED_LEN], uint8_t point[static PUBKEY_UNCOMPRESSED_LEN + 1]);
+
+/**
+ * Compute Hive memo shared secret between private key and counterparty public key.
+ *
+ * @param[in]  private_key
+ *   Pointer to private key.
+ * @param[in]  public_key
+ *   Compressed counterparty public key.
+ * @param[out] secret
+ *   Pointer to 64 bytes buffer for SHA-512 of ECDH x-coordinate.
+ *
+ * @return true if success, false if public key is not a valid curve point.
+ *
+ * @throw INVALID_PARAMETER
+ *
+ */
+bool crypto_ecdh_shared_secret(const cx_ecfp_private_key_t *private_key,
+                               const uint8_t public_key[static PUBKEY_COMPRESSED_LEN],
+                               uint8_t secret[static ECDH_SECRET_LEN]);
+
+/**
+ * Derive Hive memo AES-256-CBC key and IV, SHA-512 of nonce and shared secret, and verify memo checksum.
+ *
+ * @param[in]  private_key
+ *   Pointer to memo private key.
+ * @param[in]  public_key
+ *   Compressed public key of the other party of the memo.
+ * @param[in]  nonce
+ *   Memo nonce, serialized little endian.
+ * @param[in]  check
+ *   Memo checksum, serialized little endian.
+ * @param[out] key
+ *   Pointer to AES key.
+ * @param[out] iv
+ *   Pointer to 16 bytes buffer for initialization vector.
+ *
+ * @return true if success, false if public key is invalid or checksum does not match.
+ *
+ * @throw INVALID_PARAMETER
+ *
+ */
+bool crypto_memo_encryption_key(const cx_ecfp_private_key_t *private_key,
+                                const uint8_t public_key[static PUBKEY_COMPRESSED_LEN],
+                                const uint8_t nonce[static MEMO_NONCE_LEN],
+                                const uint8_t check[static MEMO_CHECK_LEN],
+                                cx_aes_key_t *key,
+                                uint8_t iv[static AES_BLOCK_LEN]);
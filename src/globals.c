@@ -7,4 +7,9 @@ io_state_e G_io_state;
 ux_state_t G_ux;
 bolos_ux_params_t G_ux_params;
 global_ctx_t G_context;
+session_policy_t G_session_policy;
+operation_template_t G_operation_templates[TEMPLATE_OPERATIONS_COUNT];
+last_signature_t G_last_signature;
+key_index_t G_key_index;
+field_t G_scratch_field;
 const settings_t N_settings_nvram;
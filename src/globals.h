@@ -38,6 +38,32 @@ extern io_state_e G_io_state;
  */
 extern global_ctx_t G_context;
 
+/**
+ * Signing session policy approved by the user, kept until the app exits
+ */
+extern session_policy_t G_session_policy;
+
+/**
+ * Last approved operations of repeatedly signed types, kept until the app exits
+ */
+extern operation_template_t G_operation_templates[TEMPLATE_OPERATIONS_COUNT];
+
+/**
+ * Last signature produced after user approval, kept for LAST_SIGNATURE_TTL_TICKS ticker events
+ */
+extern last_signature_t G_last_signature;
+
+/**
+ * Index of public keys derived on this device, built on the first review which shows keys and kept until the app exits
+ */
+extern key_index_t G_key_index;
+
+/**
+ * Scratch field for values rendered besides the reviewed field, i.e. previous value of a changed field or values of
+ * the summary
+ */
+extern field_t G_scratch_field;
+
 /**
  * Global settings NVRAM storage
  */
@@ -0,0 +1,77 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "os.h"
+#include "cx.h"
+
+#include "create_account.h"
+#include "sw.h"
+#include "io.h"
+#include "globals.h"
+#include "crypto.h"
+#include "ui/screens/review_account.h"
+#include "transaction/account_create.h"
+#include "transaction/transaction_parse.h"
+#include "common/buffer.h"
+
+/* Roles of the new account keys, in the order of operation fields */
+static const uint32_t ACCOUNT_KEY_ROLES[ACCOUNT_KEYS_COUNT] = {OWNER_KEY_ROLE, ACTIVE_KEY_ROLE, POSTING_KEY_ROLE, MEMO_KEY_ROLE};
+
+int handler_create_account(buffer_t *cdata) {
+    account_request_t request;
+    uint8_t keys[ACCOUNT_KEYS_COUNT][PUBKEY_COMPRESSED_LEN];
+    uint32_t bip32_path[ACCOUNT_KEY_PATH_LEN];
+
+    if (G_context.state != STATE_NONE) {
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    explicit_bzero(&G_context, sizeof(G_context));
+    G_context.req_type = CONFIRM_ACCOUNT;
+    G_context.state = STATE_NONE;
+    cx_sha256_init(&G_context.tx_info.sha);
+
+    if (account_request_parse(cdata, &request) != PARSING_OK) {
+        return io_send_sw(SW_ACCOUNT_PARSING_FAIL);
+    }
+
+    for (uint8_t i = 0; i < ACCOUNT_KEYS_COUNT; i++) {
+        account_key_path(request.account_index, ACCOUNT_KEY_ROLES[i], bip32_path);
+        crypto_derive_compressed_public_key(bip32_path, ACCOUNT_KEY_PATH_LEN, keys[i]);
+    }
+
+    // transaction is assembled as if it was sent with SIGN_TRANSACTION, so it is validated and hashed the same way
+    G_context.tx_info.raw_tx_len = account_create_serialize(&request, keys, G_context.tx_info.raw_tx, MAX_TRANSACTION_LEN);
+    if (G_context.tx_info.raw_tx_len == 0) {
+        return io_send_sw(SW_ACCOUNT_PARSING_FAIL);
+    }
+
+    buffer_t tx = {.ptr = G_context.tx_info.raw_tx, .size = G_context.tx_info.raw_tx_len, .offset = 0};
+
+    if (transaction_parse(&tx) != PARSING_OK) {
+        return io_send_sw(SW_ACCOUNT_PARSING_FAIL);
+    }
+
+    G_context.state = STATE_PARSED;
+
+    return ui_display_account(request.account_index);
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdint.h>  // uint*_t
+
+#include "common/buffer.h"
+
+/**
+ * Handler for CREATE_ACCOUNT command. If successfully parse the request, derive owner, active, posting and memo keys
+ * of the new account, assemble and hash the account creation transaction, ask user to approve it, sign it with
+ * the creator key and send APDU response with the signature and the new public keys.
+ *
+ * @see G_context.bip32_path, G_context.tx_info.
+ *
+ * @param[in,out] cdata
+ *   Command data with creator BIP32 path, chain id, transaction header and operation parameters.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_create_account(buffer_t *cdata);
@@ -0,0 +1,236 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+#include <string.h>   // memmove, explicit_bzero
+
+#include "os.h"
+#include "cx.h"
+
+#include "decrypt_memo.h"
+#include "sw.h"
+#include "globals.h"
+#include "crypto.h"
+#include "ui/screens/review_memo.h"
+#include "common/buffer.h"
+#include "common/wif.h"
+#include "apdu/dispatcher.h"
+
+/**
+ * Parse encrypted memo header and derive AES key from memo key and the other party public key
+ *
+ * Header: from (33) || to (33) || nonce (8) || check (4) || varint(len(encrypted))
+ */
+static uint16_t memo_init(buffer_t *cdata) {
+    memo_ctx_t *memo = &G_context.memo_info;
+    uint8_t from[PUBKEY_COMPRESSED_LEN] = {0};
+    uint8_t to[PUBKEY_COMPRESSED_LEN] = {0};
+    uint8_t nonce[MEMO_NONCE_LEN] = {0};
+    uint8_t check[MEMO_CHECK_LEN] = {0};
+    uint8_t own[PUBKEY_COMPRESSED_LEN] = {0};
+    uint8_t raw_public_key[PUBKEY_UNCOMPRESSED_LEN] = {0};
+    uint8_t chain_code[CHAINCODE_LEN] = {0};
+    cx_ecfp_private_key_t private_key = {0};
+    cx_ecfp_public_key_t public_key = {0};
+    const uint8_t *counterparty = NULL;
+    bool is_valid = false;
+
+    if (!buffer_read_u8(cdata, &G_context.bip32_path_len) ||
+        !buffer_read_bip32_path(cdata, G_context.bip32_path, (size_t) G_context.bip32_path_len)) {
+        return SW_MEMO_PARSING_FAIL;
+    }
+
+    // only memo key m/48'/13'/3'/... may be used for key agreement, never a signing key
+    if (G_context.bip32_path_len < 3 || G_context.bip32_path[2] != MEMO_KEY_ROLE) {
+        return SW_MEMO_PARSING_FAIL;
+    }
+
+    if (!buffer_move_partial(cdata, from, sizeof(from), sizeof(from)) || !buffer_move_partial(cdata, to, sizeof(to), sizeof(to)) ||
+        !buffer_move_partial(cdata, nonce, sizeof(nonce), sizeof(nonce)) || !buffer_move_partial(cdata, check, sizeof(check), sizeof(check)) ||
+        !buffer_read_varint(cdata, &memo->encrypted_len)) {
+        return SW_MEMO_PARSING_FAIL;
+    }
+
+    if (memo->encrypted_len == 0 || memo->encrypted_len > MAX_ENCRYPTED_MEMO_LEN || memo->encrypted_len % AES_BLOCK_LEN != 0) {
+        return SW_MEMO_PARSING_FAIL;
+    }
+
+    crypto_derive_private_key(&private_key, chain_code, G_context.bip32_path, G_context.bip32_path_len);
+    crypto_init_public_key(&private_key, &public_key, raw_public_key);
+
+    own[0] = 0x02 | (raw_public_key[PUBKEY_UNCOMPRESSED_LEN - 1] & 0x01);
+    memmove(own + 1, raw_public_key, 32);
+
+    // memo can be read both by its sender and its recipient
+    if (memcmp(own, to, PUBKEY_COMPRESSED_LEN) == 0) {
+        counterparty = from;
+        memo->is_sender = false;
+    } else if (memcmp(own, from, PUBKEY_COMPRESSED_LEN) == 0) {
+        counterparty = to;
+        memo->is_sender = true;
+    }
+
+    if (counterparty != NULL && wif_from_compressed_public_key((uint8_t *) counterparty, PUBKEY_COMPRESSED_LEN, memo->counterparty, PUBKEY_WIF_STR_LEN)) {
+        is_valid = crypto_memo_encryption_key(&private_key, counterparty, nonce, check, &memo->key, memo->iv);
+    }
+
+    explicit_bzero(&private_key, sizeof(private_key));
+    explicit_bzero(chain_code, sizeof(chain_code));
+
+    if (counterparty == NULL) {
+        return SW_MEMO_PARSING_FAIL;
+    }
+
+    return is_valid ? SW_OK : SW_MEMO_DECRYPTION_FAIL;
+}
+
+/**
+ * Append decrypted memo characters to the page
+ */
+static bool memo_append(const uint8_t *data, size_t length) {
+    memo_ctx_t *memo = &G_context.memo_info;
+    buffer_t text = {.ptr = data, .size = length, .offset = 0};
+
+    // memo is serialized as a string, skip its length
+    if (!memo->text_length_read) {
+        if (!buffer_read_varint(&text, &memo->text_remaining)) {
+            return false;
+        }
+        memo->text_length_read = true;
+    }
+
+    for (size_t i = text.offset; i < length; i++) {
+        if (memo->text_remaining == 0 || memo->page_len >= MAX_MEMO_PAGE_LEN) {
+            return false;
+        }
+
+        // non printable characters are replaced so the memo cannot fake other screens
+        memo->page[memo->page_len++] = (data[i] >= 0x20 && data[i] <= 0x7e) ? (char) data[i] : '.';
+        memo->text_remaining--;
+    }
+
+    return true;
+}
+
+/**
+ * Decrypt complete block, the last one is stripped of PKCS#7 padding
+ */
+static bool memo_decrypt_block(void) {
+    memo_ctx_t *memo = &G_context.memo_info;
+    uint8_t plain[AES_BLOCK_LEN] = {0};
+    size_t length = AES_BLOCK_LEN;
+    bool is_valid = true;
+
+    cx_aes_iv(&memo->key, CX_DECRYPT | CX_CHAIN_CBC | CX_PAD_NONE | CX_LAST, memo->iv, AES_BLOCK_LEN, memo->block, AES_BLOCK_LEN, plain, sizeof(plain));
+    memmove(memo->iv, memo->block, AES_BLOCK_LEN);
+    memo->block_len = 0;
+
+    if (memo->received_len == memo->encrypted_len) {
+        uint8_t padding = plain[AES_BLOCK_LEN - 1];
+
+        if (padding == 0 || padding > AES_BLOCK_LEN) {
+            is_valid = false;
+        }
+        for (uint8_t i = 0; is_valid && i < padding; i++) {
+            is_valid = plain[AES_BLOCK_LEN - 1 - i] == padding;
+        }
+        length -= padding;
+    }
+
+    is_valid = is_valid && memo_append(plain, length);
+    explicit_bzero(plain, sizeof(plain));
+
+    return is_valid;
+}
+
+/**
+ * Decrypt ciphertext chunk, partial block is kept for the next chunk
+ */
+static uint16_t memo_update(buffer_t *cdata, bool more) {
+    memo_ctx_t *memo = &G_context.memo_info;
+    size_t length = cdata->size - cdata->offset;
+
+    if (length > memo->encrypted_len - memo->received_len) {
+        return SW_MEMO_PARSING_FAIL;
+    }
+
+    memo->page_len = 0;
+
+    for (size_t i = 0; i < length; i++) {
+        memo->block[memo->block_len++] = cdata->ptr[cdata->offset + i];
+        memo->received_len++;
+
+        if (memo->block_len == AES_BLOCK_LEN && !memo_decrypt_block()) {
+            return SW_MEMO_DECRYPTION_FAIL;
+        }
+    }
+
+    memo->page[memo->page_len] = '\0';
+
+    if (more == (memo->received_len == memo->encrypted_len)) {
+        return SW_MEMO_PARSING_FAIL;
+    }
+
+    // decrypted text must be exactly as long as its serialized length
+    if (!more && memo->text_remaining != 0) {
+        return SW_MEMO_DECRYPTION_FAIL;
+    }
+
+    return SW_OK;
+}
+
+int handler_decrypt_memo(buffer_t *cdata, uint8_t chunk, bool more) {
+    uint16_t sw = SW_OK;
+
+    if (chunk == P1_FIRST_CHUNK) {  // first chunk
+
+        if (G_context.state != STATE_NONE) {
+            return io_send_sw(SW_BAD_STATE);
+        }
+
+        explicit_bzero(&G_context, sizeof(G_context));
+        G_context.req_type = DISPLAY_MEMO;
+        G_context.state = STATE_NONE;
+
+        sw = memo_init(cdata);
+    } else if (G_context.state != STATE_TX_RECEIVING || G_context.req_type != DISPLAY_MEMO) {
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    if (sw == SW_OK) {
+        sw = memo_update(cdata, more);
+    }
+
+    if (sw != SW_OK) {
+        explicit_bzero(&G_context, sizeof(G_context));
+        G_context.state = STATE_NONE;
+        return io_send_sw(sw);
+    }
+
+    G_context.state = more ? STATE_TX_RECEIVING : STATE_PARSED;
+
+    // chunk may not complete any block, nothing to display yet
+    if (more && G_context.memo_info.page_len == 0) {
+        return io_send_sw(SW_OK);
+    }
+
+    G_context.memo_info.page_number++;
+
+    return ui_display_memo(!more);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+
+#include "common/buffer.h"
+
+/**
+ * Handler for DECRYPT_MEMO command. Encrypted memo is decrypted chunk by chunk with memo key derived
+ * from BIP32 path and each decrypted page is displayed on the device before the next chunk is accepted.
+ * Neither the memo key, the shared secret nor the memo text leave the device.
+ *
+ * @see G_context.bip32_path, G_context.memo_info.
+ *
+ * @param[in,out] cdata
+ *   Command data with BIP32 path and encrypted memo header (first chunk only) and ciphertext.
+ * @param[in]     chunk
+ *   Index number of the APDU chunk.
+ * @param[in]       more
+ *   Whether more APDU chunk to be received or not.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_decrypt_memo(buffer_t *cdata, uint8_t chunk, bool more);
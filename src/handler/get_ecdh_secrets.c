@@ -0,0 +1,97 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+#include <string.h>   // memmove, strlen, explicit_bzero
+
+#include "os.h"
+#include "cx.h"
+
+#include "get_ecdh_secrets.h"
+#include "sw.h"
+#include "globals.h"
+#include "ui/screens/review_ecdh.h"
+#include "common/buffer.h"
+#include "common/wif.h"
+#include "crypto.h"
+
+/**
+ * Parse memo key path and counterparty public keys into the global context
+ */
+static bool ecdh_parse(buffer_t *cdata) {
+    ecdh_ctx_t *ecdh = &G_context.ecdh_info;
+    uint8_t point[PUBKEY_UNCOMPRESSED_LEN + 1] = {0};
+    char wif[PUBKEY_WIF_STR_LEN + 1] = {0};
+    size_t wifs_len = 0;
+
+    if (!buffer_read_u8(cdata, &G_context.bip32_path_len) ||
+        !buffer_read_bip32_path(cdata, G_context.bip32_path, (size_t) G_context.bip32_path_len)) {
+        return false;
+    }
+
+    // only memo key m/48'/13'/3'/... may be used for key agreement, never a signing key
+    if (G_context.bip32_path_len < 3 || G_context.bip32_path[2] != MEMO_KEY_ROLE) {
+        return false;
+    }
+
+    if (!buffer_read_u8(cdata, &ecdh->count) || ecdh->count == 0 || ecdh->count > MAX_ECDH_KEYS) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < ecdh->count; i++) {
+        // only points on the curve are accepted, they are also the only keys encoding to a regular WIF
+        if (!buffer_move_partial(cdata, ecdh->public_keys[i], PUBKEY_COMPRESSED_LEN, PUBKEY_COMPRESSED_LEN) ||
+            !crypto_decompress_public_key(ecdh->public_keys[i], point) ||
+            !wif_from_compressed_public_key(ecdh->public_keys[i], PUBKEY_COMPRESSED_LEN, wif, sizeof(wif))) {
+            return false;
+        }
+
+        size_t separator_len = i > 0 ? 2 : 0;
+        size_t wif_len = strlen(wif);
+        if (wifs_len + separator_len + wif_len > sizeof(ecdh->wifs) - 1) {
+            return false;
+        }
+
+        memmove(ecdh->wifs + wifs_len, ", ", separator_len);
+        wifs_len += separator_len;
+        memmove(ecdh->wifs + wifs_len, wif, wif_len);
+        wifs_len += wif_len;
+    }
+
+    return cdata->offset == cdata->size;
+}
+
+int handler_get_ecdh_secrets(buffer_t *cdata) {
+    if (G_context.state != STATE_NONE) {
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    explicit_bzero(&G_context, sizeof(G_context));
+    G_context.req_type = CONFIRM_ECDH;
+    G_context.state = STATE_NONE;
+
+    if (!ecdh_parse(cdata)) {
+        explicit_bzero(&G_context, sizeof(G_context));
+        return io_send_sw(SW_ECDH_PARSING_FAIL);
+    }
+
+    G_context.state = STATE_PARSED;
+
+    return ui_display_ecdh();
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+
+#include "common/buffer.h"
+
+/**
+ * Handler for GET_ECDH_SECRETS command. If successfully parse memo key BIP32 path
+ * and batch of counterparty public keys, ask user once for the whole batch and send
+ * APDU response with shared secret for each of the counterparties.
+ *
+ * @see G_context.bip32_path, G_context.ecdh_info.public_keys,
+ * G_context.ecdh_info.secrets.
+ *
+ * @param[in,out] cdata
+ *   Command data with BIP32 path, number of public keys and compressed public keys.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_get_ecdh_secrets(buffer_t *cdata);
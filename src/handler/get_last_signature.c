@@ -0,0 +1,44 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>
+
+#include "get_last_signature.h"
+#include "constants.h"
+#include "sw.h"
+#include "io.h"
+#include "helper/send_response.h"
+#include "transaction/last_signature.h"
+
+int handler_get_last_signature(buffer_t *cdata) {
+    uint32_t bip32_path[MAX_BIP32_PATH] = {0};
+    uint8_t bip32_path_len = 0;
+    uint8_t digest[DIGEST_LEN] = {0};
+
+    // signing state is left untouched, the command may be sent in the middle of another request
+    if (!buffer_read_u8(cdata, &bip32_path_len) || !buffer_read_bip32_path(cdata, bip32_path, (size_t) bip32_path_len) ||
+        !buffer_move(cdata, digest, sizeof(digest)) || cdata->offset != cdata->size) {
+        return io_send_sw(SW_WRONG_DATA_LENGTH);
+    }
+
+    const uint8_t *signature = last_signature_find(digest, bip32_path, bip32_path_len);
+    if (signature == NULL) {
+        return io_send_sw(SW_LAST_SIGNATURE_NOT_FOUND);
+    }
+
+    return helper_send_response_sig(signature, SIGNATURE_LEN);
+}
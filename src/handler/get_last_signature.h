@@ -0,0 +1,17 @@
+#pragma once
+
+#include "common/buffer.h"
+
+/**
+ * Handler for GET_LAST_SIGNATURE command. Send APDU response with the signature kept after the last approval,
+ * if it was made with the key of the BIP32 path over the digest of the command and it did not expire yet.
+ *
+ * @see G_last_signature
+ *
+ * @param[in,out] cdata
+ *   Command data with BIP32 path and digest
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_get_last_signature(buffer_t *cdata);
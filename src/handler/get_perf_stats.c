@@ -0,0 +1,58 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+
+#ifdef HAVE_PERF_STATS
+
+#include <stdint.h>  // uint*_t
+
+#include "get_perf_stats.h"
+#include "globals.h"
+#include "io.h"
+#include "response.h"
+#include "sw.h"
+#include "perf.h"
+#include "common/macros.h"
+
+int handler_get_perf_stats() {
+    const uint32_t counters[] = {G_perf_stats.transactions,
+                                 G_perf_stats.hash_calls,
+                                 G_perf_stats.hash_bytes,
+                                 G_perf_stats.reviews,
+                                 G_perf_stats.decoder_calls,
+                                 G_perf_stats.wif_conversions,
+                                 G_perf_stats.tx_peak,
+                                 sizeof(G_context)};
+    const uint32_t stack[] = {perf_stack_size(), G_perf_stats.stack_ins, G_perf_stats.stack_last, G_perf_stats.stack_peak};
+    response_t response;
+
+    response_init(&response);
+
+    for (size_t i = 0; i < ARRAYLEN(counters); i++) {
+        response_write_u32_be(&response, counters[i]);
+    }
+    for (size_t i = 0; i < ARRAYLEN(G_perf_stats.sign_retries); i++) {
+        response_write_u32_be(&response, G_perf_stats.sign_retries[i]);
+    }
+    for (size_t i = 0; i < ARRAYLEN(stack); i++) {
+        response_write_u32_be(&response, stack[i]);
+    }
+
+    return response_send(&response, SW_OK);
+}
+
+#endif
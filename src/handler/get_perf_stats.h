@@ -0,0 +1,17 @@
+#pragma once
+
+#include "os.h"
+
+/**
+ * Handler for GET_PERF_STATS command, available in debug builds only. Send APDU response with performance
+ * counters accumulated since app start, each as big endian uint32: transactions, cx_hash calls, bytes hashed,
+ * reviews, decoder invocations, WIF conversions, peak transaction length, size of G_context, histogram of
+ * canonical signature retries (PERF_SIGN_RETRY_BUCKETS counters), stack size, INS of the previous command,
+ * its stack high-water mark and the highest mark of any command.
+ *
+ * @see perf_stats_t
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_get_perf_stats(void);
@@ -25,7 +25,7 @@
 #include "common/buffer.h"
 
 int handler_get_settings() {
-    uint8_t settings[] = {N_settings.sign_hash_policy};
+    uint8_t settings[] = {N_settings.sign_hash_policy, N_settings.session_signing_policy, N_settings.summary_review_policy};
 
     buffer_t rdata = {.ptr = settings, .size = sizeof(settings), .offset = 0};
 
@@ -0,0 +1,174 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+#include <string.h>   // memmove, strlen
+
+#include "os.h"
+#include "cx.h"
+
+#include "preview_tx.h"
+#include "sign_tx.h"
+#include "sw.h"
+#include "globals.h"
+#include "response.h"
+#include "transaction/field.h"
+#include "transaction/field_pager.h"
+#include "transaction/names.h"
+
+/**
+ * Length of record header: tag (1) and big endian length of the value (2)
+ */
+#define PREVIEW_HEADER_LEN 3
+
+typedef enum {
+    PREVIEW_DIGEST,  /// digest record
+    PREVIEW_TITLE,   /// title record of the field at position
+    PREVIEW_VALUE,   /// page of value record of the field at position
+    PREVIEW_DONE     /// all records sent
+} preview_stage_e;
+
+/**
+ * Position of the chained response in the record stream, records are rendered again for every part
+ */
+static struct {
+    preview_stage_e stage;
+    uint8_t position;    /// field position in the operation parser
+    uint8_t page;        /// value page, the first one carries the record header
+    uint8_t page_count;  /// number of value pages of the field
+    size_t offset;       /// bytes of the current piece already sent
+} g_preview;
+
+static size_t put_header(uint8_t *out, uint8_t tag, size_t length) {
+    out[0] = tag;
+    out[1] = (uint8_t) (length >> 8);
+    out[2] = (uint8_t) length;
+
+    return PREVIEW_HEADER_LEN;
+}
+
+/**
+ * Render current piece of the record stream: digest record, title record or a single page of value record
+ */
+static size_t render_piece(uint8_t *out) {
+    field_t field = {0};
+    size_t length = 0;
+
+    switch (g_preview.stage) {
+        case PREVIEW_DIGEST:
+            length = put_header(out, PREVIEW_TAG_DIGEST, DIGEST_LEN);
+            memmove(out + length, G_context.tx_info.digest, DIGEST_LEN);
+            return length + DIGEST_LEN;
+        case PREVIEW_TITLE: {
+            const char *title = name_pool_get(G_context.tx_info.parser->names[g_preview.position]);
+            size_t title_len = strlen(title);
+
+            length = put_header(out, PREVIEW_TAG_TITLE, title_len);
+            memmove(out + length, title, title_len);
+            return length + title_len;
+        }
+        case PREVIEW_VALUE: {
+            g_preview.page_count = field_pager_render(&field, g_preview.position, g_preview.page);
+
+            // value longer than the last page is cut, as on the screen
+            size_t value_len = field.length < (size_t) g_preview.page_count * FIELD_PAGE_LEN ? field.length : g_preview.page_count * FIELD_PAGE_LEN;
+            size_t page_start = (size_t) g_preview.page * FIELD_PAGE_LEN;
+            size_t page_len = value_len - page_start < FIELD_PAGE_LEN ? value_len - page_start : FIELD_PAGE_LEN;
+
+            if (g_preview.page == 0) {
+                length = put_header(out, PREVIEW_TAG_VALUE, value_len);
+            }
+            memmove(out + length, field.value, page_len);
+            return length + page_len;
+        }
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Move to the next piece of the record stream
+ */
+static void next_piece(void) {
+    g_preview.offset = 0;
+
+    switch (g_preview.stage) {
+        case PREVIEW_DIGEST:
+            g_preview.stage = G_context.tx_info.parser->size > 0 ? PREVIEW_TITLE : PREVIEW_DONE;
+            break;
+        case PREVIEW_TITLE:
+            g_preview.stage = PREVIEW_VALUE;
+            g_preview.page = 0;
+            break;
+        case PREVIEW_VALUE:
+            if (g_preview.page + 1 < g_preview.page_count) {
+                g_preview.page++;
+            } else if (g_preview.position + 1 < G_context.tx_info.parser->size) {
+                g_preview.position++;
+                g_preview.stage = PREVIEW_TITLE;
+            } else {
+                g_preview.stage = PREVIEW_DONE;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static uint16_t preview_producer(response_t *part) {
+    uint8_t piece[PREVIEW_HEADER_LEN + FIELD_PAGE_LEN];
+
+    while (g_preview.stage != PREVIEW_DONE) {
+        size_t piece_len = render_piece(piece);
+        size_t length = piece_len - g_preview.offset;
+
+        if (length > response_remaining(part)) {
+            length = response_remaining(part);
+        }
+        response_write(part, piece + g_preview.offset, length);
+        g_preview.offset += length;
+
+        if (g_preview.offset < piece_len) {
+            // part is full
+            return SW_MORE_DATA;
+        }
+
+        next_piece();
+    }
+
+    return SW_OK;
+}
+
+int handler_preview_tx(buffer_t *cdata, uint8_t chunk, bool more) {
+    const uint16_t sw = transaction_receive_chunk(cdata, chunk, more, RENDER_TRANSACTION);
+
+    if (sw != SW_OK || G_context.state != STATE_PARSED) {
+        return io_send_sw(sw);
+    }
+
+    cx_hash_final((cx_hash_t *) &G_context.tx_info.sha, G_context.tx_info.digest);
+
+    // transaction can not be approved, it stays in the context only until the response is read
+    G_context.state = STATE_NONE;
+
+    memset(&g_preview, 0, sizeof(g_preview));
+    g_preview.stage = PREVIEW_DIGEST;
+
+    return response_send_chained(&preview_producer);
+}
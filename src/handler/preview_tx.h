@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+
+#include "common/buffer.h"
+
+/**
+ * Tag of transaction digest record in PREVIEW_TRANSACTION response
+ */
+#define PREVIEW_TAG_DIGEST 0x01
+
+/**
+ * Tag of field title record in PREVIEW_TRANSACTION response
+ */
+#define PREVIEW_TAG_TITLE 0x02
+
+/**
+ * Tag of field value record in PREVIEW_TRANSACTION response
+ */
+#define PREVIEW_TAG_VALUE 0x03
+
+/**
+ * Handler for PREVIEW_TRANSACTION command. Transaction is received and parsed as with SIGN_TRANSACTION, then its
+ * digest and every field rendered as on review screens are sent as chained response of TLV records. Nothing is
+ * displayed and nothing is signed.
+ *
+ * @param[in,out] cdata
+ *   Command data with BIP32 path and raw transaction serialized.
+ * @param[in]     chunk
+ *   Index number of the APDU chunk.
+ * @param[in]     more
+ *   Whether more APDU chunk to be received or not.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_preview_tx(buffer_t *cdata, uint8_t chunk, bool more);
@@ -0,0 +1,45 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "os.h"
+
+#include "set_key_index.h"
+#include "sw.h"
+#include "io.h"
+#include "globals.h"
+#include "transaction/key_index.h"
+#include "common/buffer.h"
+
+int handler_set_key_index(buffer_t *cdata, bool reset) {
+    key_index_t index = {0};
+
+    if (G_context.state != STATE_NONE) {
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    if (!reset && key_index_parse(cdata, &index) != PARSING_OK) {
+        return io_send_sw(SW_KEY_INDEX_PARSING_FAIL);
+    }
+
+    G_key_index = index;
+
+    return io_send_sw(SW_OK);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+
+#include "types.h"
+#include "common/buffer.h"
+
+/**
+ * Parameter 1 to set accounts and roles of the key ownership index.
+ */
+#define P1_KEY_INDEX_SET 0x00
+/**
+ * Parameter 1 to reset the key ownership index to its default, all roles of account 0.
+ */
+#define P1_KEY_INDEX_RESET 0x01
+
+/**
+ * Handler for SET_KEY_INDEX command. If successfully parse the configuration, replace the key ownership index with
+ * an empty one, which is derived on the next review showing public keys, and send APDU response.
+ *
+ * @see G_key_index.
+ *
+ * @param[in,out] cdata
+ *   Command data with first account, account count and roles bitmask.
+ * @param[in]     reset
+ *   Whether to reset the index to its default instead of setting a new configuration.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_set_key_index(buffer_t *cdata, bool reset);
@@ -0,0 +1,59 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "os.h"
+
+#include "set_session_policy.h"
+#include "sw.h"
+#include "io.h"
+#include "globals.h"
+#include "transaction/session_policy.h"
+#include "ui/screens/review_session_policy.h"
+#include "ui/screens/settings.h"
+#include "common/buffer.h"
+
+int handler_set_session_policy(buffer_t *cdata, bool clear) {
+    if (G_context.state != STATE_NONE) {
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    if (clear) {
+        explicit_bzero(&G_session_policy, sizeof(G_session_policy));
+        return io_send_sw(SW_OK);
+    }
+
+    explicit_bzero(&G_context, sizeof(G_context));
+    G_context.req_type = CONFIRM_SESSION_POLICY;
+    G_context.state = STATE_NONE;
+
+    if (N_settings.session_signing_policy != SESSION_SIGNING_ENABLED) {
+        ui_display_session_signing_disabled_warning();
+        return io_send_sw(SW_SESSION_SIGNING_DISABLED);
+    }
+
+    if (session_policy_parse(cdata, &G_context.policy_info) != PARSING_OK) {
+        return io_send_sw(SW_SESSION_POLICY_PARSING_FAIL);
+    }
+
+    G_context.state = STATE_PARSED;
+
+    return ui_display_session_policy();
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+
+#include "common/buffer.h"
+
+/**
+ * Parameter 1 to set new session policy.
+ */
+#define P1_SESSION_POLICY_SET 0x00
+/**
+ * Parameter 1 to clear current session policy.
+ */
+#define P1_SESSION_POLICY_CLEAR 0x01
+
+/**
+ * Handler for SET_SESSION_POLICY command. If successfully parse BIP32 path
+ * and policy parameters, ask user to approve the policy and send APDU response.
+ *
+ * @see G_session_policy, G_context.policy_info.
+ *
+ * @param[in,out] cdata
+ *   Command data with BIP32 path and policy parameters.
+ * @param[in]     clear
+ *   Whether to clear current policy instead of setting a new one.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_set_session_policy(buffer_t *cdata, bool clear);
@@ -0,0 +1,130 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+#include <string.h>   // memset, explicit_bzero
+
+#include "os.h"
+#include "cx.h"
+
+#include "sign_message.h"
+#include "sw.h"
+#include "globals.h"
+#include "ui/screens/review_message.h"
+#include "common/buffer.h"
+#include "common/macros.h"
+#include "apdu/dispatcher.h"
+
+/**
+ * Chain ids which make the message digest equal to the digest of a serialized transaction
+ */
+static const uint8_t CHAIN_IDS[][CHAIN_ID_LEN] = {
+    // Hive mainnet
+    {0xbe, 0xea, 0xb0, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // Hive testnet
+    {0x18, 0xdc, 0xf0, 0xa2, 0x85, 0x36, 0x5f, 0xc5, 0x8b, 0x71, 0xf1, 0x8b, 0x3d, 0x3f, 0xec, 0x95,
+     0x4a, 0xa0, 0xc1, 0x41, 0xc4, 0x4e, 0x4e, 0x5c, 0xb4, 0xcf, 0x77, 0x7b, 0x9e, 0xab, 0x27, 0x4e},
+};
+
+/**
+ * Hash message chunk and keep its beginning for the preview
+ */
+static bool message_update(buffer_t *cdata) {
+    message_ctx_t *message = &G_context.message_info;
+    size_t length = cdata->size - cdata->offset;
+    const uint8_t *data = cdata->ptr + cdata->offset;
+
+    if (message->length + length < message->length) {
+        return false;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        uint32_t position = message->length + i;
+
+        if (position < CHAIN_ID_LEN) {
+            message->prefix[position] = data[i];
+        }
+
+        // non printable characters are replaced so binary content cannot pretend to be a text
+        if (position < MAX_MESSAGE_PREVIEW_LEN) {
+            message->preview[position] = (data[i] >= 0x20 && data[i] <= 0x7e) ? (char) data[i] : '.';
+        }
+    }
+
+    cx_hash((cx_hash_t *) &message->sha, 0, data, length, NULL, 0);
+    message->length += length;
+
+    return true;
+}
+
+/**
+ * Finish streaming and ask user to confirm the message
+ */
+static int message_finish(void) {
+    message_ctx_t *message = &G_context.message_info;
+
+    // message must not be signable as a transaction
+    if (message->length >= CHAIN_ID_LEN) {
+        for (uint8_t i = 0; i < ARRAYLEN(CHAIN_IDS); i++) {
+            if (memcmp(message->prefix, CHAIN_IDS[i], CHAIN_ID_LEN) == 0) {
+                G_context.state = STATE_NONE;
+                return io_send_sw(SW_MESSAGE_PARSING_FAIL);
+            }
+        }
+    }
+
+    G_context.state = STATE_PARSED;
+
+    return ui_display_message();
+}
+
+int handler_sign_message(buffer_t *cdata, uint8_t chunk, bool more) {
+    if (chunk == P1_FIRST_CHUNK) {  // first chunk
+
+        if (G_context.state != STATE_NONE) {
+            return io_send_sw(SW_BAD_STATE);
+        }
+
+        explicit_bzero(&G_context, sizeof(G_context));
+        G_context.req_type = CONFIRM_MESSAGE;
+        G_context.state = STATE_NONE;
+        cx_sha256_init(&G_context.message_info.sha);
+
+        if (!buffer_read_u8(cdata, &G_context.bip32_path_len) ||
+            !buffer_read_bip32_path(cdata, G_context.bip32_path, (size_t) G_context.bip32_path_len)) {
+            return io_send_sw(SW_MESSAGE_PARSING_FAIL);
+        }
+    } else if (G_context.state != STATE_TX_RECEIVING || G_context.req_type != CONFIRM_MESSAGE) {
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    if (!message_update(cdata)) {
+        G_context.state = STATE_NONE;
+        return io_send_sw(SW_MESSAGE_PARSING_FAIL);
+    }
+
+    if (!more) {
+        return message_finish();
+    }
+
+    G_context.state = STATE_TX_RECEIVING;
+    // will be more, just return OK
+    return io_send_sw(SW_OK);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+
+#include "common/buffer.h"
+
+/**
+ * Handler for SIGN_MESSAGE command. Message is streamed in chunks through SHA-256 without being buffered,
+ * after the last chunk its preview is displayed and the digest is signed once approved.
+ *
+ * @see G_context.bip32_path, G_context.message_info.digest,
+ * G_context.message_info.signature.
+ *
+ * @param[in,out] cdata
+ *   Command data with BIP32 path (first chunk only) and message bytes.
+ * @param[in]     chunk
+ *   Index number of the APDU chunk.
+ * @param[in]       more
+ *   Whether more APDU chunk to be received or not.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_sign_message(buffer_t *cdata, uint8_t chunk, bool more);
@@ -29,80 +29,83 @@
 #include "globals.h"
 #include "crypto.h"
 #include "ui/screens/review_transaction.h"
+#include "transaction/key_index.h"
+#include "transaction/session_policy.h"
 #include "common/buffer.h"
 #include "apdu/dispatcher.h"
+#include "perf.h"
+
+/**
+ * Ask user to confirm parsed transaction, with a single confirmation if it is covered by the session policy
+ */
+static int display_transaction(void) {
+    if (session_policy_match(&G_session_policy)) {
+        return ui_display_session_transaction();
+    }
+
+    return ui_display_transaction();
+}
+
+uint16_t transaction_receive_chunk(buffer_t *cdata, uint8_t chunk, bool more, request_type_e req_type) {
+    PERF_BEGIN(PERF_CHUNK_RECEIVE);
 
-int handler_sign_tx(buffer_t *cdata, uint8_t chunk, bool more) {
     if (chunk == P1_FIRST_CHUNK) {  // first chunk
 
         if (G_context.state != STATE_NONE) {
-            return io_send_sw(SW_BAD_STATE);
+            return SW_BAD_STATE;
         }
 
         explicit_bzero(&G_context, sizeof(G_context));
-        G_context.req_type = CONFIRM_TRANSACTION;
+        G_context.req_type = req_type;
         G_context.state = STATE_NONE;
         cx_sha256_init(&G_context.tx_info.sha);
-        if (!buffer_move(cdata, G_context.tx_info.raw_tx, MAX_TRANSACTION_LEN)) {
-            return io_send_sw(SW_WRONG_TX_LENGTH);
-        }
-
-        G_context.tx_info.raw_tx_len += cdata->size;
-
-        if (!more) {
-            buffer_t tx = {0};
-
-            tx.offset = 0;
-            tx.ptr = G_context.tx_info.raw_tx;
-            tx.size = cdata->size;
-            const parser_status_e status = transaction_parse(&tx);
-
-            if (status != PARSING_OK) {
-                return io_send_sw(SW_TX_PARSING_FAIL);
-            }
+    } else if (G_context.state != STATE_TX_RECEIVING || G_context.req_type != req_type) {
+        return SW_BAD_STATE;
+    }
 
-            G_context.state = STATE_PARSED;
+    // get chunk
+    if (!buffer_move(cdata, G_context.tx_info.raw_tx + G_context.tx_info.raw_tx_len, MAX_TRANSACTION_LEN - G_context.tx_info.raw_tx_len)) {
+        return SW_WRONG_TX_LENGTH;
+    }
 
-            return ui_display_transaction();
-        } else {
-            G_context.state = STATE_TX_RECEIVING;
-            // will be more, just return OK
-            return io_send_sw(SW_OK);
-        }
+    G_context.tx_info.raw_tx_len += cdata->size;
+    PERF_STATS_TX_LENGTH(G_context.tx_info.raw_tx_len);
+    PERF_END(PERF_CHUNK_RECEIVE);
 
-    } else {
-        if (G_context.state != STATE_TX_RECEIVING) {
-            return io_send_sw(SW_BAD_STATE);
-        }
+    if (more) {
+        // will be more, just return OK
+        G_context.state = STATE_TX_RECEIVING;
+        return SW_OK;
+    }
 
-        // get subsequent chunk
-        if (!buffer_move(cdata, G_context.tx_info.raw_tx + G_context.tx_info.raw_tx_len, MAX_TRANSACTION_LEN - G_context.tx_info.raw_tx_len)) {
-            return io_send_sw(SW_WRONG_TX_LENGTH);
-        }
+    buffer_t tx = {0};
+    tx.offset = 0;
+    tx.ptr = G_context.tx_info.raw_tx;
+    tx.size = G_context.tx_info.raw_tx_len;
 
-        G_context.tx_info.raw_tx_len += cdata->size;
+    PERF_BEGIN(PERF_TRANSACTION_PARSE);
+    const parser_status_e status = transaction_parse(&tx);
+    PERF_END(PERF_TRANSACTION_PARSE);
 
-        if (!more) {
-            buffer_t tx = {0};
-            tx.offset = 0;
-            tx.ptr = G_context.tx_info.raw_tx;
-            tx.size = G_context.tx_info.raw_tx_len;
+    if (status != PARSING_OK) {
+        return SW_TX_PARSING_FAIL;
+    }
 
-            const parser_status_e status = transaction_parse(&tx);
+    G_context.state = STATE_PARSED;
 
-            if (status != PARSING_OK) {
-                return io_send_sw(SW_TX_PARSING_FAIL);
-            }
+    return SW_OK;
+}
 
-            G_context.state = STATE_PARSED;
+int handler_sign_tx(buffer_t *cdata, uint8_t chunk, bool more) {
+    const uint16_t sw = transaction_receive_chunk(cdata, chunk, more, CONFIRM_TRANSACTION);
 
-            return ui_display_transaction();
-        } else {
-            G_context.state = STATE_TX_RECEIVING;
-            // will be more, just return OK
-            return io_send_sw(SW_OK);
-        }
+    if (sw != SW_OK || G_context.state != STATE_PARSED) {
+        return io_send_sw(sw);
     }
 
-    return 0;
+    // derive keys of this device before the review, so rendered keys are only looked up
+    key_index_ensure(G_context.tx_info.parser);
+    G_context.tx_info.label_own_keys = true;
+
+    return display_transaction();
 }
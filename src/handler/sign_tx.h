@@ -3,6 +3,7 @@
 #include <stdint.h>   // uint*_t
 #include <stdbool.h>  // bool
 
+#include "types.h"
 #include "common/buffer.h"
 
 /**
@@ -23,3 +24,22 @@
  *
  */
 int handler_sign_tx(buffer_t *cdata, uint8_t chunk, bool more);
+
+/**
+ * Receive chunk of transaction into global context, shared by SIGN_TRANSACTION and PREVIEW_TRANSACTION commands.
+ * Transaction is parsed and hashed when the last chunk is received.
+ *
+ * @param[in,out] cdata
+ *   Command data with BIP32 path and raw transaction serialized.
+ * @param[in]     chunk
+ *   Index number of the APDU chunk.
+ * @param[in]     more
+ *   Whether more APDU chunk to be received or not.
+ * @param[in]     req_type
+ *   Request the transaction is received for, chunks of other requests are rejected.
+ *
+ * @return SW_OK with G_context.state set to STATE_PARSED after the last chunk or to STATE_TX_RECEIVING otherwise,
+ * error status word if the chunk is rejected.
+ *
+ */
+uint16_t transaction_receive_chunk(buffer_t *cdata, uint8_t chunk, bool more, request_type_e req_type);
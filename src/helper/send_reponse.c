@@ -18,33 +18,61 @@
 
 #include <stddef.h>  // size_t
 #include <stdint.h>  // uint*_t
-#include <string.h>  // memmove
 
 #include "send_response.h"
 #include "constants.h"
 #include "globals.h"
 #include "sw.h"
+#include "io.h"
+#include "response.h"
 #include "common/buffer.h"
+#include "transaction/operation_ir.h"
 
 int helper_send_response_pubkey() {
-    uint8_t resp[1 + PUBKEY_LEN + 1 + WIF_LEN + CHAINCODE_LEN] = {0};
-    size_t offset = 0;
+    response_t response;
 
-    resp[offset++] = PUBKEY_LEN;
+    response_init(&response);
 
-    memmove(resp + offset, G_context.pk_info.raw_public_key, PUBKEY_LEN);
-    offset += PUBKEY_LEN;
+    if (!response_write_u8(&response, PUBKEY_LEN) ||                                    //
+        !response_write(&response, G_context.pk_info.raw_public_key, PUBKEY_LEN) ||     //
+        !response_write_u8(&response, WIF_LEN) ||                                       //
+        !response_write(&response, G_context.pk_info.wif, WIF_LEN) ||                   //
+        !response_write(&response, G_context.pk_info.chain_code, CHAINCODE_LEN)) {
+        return io_send_sw(SW_WRONG_RESPONSE_LENGTH);
+    }
 
-    resp[offset++] = WIF_LEN;
-    memmove(resp + offset, G_context.pk_info.wif, WIF_LEN);
-
-    offset += WIF_LEN;
-    memmove(resp + offset, G_context.pk_info.chain_code, CHAINCODE_LEN);
-    offset += CHAINCODE_LEN;
-
-    return io_send_response(&(const buffer_t){.ptr = resp, .size = offset, .offset = 0}, SW_OK);
+    return response_send(&response, SW_OK);
 }
 
 int helper_send_response_sig(const uint8_t *signature, size_t sig_len) {
     return io_send_response(&(const buffer_t){.ptr = signature, .size = sig_len, .offset = 0}, SW_OK);
 }
+
+int helper_send_response_account() {
+    const transaction_ctx_t *tx = &G_context.tx_info;
+    response_t response;
+
+    response_init(&response);
+
+    if (!response_write(&response, tx->signature, SIGNATURE_LEN)) {
+        return io_send_sw(SW_WRONG_RESPONSE_LENGTH);
+    }
+
+    // keys are read back from the approved operation, in the order of its fields: owner, active, posting, memo
+    for (uint8_t i = 0; i < tx->ir.size; i++) {
+        buffer_t field = operation_ir_slice(tx->operation.ptr, &tx->ir.fields[i]);
+
+        if (tx->ir.fields[i].type == FIELD_TYPE_AUTHORITY) {
+            // single key of the authority follows weight_threshold (4), empty account_auths (1) and key_auths count (1)
+            field.offset = AUTHORITY_KEY_OFFSET;
+        } else if (tx->ir.fields[i].type != FIELD_TYPE_PUBLIC_KEY) {
+            continue;
+        }
+
+        if (!response_write(&response, field.ptr + field.offset, PUBKEY_COMPRESSED_LEN)) {
+            return io_send_sw(SW_WRONG_RESPONSE_LENGTH);
+        }
+    }
+
+    return response_send(&response, SW_OK);
+}
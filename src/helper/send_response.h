@@ -13,6 +13,11 @@
  */
 #define PUBKEY_LEN (MEMBER_SIZE(pubkey_ctx_t, raw_public_key))
 
+/**
+ * Offset of the first key in serialized authority with empty account_auths.
+ */
+#define AUTHORITY_KEY_OFFSET (sizeof(uint32_t) + 1 + 1)
+
 /**
  * Helper to send APDU response with public key, it's wif representation and chain code.
  *
@@ -38,3 +43,17 @@ int helper_send_response_pubkey(void);
  *
  */
 int helper_send_response_sig(const uint8_t *signature, size_t sig_len);
+
+/**
+ * Helper to send APDU response with compact signature of account creation transaction and public keys of the new account
+ *
+ * response = G_context.tx_info.signature(65) ||
+ *            owner (PUBKEY_COMPRESSED_LEN) ||
+ *            active (PUBKEY_COMPRESSED_LEN) ||
+ *            posting (PUBKEY_COMPRESSED_LEN) ||
+ *            memo (PUBKEY_COMPRESSED_LEN)
+ *
+ * @return zero or positive integer if success, -1 otherwise.
+ *
+ */
+int helper_send_response_account(void);
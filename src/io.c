@@ -25,6 +25,7 @@
 #include "sw.h"
 #include "common/buffer.h"
 #include "common/write.h"
+#include "transaction/last_signature.h"
 
 uint32_t G_output_len = 0;
 
@@ -49,6 +50,7 @@ uint8_t io_event(uint8_t channel) {
             UX_DISPLAYED_EVENT({});
             break;
         case SEPROXYHAL_TAG_TICKER_EVENT:
+            last_signature_tick();
             UX_TICKER_EVENT(G_io_seproxyhal_spi_buffer, {});
             break;
         default:
@@ -109,20 +111,28 @@ int io_recv_command() {
 }
 
 int io_send_response(const buffer_t *rdata, uint16_t sw) {
+    if (rdata == NULL) {
+        return io_send_response_length(0, sw);
+    }
+
+    if (rdata->size - rdata->offset > IO_APDU_BUFFER_SIZE - 2 ||  //
+        !buffer_copy(rdata, G_io_apdu_buffer, sizeof(G_io_apdu_buffer))) {
+        return io_send_sw(SW_WRONG_RESPONSE_LENGTH);
+    }
+
+    return io_send_response_length(rdata->size - rdata->offset, sw);
+}
+
+int io_send_response_length(size_t length, uint16_t sw) {
     int ret = 0;
 
-    if (rdata != NULL) {
-        if (rdata->size - rdata->offset > IO_APDU_BUFFER_SIZE - 2 ||  //
-            !buffer_copy(rdata, G_io_apdu_buffer, sizeof(G_io_apdu_buffer))) {
-            return io_send_sw(SW_WRONG_RESPONSE_LENGTH);
-        }
-        G_output_len = rdata->size - rdata->offset;
-        PRINTF("<= SW=%04X | RData=%.*H\n", sw, rdata->size, rdata->ptr);
-    } else {
-        G_output_len = 0;
-        PRINTF("<= SW=%04X | RData=\n", sw);
+    if (length > IO_APDU_BUFFER_SIZE - 2) {
+        return io_send_sw(SW_WRONG_RESPONSE_LENGTH);
     }
 
+    G_output_len = length;
+    PRINTF("<= SW=%04X | RData=%.*H\n", sw, length, G_io_apdu_buffer);
+
     write_u16_be(G_io_apdu_buffer, G_output_len, sw);
     G_output_len += 2;
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "ux.h"
@@ -43,6 +44,16 @@ int io_recv_command(void);
  */
 int io_send_response(const buffer_t *rdata, uint16_t sw);
 
+/**
+ * Send APDU response whose data has already been written at the beginning of G_io_apdu_buffer.
+ * @param[in] length
+ *   Length of response data.
+ * @param[in] sw
+ *   Status word of APDU response.
+ * @return zero or positive integer if success, -1 otherwise.
+ */
+int io_send_response_length(size_t length, uint16_t sw);
+
 /**
  * Send APDU response (only status word) by filling
  * G_io_apdu_buffer.
@@ -28,6 +28,7 @@
 #include "ui/menu.h"
 #include "apdu/parser.h"
 #include "apdu/dispatcher.h"
+#include "perf.h"
 
 /**
  * Handle APDU command received and send back APDU response using handlers.
@@ -45,6 +46,9 @@ void app_main() {
     // Reset context
     explicit_bzero(&G_context, sizeof(G_context));
 
+    // Stack high-water mark of every command is measured in debug builds
+    PERF_STACK_PAINT();
+
     for (;;) {
         BEGIN_TRY {
             TRY {
@@ -63,6 +67,8 @@ void app_main() {
                     continue;
                 }
 
+                PERF_STATS_COMMAND(cmd.ins);
+
                 PRINTF("=> CLA=%02X | INS=%02X | P1=%02X | P2=%02X | Lc=%02X | CData=%.*H\n", cmd.cla, cmd.ins, cmd.p1, cmd.p2, cmd.lc, cmd.lc, cmd.data);
 
                 // Dispatch structured APDU command to handler
@@ -118,7 +124,10 @@ __attribute__((section(".boot"))) int main() {
 #endif  // TARGET_NANOX
 
                 if (N_settings.initialized != 0x01) {
-                    settings_t settings = {.initialized = 0x01, .sign_hash_policy = DISABLED};
+                    settings_t settings = {.initialized = 0x01,
+                                           .sign_hash_policy = DISABLED,
+                                           .session_signing_policy = SESSION_SIGNING_DISABLED,
+                                           .summary_review_policy = SUMMARY_REVIEW_DISABLED};
                     nvm_write((void *) &N_settings, (void *) &settings, sizeof(settings_t));
                 }
 
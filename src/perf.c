@@ -0,0 +1,116 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>  // uint8_t
+
+#include "perf.h"
+
+#ifdef HAVE_PERF_MARKERS
+
+volatile uint8_t G_perf_phase;
+
+__attribute__((noinline)) void perf_marker(perf_phase_e phase, bool begin) {
+    // store keeps the call from being optimized out, its address is what the plugin looks for
+    G_perf_phase = begin ? (uint8_t) phase : 0;
+}
+
+#endif
+
+#ifdef HAVE_PERF_STATS
+
+perf_stats_t G_perf_stats;
+
+void perf_stats_signature(uint32_t retries) {
+    if (retries >= PERF_SIGN_RETRY_BUCKETS) {
+        retries = PERF_SIGN_RETRY_BUCKETS - 1;
+    }
+    G_perf_stats.sign_retries[retries]++;
+}
+
+void perf_stats_tx_length(size_t length) {
+    if (length > G_perf_stats.tx_peak) {
+        G_perf_stats.tx_peak = (uint32_t) length;
+    }
+}
+
+#ifndef NATIVE
+
+/**
+ * Stack bounds provided by the SDK linker script, the stack grows down from _estack
+ */
+extern uint8_t _stack;
+extern uint8_t _estack;
+
+#define STACK_PATTERN 0xA5
+// first word holds the stack canary checked by the OS, it must stay untouched
+#define STACK_BOTTOM (&_stack + sizeof(uint32_t))
+// bytes below the current frame left unpainted
+#define STACK_MARGIN 64
+
+__attribute__((noinline)) void perf_stack_paint(void) {
+    volatile uint8_t frame = 0;
+
+    // volatile writes keep the loop from being turned into a memset call, which would need stack of its own
+    for (volatile uint8_t *p = STACK_BOTTOM; p < &frame - STACK_MARGIN; p++) {
+        *p = STACK_PATTERN;
+    }
+}
+
+uint32_t perf_stack_size(void) {
+    return (uint32_t) (&_estack - &_stack);
+}
+
+static uint32_t perf_stack_used(void) {
+    const uint8_t *p = STACK_BOTTOM;
+
+    while (p < &_estack && *p == STACK_PATTERN) {
+        p++;
+    }
+
+    return (uint32_t) (&_estack - p);
+}
+
+#else
+
+void perf_stack_paint(void) {
+}
+
+uint32_t perf_stack_size(void) {
+    return 0;
+}
+
+static uint32_t perf_stack_used(void) {
+    return 0;
+}
+
+#endif
+
+void perf_stats_command(uint8_t ins) {
+    static uint8_t command_ins;
+    const uint32_t used = perf_stack_used();
+
+    G_perf_stats.stack_ins = command_ins;
+    G_perf_stats.stack_last = used;
+    if (used > G_perf_stats.stack_peak) {
+        G_perf_stats.stack_peak = used;
+    }
+
+    command_ins = ins;
+    perf_stack_paint();
+}
+
+#endif
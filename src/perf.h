@@ -0,0 +1,134 @@
+#pragma once
+
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+#include <stdint.h>   // uint*_t
+
+/**
+ * Phases of the signing flows measured by the instruction counting suite (see perf/).
+ * Identifiers are reported by the QEMU plugin, keep them in sync with PHASES of perf/run.py.
+ */
+typedef enum {
+    PERF_CHUNK_RECEIVE = 1,      /// copying and hashing of received APDU chunk
+    PERF_TRANSACTION_PARSE = 2,  /// transaction_parse of the whole transaction
+    PERF_REVIEW_STEP = 3,        /// decoding of single field page displayed during review
+    PERF_HASH_FINAL = 4,         /// cx_hash_final of the transaction digest
+    PERF_SIGN_DIGEST = 5,        /// crypto_sign_digest including canonical retries
+    PERF_SIGN_ATTEMPT = 6        /// single signature attempt within crypto_sign_digest
+} perf_phase_e;
+
+#ifdef HAVE_PERF_MARKERS
+
+/**
+ * Mark beginning or end of a phase. Calls are intercepted by the instruction counting plugin which reads
+ * arguments from registers, the function itself does nothing useful.
+ *
+ * @param[in] phase
+ *   Measured phase.
+ * @param[in] begin
+ *   true at the beginning of the phase, false at the end.
+ *
+ */
+void perf_marker(perf_phase_e phase, bool begin);
+
+#define PERF_BEGIN(phase) perf_marker(phase, true)
+#define PERF_END(phase) perf_marker(phase, false)
+
+#else
+
+#define PERF_BEGIN(phase)
+#define PERF_END(phase)
+
+#endif
+
+/**
+ * Number of buckets of the canonical signature retry histogram, the last one counts all higher retry counts.
+ */
+#define PERF_SIGN_RETRY_BUCKETS 8
+
+#ifdef HAVE_PERF_STATS
+
+/**
+ * Counters accumulated since app start, reported by GET_PERF_STATS in debug builds.
+ */
+typedef struct {
+    uint32_t transactions;                           /// parsed transactions
+    uint32_t hash_calls;                             /// cx_hash calls updating transaction digest
+    uint32_t hash_bytes;                             /// bytes hashed into transaction digest
+    uint32_t reviews;                                /// transaction reviews displayed
+    uint32_t decoder_calls;                          /// decoder invocations while rendering review screens
+    uint32_t wif_conversions;                        /// public keys converted to WIF
+    uint32_t tx_peak;                                /// longest transaction buffered in G_context
+    uint32_t sign_retries[PERF_SIGN_RETRY_BUCKETS];  /// signatures by number of canonical retries
+    uint32_t stack_ins;                              /// INS of the last completed command
+    uint32_t stack_last;                             /// stack high-water mark of the last completed command
+    uint32_t stack_peak;                             /// highest stack high-water mark of any command
+} perf_stats_t;
+
+extern perf_stats_t G_perf_stats;
+
+/**
+ * Record signature produced by crypto_sign_digest.
+ *
+ * @param[in] retries
+ *   Number of non-canonical signatures discarded before.
+ *
+ */
+void perf_stats_signature(uint32_t retries);
+
+/**
+ * Record length of transaction buffered in G_context.
+ *
+ * @param[in] length
+ *   Bytes of transaction received so far.
+ *
+ */
+void perf_stats_tx_length(size_t length);
+
+/**
+ * Paint stack below the current frame with a known pattern, so the high-water mark can be found later.
+ *
+ */
+void perf_stack_paint(void);
+
+/**
+ * Size of the whole application stack.
+ *
+ * @return stack size in bytes, 0 where the stack bounds are unknown (native build).
+ *
+ */
+uint32_t perf_stack_size(void);
+
+/**
+ * Record stack high-water mark of the previous command and repaint the stack for the next one. Called when a new
+ * command is received, so the mark includes UI flow and signing done after the previous command was dispatched.
+ *
+ * @param[in] ins
+ *   INS of the received command.
+ *
+ */
+void perf_stats_command(uint8_t ins);
+
+#define PERF_STATS_TRANSACTION() (G_perf_stats.transactions++)
+#define PERF_STATS_HASH(length) (G_perf_stats.hash_calls++, G_perf_stats.hash_bytes += (length))
+#define PERF_STATS_REVIEW() (G_perf_stats.reviews++)
+#define PERF_STATS_DECODER() (G_perf_stats.decoder_calls++)
+#define PERF_STATS_WIF() (G_perf_stats.wif_conversions++)
+#define PERF_STATS_SIGNATURE(retries) perf_stats_signature(retries)
+#define PERF_STATS_TX_LENGTH(length) perf_stats_tx_length(length)
+#define PERF_STACK_PAINT() perf_stack_paint()
+#define PERF_STATS_COMMAND(ins) perf_stats_command(ins)
+
+#else
+
+#define PERF_STATS_TRANSACTION()
+#define PERF_STATS_HASH(length)
+#define PERF_STATS_REVIEW()
+#define PERF_STATS_DECODER()
+#define PERF_STATS_WIF()
+#define PERF_STATS_SIGNATURE(retries)
+#define PERF_STATS_TX_LENGTH(length)
+#define PERF_STACK_PAINT()
+#define PERF_STATS_COMMAND(ins)
+
+#endif
@@ -0,0 +1,101 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <string.h>  // memmove
+
+#include "os.h"
+
+#include "response.h"
+#include "io.h"
+#include "sw.h"
+#include "common/write.h"
+
+static response_producer_cb g_producer = NULL;
+
+void response_init(response_t *response) {
+    response->ptr = G_io_apdu_buffer;
+    response->size = sizeof(G_io_apdu_buffer) - 2;
+    response->offset = 0;
+}
+
+size_t response_remaining(const response_t *response) {
+    return response->size - response->offset;
+}
+
+bool response_write(response_t *response, const void *data, size_t length) {
+    if (length > response_remaining(response)) {
+        return false;
+    }
+
+    memmove(response->ptr + response->offset, data, length);
+    response->offset += length;
+
+    return true;
+}
+
+bool response_write_u8(response_t *response, uint8_t value) {
+    return response_write(response, &value, sizeof(value));
+}
+
+bool response_write_u32_be(response_t *response, uint32_t value) {
+    if (response_remaining(response) < sizeof(value)) {
+        return false;
+    }
+
+    write_u32_be(response->ptr, response->offset, value);
+    response->offset += sizeof(value);
+
+    return true;
+}
+
+int response_send(const response_t *response, uint16_t sw) {
+    return io_send_response_length(response->offset, sw);
+}
+
+int response_send_chained(response_producer_cb producer) {
+    g_producer = producer;
+
+    return response_send_next_part();
+}
+
+int response_send_next_part() {
+    response_producer_cb producer = g_producer;
+    response_t part;
+
+    if (producer == NULL) {
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    // producer stays registered only when it asks for another part, so an exception thrown by it ends the response
+    g_producer = NULL;
+
+    response_init(&part);
+    uint16_t sw = producer(&part);
+
+    if (sw == SW_MORE_DATA) {
+        if (part.offset == 0) {
+            return io_send_sw(SW_WRONG_RESPONSE_LENGTH);
+        }
+        g_producer = producer;
+    }
+
+    return response_send(&part, sw);
+}
+
+void response_cancel() {
+    g_producer = NULL;
+}
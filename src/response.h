@@ -0,0 +1,126 @@
+#pragma once
+
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+#include <stdint.h>   // uint*_t
+
+/**
+ * Response writer, data is serialized straight into G_io_apdu_buffer. Command data is received in the same buffer,
+ * handlers have to be done reading it before the first write.
+ */
+typedef struct {
+    uint8_t *ptr;   /// response data, i.e. G_io_apdu_buffer
+    size_t size;    /// room for response data, status word excluded
+    size_t offset;  /// length of data written so far
+} response_t;
+
+/**
+ * Producer of chained response, called for the first part and then once for every GET_RESPONSE command. Producer
+ * keeps its own position in the data and writes as much of the rest as the part has room for.
+ *
+ * @param[in, out] part
+ *   Writer of the part, empty on entry.
+ *
+ * @return SW_MORE_DATA if more parts follow, status word of the whole response otherwise.
+ *
+ */
+typedef uint16_t (*response_producer_cb)(response_t *part);
+
+/**
+ * Start empty response in G_io_apdu_buffer.
+ *
+ * @param[out] response
+ *   Pointer to response writer.
+ *
+ */
+void response_init(response_t *response);
+
+/**
+ * Room left in the response.
+ *
+ * @param[in] response
+ *   Pointer to response writer.
+ *
+ * @return number of bytes which can still be written.
+ *
+ */
+size_t response_remaining(const response_t *response);
+
+/**
+ * Append bytes to the response.
+ *
+ * @param[in, out] response
+ *   Pointer to response writer.
+ * @param[in]      data
+ *   Pointer to data.
+ * @param[in]      length
+ *   Length of data.
+ *
+ * @return true if success, false if data does not fit (nothing is written).
+ *
+ */
+bool response_write(response_t *response, const void *data, size_t length);
+
+/**
+ * Append single byte to the response.
+ *
+ * @param[in, out] response
+ *   Pointer to response writer.
+ * @param[in]      value
+ *   Byte to write.
+ *
+ * @return true if success, false if response is full.
+ *
+ */
+bool response_write_u8(response_t *response, uint8_t value);
+
+/**
+ * Append 32-bit unsigned integer as Big Endian to the response.
+ *
+ * @param[in, out] response
+ *   Pointer to response writer.
+ * @param[in]      value
+ *   Integer to write.
+ *
+ * @return true if success, false if it does not fit.
+ *
+ */
+bool response_write_u32_be(response_t *response, uint32_t value);
+
+/**
+ * Send response written with the writer, without copying its data.
+ *
+ * @param[in] response
+ *   Pointer to response writer.
+ * @param[in] sw
+ *   Status word of APDU response.
+ *
+ * @return zero or positive integer if success, -1 otherwise.
+ *
+ */
+int response_send(const response_t *response, uint16_t sw);
+
+/**
+ * Send first part of chained response, next parts are produced on GET_RESPONSE commands.
+ *
+ * @param[in] producer
+ *   Producer of response data.
+ *
+ * @return zero or positive integer if success, -1 otherwise.
+ *
+ */
+int response_send_chained(response_producer_cb producer);
+
+/**
+ * Send next part of chained response (GET_RESPONSE command).
+ *
+ * @return zero or positive integer if success, -1 otherwise.
+ *
+ */
+int response_send_next_part(void);
+
+/**
+ * Abandon pending chained response, any command other than GET_RESPONSE does.
+ *
+ */
+void response_cancel(void);
@@ -4,6 +4,11 @@
  * Status word for success.
  */
 #define SW_OK 0x9000
+/**
+ * Status word for chained response, more data is available with GET_RESPONSE. SW2 is always 0x00 as the length of the
+ * rest is not known before it is produced.
+ */
+#define SW_MORE_DATA 0x6100
 /**
  * Status word for denied by user.
  */
@@ -60,3 +65,39 @@
  * Status word for hash parsing fail.
  */
 #define SW_HASH_PARSING_FAIL 0xB008
+/**
+ * Status word for trying to set session policy with session signing disabled in settings.
+ */
+#define SW_SESSION_SIGNING_DISABLED 0xB009
+/**
+ * Status word for session policy parsing fail.
+ */
+#define SW_SESSION_POLICY_PARSING_FAIL 0xB00A
+/**
+ * Status word for message parsing fail.
+ */
+#define SW_MESSAGE_PARSING_FAIL 0xB00B
+/**
+ * Status word for shared secrets request parsing fail.
+ */
+#define SW_ECDH_PARSING_FAIL 0xB00C
+/**
+ * Status word for encrypted memo parsing fail.
+ */
+#define SW_MEMO_PARSING_FAIL 0xB00D
+/**
+ * Status word for memo decryption fail (wrong key, checksum or padding).
+ */
+#define SW_MEMO_DECRYPTION_FAIL 0xB00E
+/**
+ * Status word for no signature of the digest kept on the device (expired, never produced or signed with other key).
+ */
+#define SW_LAST_SIGNATURE_NOT_FOUND 0xB00F
+/**
+ * Status word for account creation request parsing fail.
+ */
+#define SW_ACCOUNT_PARSING_FAIL 0xB010
+/**
+ * Status word for key ownership index configuration parsing fail.
+ */
+#define SW_KEY_INDEX_PARSING_FAIL 0xB011
@@ -0,0 +1,272 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "account_create.h"
+#include "constants.h"
+#include "common/buffer.h"
+#include "common/bip32.h"
+#include "common/write.h"
+
+#define MIN_HIVE_ACCOUNT_NAME_LEN 3
+#define TLV_OCTET_STRING          0x04
+#define TLV_LONG_LENGTH           0x81
+
+/**
+ * Check a single dot separated segment of account name, i.e. "alice" of "alice.test"
+ */
+static bool is_valid_name_segment(const char *segment, size_t length) {
+    if (length < MIN_HIVE_ACCOUNT_NAME_LEN || segment[0] < 'a' || segment[0] > 'z') {
+        return false;
+    }
+
+    for (size_t i = 1; i < length; i++) {
+        const char c = segment[i];
+        const bool is_alnum = (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9');
+
+        if (!is_alnum && (c != '-' || i == length - 1)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Check account name the way Hive does, 3 to 16 characters in segments starting with a letter
+ */
+static bool is_valid_account_name(const char *name) {
+    const size_t length = strlen(name);
+    size_t start = 0;
+
+    if (length < MIN_HIVE_ACCOUNT_NAME_LEN || length > MAX_HIVE_ACCOUNT_NAME_LEN) {
+        return false;
+    }
+
+    for (size_t i = 0; i <= length; i++) {
+        if (i == length || name[i] == '.') {
+            if (!is_valid_name_segment(name + start, i - start)) {
+                return false;
+            }
+            start = i + 1;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Read length prefixed account name into null terminated output buffer
+ */
+static bool read_account_name(buffer_t *buf, char out[static MAX_HIVE_ACCOUNT_NAME_LEN + 1]) {
+    uint8_t length;
+
+    if (!buffer_read_u8(buf, &length) || length > MAX_HIVE_ACCOUNT_NAME_LEN ||
+        !buffer_move_partial(buf, (uint8_t *) out, MAX_HIVE_ACCOUNT_NAME_LEN, length)) {
+        return false;
+    }
+
+    out[length] = '\0';
+
+    return is_valid_account_name(out);
+}
+
+parser_status_e account_request_parse(buffer_t *buf, account_request_t *request) {
+    memset(request, 0, sizeof(account_request_t));
+
+    /* Parse:
+     *  - BIP32 path of the creator key
+     */
+    if (!buffer_read_u8(buf, &request->bip32_path_len) || !buffer_read_bip32_path(buf, request->bip32_path, (size_t) request->bip32_path_len)) {
+        return BIP32_PATH_PARSING_ERROR;
+    }
+
+    /* Parse:
+     *  - chain id
+     *  - ref_block_num, ref_block_prefix and expiration, as serialized in the transaction
+     *  - operation number
+     */
+    if (!buffer_move_partial(buf, request->chain_id, sizeof(request->chain_id), sizeof(request->chain_id)) ||
+        !buffer_move_partial(buf, request->header, sizeof(request->header), sizeof(request->header)) || !buffer_read_u8(buf, &request->operation)) {
+        return FIELD_PARSING_ERROR;
+    }
+
+    /* Parse operation specific fields:
+     *  - account_create: fee
+     *  - create_claimed_account: none, account was claimed in advance
+     */
+    switch (request->operation) {
+        case OPERATION_ACCOUNT_CREATE:
+            if (!buffer_move_partial(buf, (uint8_t *) &request->fee, sizeof(asset_t), sizeof(asset_t))) {
+                return FIELD_PARSING_ERROR;
+            }
+            break;
+        case OPERATION_CREATE_CLAIMED_ACCOUNT:
+            break;
+        default:
+            return FIELD_PARSING_ERROR;
+    }
+
+    /* Parse:
+     *  - creator
+     *  - new account name
+     *  - account index of the new keys
+     */
+    if (!read_account_name(buf, request->creator) || !read_account_name(buf, request->new_account_name) ||
+        !buffer_read_u32(buf, &request->account_index, BE) || request->account_index >= 0x80000000) {
+        return FIELD_PARSING_ERROR;
+    }
+
+    return (buf->offset == buf->size) ? PARSING_OK : WRONG_LENGTH_ERROR;
+}
+
+void account_key_path(uint32_t account_index, uint32_t role, uint32_t bip32_path[static ACCOUNT_KEY_PATH_LEN]) {
+    bip32_path[0] = 0x80000030;  // 48'
+    bip32_path[1] = 0x8000000D;  // 13'
+    bip32_path[2] = role;
+    bip32_path[3] = 0x80000000 | account_index;
+    bip32_path[4] = 0x80000000;  // 0'
+}
+
+/**
+ * Output of the serialized transaction
+ */
+typedef struct {
+    uint8_t *ptr;
+    size_t size;
+    size_t offset;
+} writer_t;
+
+static bool write_bytes(writer_t *out, const void *data, size_t length) {
+    if (length > out->size - out->offset) {
+        return false;
+    }
+
+    memmove(out->ptr + out->offset, data, length);
+    out->offset += length;
+
+    return true;
+}
+
+static bool write_u8(writer_t *out, uint8_t value) {
+    return write_bytes(out, &value, 1);
+}
+
+/**
+ * Write short field as TLV, as done by the host for SIGN_TRANSACTION
+ */
+static bool write_tlv(writer_t *out, const void *data, uint8_t length) {
+    return write_u8(out, TLV_OCTET_STRING) && write_u8(out, length) && write_bytes(out, data, length);
+}
+
+/**
+ * Write string with its length prefix, account names are shorter than 128 so the varint is a single byte
+ */
+static bool write_string(writer_t *out, const char *value) {
+    const uint8_t length = (uint8_t) strlen(value);
+
+    return write_u8(out, length) && write_bytes(out, value, length);
+}
+
+/**
+ * Write authority with a single key: weight_threshold (4), account_auths (empty), key_auths (single key with weight 1)
+ */
+static bool write_authority(writer_t *out, const uint8_t key[static PUBKEY_COMPRESSED_LEN]) {
+    uint8_t weight[sizeof(uint32_t)];
+
+    write_u32_le(weight, 0, 1);
+
+    return write_bytes(out, weight, sizeof(uint32_t)) && write_u8(out, 0) && write_u8(out, 1) && write_bytes(out, key, PUBKEY_COMPRESSED_LEN) &&
+           write_bytes(out, weight, sizeof(uint16_t));
+}
+
+/**
+ * Write operation, keys are in the order of their fields: owner, active, posting, memo
+ */
+static bool write_operation(writer_t *out, const account_request_t *request, const uint8_t keys[ACCOUNT_KEYS_COUNT][PUBKEY_COMPRESSED_LEN]) {
+    if (!write_u8(out, request->operation)) {
+        return false;
+    }
+
+    if (request->operation == OPERATION_ACCOUNT_CREATE && !write_bytes(out, &request->fee, sizeof(asset_t))) {
+        return false;
+    }
+
+    if (!write_string(out, request->creator) || !write_string(out, request->new_account_name) || !write_authority(out, keys[0]) ||
+        !write_authority(out, keys[1]) || !write_authority(out, keys[2]) || !write_bytes(out, keys[3], PUBKEY_COMPRESSED_LEN)) {
+        return false;
+    }
+
+    // empty json_metadata, create_claimed_account is followed by empty extensions
+    return write_u8(out, 0) && (request->operation != OPERATION_CREATE_CLAIMED_ACCOUNT || write_u8(out, 0));
+}
+
+/**
+ * Write BIP32 path and transaction fields as TLV, as done by the host for SIGN_TRANSACTION
+ */
+static bool write_transaction(writer_t *out, const account_request_t *request, const uint8_t keys[ACCOUNT_KEYS_COUNT][PUBKEY_COMPRESSED_LEN]) {
+    const uint8_t operations_count = 1;
+    const uint8_t extensions_count = 0;
+
+    if (!write_u8(out, request->bip32_path_len)) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < request->bip32_path_len; i++) {
+        uint8_t index[sizeof(uint32_t)];
+
+        write_u32_be(index, 0, request->bip32_path[i]);
+        if (!write_bytes(out, index, sizeof(index))) {
+            return false;
+        }
+    }
+
+    if (!write_tlv(out, request->chain_id, CHAIN_ID_LEN) || !write_tlv(out, request->header, 2) || !write_tlv(out, request->header + 2, 4) ||
+        !write_tlv(out, request->header + 6, 4) || !write_tlv(out, &operations_count, 1)) {
+        return false;
+    }
+
+    // operation is always longer than 127 and shorter than 256 bytes, its length takes two bytes
+    if (!write_u8(out, TLV_OCTET_STRING) || !write_u8(out, TLV_LONG_LENGTH) || !write_u8(out, 0)) {
+        return false;
+    }
+
+    const size_t start = out->offset;
+    if (!write_operation(out, request, keys)) {
+        return false;
+    }
+
+    const size_t length = out->offset - start;
+    if (length < 0x80 || length > 0xFF) {
+        return false;
+    }
+    out->ptr[start - 1] = (uint8_t) length;
+
+    return write_tlv(out, &extensions_count, 1);
+}
+
+size_t account_create_serialize(const account_request_t *request,
+                               const uint8_t keys[ACCOUNT_KEYS_COUNT][PUBKEY_COMPRESSED_LEN],
+                               uint8_t *out,
+                               size_t out_len) {
+    writer_t writer = {.ptr = out, .size = out_len, .offset = 0};
+
+    return write_transaction(&writer, request, keys) ? writer.offset : 0;
+}
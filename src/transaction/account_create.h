@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "types.h"
+#include "common/buffer.h"
+
+/**
+ * Operation number of account_create operation
+ */
+#define OPERATION_ACCOUNT_CREATE 9
+
+/**
+ * Operation number of create_claimed_account operation
+ */
+#define OPERATION_CREATE_CLAIMED_ACCOUNT 23
+
+/**
+ * Length of SLIP-48 path of a key of the new account: 48'/13'/role'/account'/0'
+ */
+#define ACCOUNT_KEY_PATH_LEN 5
+
+/**
+ * Parse account creation request sent with CREATE_ACCOUNT command
+ *
+ * @param[in] buf
+ *  Pointer to buffer with creator BIP32 path, chain id, transaction header and operation parameters
+ * @param[out] request
+ *  Pointer to request structure to fill
+ * @return PARSING_OK if success, error status otherwise.
+ */
+parser_status_e account_request_parse(buffer_t *buf, account_request_t *request);
+
+/**
+ * Build SLIP-48 path of a key of the new account
+ *
+ * @param[in] account_index
+ *  Account index of the new keys, not hardened
+ * @param[in] role
+ *  Hardened key role, i.e. OWNER_KEY_ROLE
+ * @param[out] bip32_path
+ *  Path of ACCOUNT_KEY_PATH_LEN indices
+ */
+void account_key_path(uint32_t account_index, uint32_t role, uint32_t bip32_path[static ACCOUNT_KEY_PATH_LEN]);
+
+/**
+ * Serialize account creation transaction in the format of SIGN_TRANSACTION command data, so it is parsed and hashed
+ * the same way as a transaction sent by the host. Every authority of the new account is its single key.
+ *
+ * @param[in] request
+ *  Pointer to parsed account creation request
+ * @param[in] keys
+ *  Compressed owner, active, posting and memo public keys of the new account
+ * @param[out] out
+ *  Pointer to output buffer
+ * @param[in] out_len
+ *  Length of output buffer
+ * @return length of the serialized transaction, 0 if it does not fit the output buffer
+ */
+size_t account_create_serialize(const account_request_t *request,
+                               const uint8_t keys[ACCOUNT_KEYS_COUNT][PUBKEY_COMPRESSED_LEN],
+                               uint8_t *out,
+                               size_t out_len);
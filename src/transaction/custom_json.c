@@ -0,0 +1,215 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <string.h>
+
+#include "os.h"
+
+#include "custom_json.h"
+#include "field.h"
+#include "common/json.h"
+#include "common/macros.h"
+
+#define MAX_RENDERER_PATHS 7
+
+/**
+ * Render values found at renderer paths, values missing in the payload have JSON_TOKEN_NONE type
+ */
+typedef bool renderer_t(const json_token_t *values, field_t *field);
+
+// ["follow", {"follower": "alice", "following": "bob", "what": ["blog"]}]
+// ["reblog", {"account": "alice", "author": "bob", "permlink": "post"}]
+enum { FOLLOW_ACTION, FOLLOW_FOLLOWER, FOLLOW_FOLLOWING, FOLLOW_WHAT, REBLOG_ACCOUNT, REBLOG_AUTHOR, REBLOG_PERMLINK };
+static const char *const FOLLOW_PATHS[] = {"0", "1.follower", "1.following", "1.what.0", "1.account", "1.author", "1.permlink"};
+
+// {"contractName": "tokens", "contractAction": "transfer", "contractPayload": {"symbol": "BEE", "to": "bob", ...}}
+enum { SSC_CONTRACT, SSC_ACTION, SSC_QUANTITY, SSC_SYMBOL, SSC_TO, SSC_PRICE, SSC_MEMO };
+static const char *const SSC_PATHS[] = {"contractName",
+                                        "contractAction",
+                                        "contractPayload.quantity",
+                                        "contractPayload.symbol",
+                                        "contractPayload.to",
+                                        "contractPayload.price",
+                                        "contractPayload.memo"};
+
+// ["delegate_rc", {"from": "alice", "delegatees": ["bob"], "max_rc": 1000000}]
+enum { RC_ACTION, RC_FROM, RC_DELEGATEES, RC_MAX_RC };
+static const char *const RC_PATHS[] = {"0", "1.from", "1.delegatees", "1.max_rc"};
+
+static bool is_string(const json_token_t *token) {
+    return token->type == JSON_TOKEN_STRING;
+}
+
+static bool is_scalar(const json_token_t *token) {
+    return token->type == JSON_TOKEN_STRING || token->type == JSON_TOKEN_PRIMITIVE;
+}
+
+static void append_token(field_t *field, const char *prefix, const json_token_t *token) {
+    field_append_string(field, prefix);
+    field_append(field, token->ptr, token->length);
+}
+
+/**
+ * Append array of account names as "@alice, @bob"
+ */
+static bool append_accounts(field_t *field, const json_token_t *array) {
+    json_token_t token;
+    json_t json;
+
+    json_init(&json, array->ptr, array->length);
+    if (!json_next(&json, &token) || token.type != JSON_TOKEN_ARRAY) {
+        return false;
+    }
+
+    uint16_t count = 0;
+    while (json_next(&json, &token) && token.type == JSON_TOKEN_STRING) {
+        append_token(field, count++ == 0 ? "@" : ", @", &token);
+    }
+
+    return token.type == JSON_TOKEN_END && count > 0;
+}
+
+static bool render_follow(const json_token_t *values, field_t *field) {
+    const json_token_t *what = &values[FOLLOW_WHAT];
+    const char *verb;
+
+    if (json_token_equal(&values[FOLLOW_ACTION], "follow")) {
+        if (!is_string(&values[FOLLOW_FOLLOWER]) || !is_string(&values[FOLLOW_FOLLOWING]) || values[REBLOG_ACCOUNT].type != JSON_TOKEN_NONE ||
+            values[REBLOG_AUTHOR].type != JSON_TOKEN_NONE || values[REBLOG_PERMLINK].type != JSON_TOKEN_NONE) {
+            return false;
+        }
+
+        if (what->key != NULL) {
+            // member named "0" of an object, not the first element of "what" array
+            return false;
+        } else if (what->type == JSON_TOKEN_NONE) {
+            verb = " unfollows @";
+        } else if (is_string(what) && json_token_equal(what, "blog")) {
+            verb = " follows @";
+        } else if (is_string(what) && json_token_equal(what, "ignore")) {
+            verb = " mutes @";
+        } else {
+            return false;
+        }
+
+        append_token(field, "@", &values[FOLLOW_FOLLOWER]);
+        append_token(field, verb, &values[FOLLOW_FOLLOWING]);
+        return true;
+    }
+
+    if (json_token_equal(&values[FOLLOW_ACTION], "reblog")) {
+        if (!is_string(&values[REBLOG_ACCOUNT]) || !is_string(&values[REBLOG_AUTHOR]) || !is_string(&values[REBLOG_PERMLINK]) ||
+            values[FOLLOW_FOLLOWER].type != JSON_TOKEN_NONE || values[FOLLOW_FOLLOWING].type != JSON_TOKEN_NONE || what->type != JSON_TOKEN_NONE) {
+            return false;
+        }
+
+        append_token(field, "@", &values[REBLOG_ACCOUNT]);
+        append_token(field, " reblogs @", &values[REBLOG_AUTHOR]);
+        append_token(field, "/", &values[REBLOG_PERMLINK]);
+        return true;
+    }
+
+    return false;
+}
+
+static bool render_ssc(const json_token_t *values, field_t *field) {
+    static const char *const prefixes[] = {"", " ", " ", " ", " to @", " at ", " memo: "};
+
+    if (!is_string(&values[SSC_CONTRACT]) || !is_string(&values[SSC_ACTION])) {
+        return false;
+    }
+
+    // i.e. "tokens transfer 1.000 BEE to @bob memo: thanks"
+    for (uint8_t i = 0; i < ARRAYLEN(SSC_PATHS); i++) {
+        if (values[i].type == JSON_TOKEN_NONE) {
+            continue;
+        }
+        if (!is_scalar(&values[i])) {
+            return false;
+        }
+        append_token(field, (const char *) PIC(prefixes[i]), &values[i]);
+    }
+
+    return true;
+}
+
+static bool render_rc(const json_token_t *values, field_t *field) {
+    if (!json_token_equal(&values[RC_ACTION], "delegate_rc") || !is_string(&values[RC_FROM]) || values[RC_MAX_RC].type != JSON_TOKEN_PRIMITIVE ||
+        values[RC_DELEGATEES].type != JSON_TOKEN_ARRAY) {
+        return false;
+    }
+
+    append_token(field, "@", &values[RC_FROM]);
+    append_token(field, " delegates ", &values[RC_MAX_RC]);
+    field_append_string(field, " RC to ");
+
+    return append_accounts(field, &values[RC_DELEGATEES]);
+}
+
+static const struct {
+    const char *id;
+    uint8_t root;  /// json_token_type_e of the payload, index paths would also match members named "0" or "1"
+    const char *const *paths;
+    uint8_t count;
+    renderer_t *render;
+} RENDERERS[] = {
+    {"follow", JSON_TOKEN_ARRAY, FOLLOW_PATHS, ARRAYLEN(FOLLOW_PATHS), &render_follow},
+    {"ssc-mainnet-hive", JSON_TOKEN_OBJECT, SSC_PATHS, ARRAYLEN(SSC_PATHS), &render_ssc},
+    {"rc", JSON_TOKEN_ARRAY, RC_PATHS, ARRAYLEN(RC_PATHS), &render_rc},
+};
+
+/**
+ * Get type of the payload root, JSON_TOKEN_NONE if the payload does not start with a valid token
+ */
+static uint8_t get_root_type(const char *json, size_t json_len) {
+    json_token_t token;
+    json_t tokenizer;
+
+    json_init(&tokenizer, json, json_len);
+
+    return json_next(&tokenizer, &token) ? token.type : JSON_TOKEN_NONE;
+}
+
+void custom_json_render(const char *id, size_t id_len, const char *json, size_t json_len, field_t *field) {
+    json_token_t values[MAX_RENDERER_PATHS];
+    const char *paths[MAX_RENDERER_PATHS];
+
+    for (uint8_t i = 0; i < ARRAYLEN(RENDERERS); i++) {
+        /* Use PIC macro to access const data (stored in .text area) */
+        const char *renderer_id = (const char *) PIC(RENDERERS[i].id);
+        if (strlen(renderer_id) != id_len || memcmp(renderer_id, id, id_len) != 0) {
+            continue;
+        }
+
+        const char *const *renderer_paths = (const char *const *) PIC(RENDERERS[i].paths);
+        for (uint8_t j = 0; j < RENDERERS[i].count; j++) {
+            paths[j] = (const char *) PIC(renderer_paths[j]);
+        }
+
+        renderer_t *render = (renderer_t *) PIC(RENDERERS[i].render);
+        if (get_root_type(json, json_len) == RENDERERS[i].root && json_find(json, json_len, paths, RENDERERS[i].count, values) &&
+            (*render)(values, field)) {
+            return;
+        }
+
+        // payload the renderer can not fully show is displayed raw
+        field_clear_value(field);
+        break;
+    }
+
+    field_append(field, json, json_len);
+}
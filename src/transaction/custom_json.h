@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "types.h"
+
+/**
+ * Render JSON payload of custom_json operation. Payloads of ids with a renderer ("follow", "ssc-mainnet-hive", "rc")
+ * are shown as a short sentence built from their few relevant members, i.e. "@alice follows @bob". Payloads of other
+ * ids, malformed payloads and payloads with members a renderer does not show are displayed raw.
+ *
+ * @param[in] id
+ *  Pointer to custom_json id, not null terminated
+ * @param[in] id_len
+ *  Length of the id
+ * @param[in] json
+ *  Pointer to JSON payload, not null terminated
+ * @param[in] json_len
+ *  Length of the payload
+ * @param[in,out] field
+ *  Pointer to the field with selected page, see field_reset
+ */
+void custom_json_render(const char *id, size_t id_len, const char *json, size_t json_len, field_t *field);
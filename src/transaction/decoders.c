@@ -22,6 +22,10 @@
 #include <stdlib.h>
 
 #include "decoders.h"
+#include "field.h"
+#include "names.h"
+#include "custom_json.h"
+#include "key_index.h"
 #include "globals.h"
 
 #include "common/macros.h"
@@ -29,107 +33,123 @@
 #include "common/wif.h"
 #include "common/read.h"
 #include "common/format.h"
+#include "perf.h"
 
 /* Hive specific decders to convert DER encoded data to user-friendly form */
 
-#define MAX_OPERATION_NUMBER 50
-#define MAX_OPERATION_NAME_LEN 29
 #define EXT_TYPE_BENEFICIARIES 0
 #define MAX_ACCOUNT_NAME_LEN 64
+#define MAX_ARRAY_STRING_LEN 50
+#define MAX_PROPERTY_KEY_LEN 64
+#define PROPERTY_PREVIEW_LEN 8
 
-const char operation_names[MAX_OPERATION_NUMBER][MAX_OPERATION_NAME_LEN] = {
-    "vote",                          // 0
-    "comment",                       // 1
-    "transfer",                      // 2
-    "transfer_to_vesting",           // 3
-    "withdraw_vesting",              // 4
-    "limit_order_create",            // 5
-    "limit_order_cancel",            // 6
-    "feed_publish",                  // 7
-    "convert",                       // 8
-    "account_create",                // 9
-    "account_update",                // 10
-    "witness_update",                // 11
-    "account_witness_vote",          // 12
-    "account_witness_proxy",         // 13
-    "",                              // 14
-    "",                              // 15
-    "",                              // 16
-    "delete_comment",                // 17
-    "custom_json",                   // 18
-    "comment_options",               // 19
-    "set_withdraw_vesting_route",    // 20
-    "",                              // 21
-    "claim_account",                 // 22
-    "create_claimed_account",        // 23
-    "request_account_recovery",      // 24
-    "recover_account",               // 25
-    "change_recovery_account",       // 26
-    "",                              // 27
-    "",                              // 28
-    "",                              // 29
-    "",                              // 30
-    "",                              // 31
-    "transfer_to_savings",           // 32
-    "transfer_from_savings",         // 33
-    "cancel_transfer_from_savings",  // 34
-    "",                              // 35
-    "decline_voting_rights",         // 36
-    "reset_account",                 // 37
-    "set_reset_account",             // 38
-    "claim_reward_balance",          // 39
-    "delegate_vesting_shares",       // 40
-    "",                              // 41
-    "",                              // 42
-    "",                              // 43
-    "create_proposal",               // 44
-    "update_proposal_votes",         // 45
-    "remove_proposal",               // 46
-    "update_proposal",               // 47
-    "collateralized_convert",        // 48
-    "recurrent_transfer",            // 49
+/**
+ * Witness property with known value type, sorted by key just like the serialized flat_map
+ */
+typedef struct {
+    const char *key;
+    uint16_t name;       /// offset of property name in the name pool
+    decoder_t *decoder;  /// decoder of the value
+    uint8_t count;       /// number of values read by the decoder, i.e. price is a pair of assets
+} witness_property_t;
+
+static const witness_property_t WITNESS_PROPERTIES[] = {
+    {"account_creation_fee", FIELD_NAME(ACC_CREATION_FEE), &decoder_asset, 1},
+    {"account_subsidy_budget", FIELD_NAME(SUBSIDY_BUDGET), &decoder_uint32, 1},
+    {"account_subsidy_decay", FIELD_NAME(SUBSIDY_DECAY), &decoder_uint32, 1},
+    {"hbd_exchange_rate", FIELD_NAME(HBD_EXCHANGE_RATE), &decoder_asset, 2},
+    {"hbd_interest_rate", FIELD_NAME(HBD_INTEREST_RATE), &decoder_weight, 1},
+    {"key", FIELD_NAME(SIGNING_KEY), &decoder_public_key, 1},
+    {"maximum_block_size", FIELD_NAME(MAX_BLOCK_SIZE), &decoder_uint32, 1},
+    {"new_signing_key", FIELD_NAME(NEW_SIGNING_KEY), &decoder_public_key, 1},
+    {"sbd_exchange_rate", FIELD_NAME(SBD_EXCHANGE_RATE), &decoder_asset, 2},
+    {"sbd_interest_rate", FIELD_NAME(SBD_INTEREST_RATE), &decoder_weight, 1},
+    {"url", FIELD_NAME(URL), &decoder_string, 1},
 };
 
-/** The only thing to do is to find the operation name in an array */
+void transaction_hash_update(const uint8_t *data, size_t length) {
+    PERF_STATS_HASH(length);
+    cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, data, length, NULL, 0);
+}
+
+/** The only thing to do is to find the operation name in the name pool */
 bool decoder_operation_name(buffer_t *buf, field_t *field, bool should_hash_only) {
     uint8_t op_nr;
 
-    if (!buffer_read_u8(buf, &op_nr)) {
+    if (!buffer_read_u8(buf, &op_nr) || operation_name(op_nr) == NULL) {
         return false;
     }
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, &op_nr, 1, NULL, 0);
+        transaction_hash_update(&op_nr, 1);
     } else {
-        snprintf(field->value, MEMBER_SIZE(field_t, value), "%s", operation_names[op_nr]);
+        field_clear_value(field);
+        field_append_string(field, operation_name(op_nr));
     }
     return true;
 }
 
 /**
- * Decode string which consist of [length] [n chars]
+ * Read length prefix of string which consist of [varint length] [n chars], hash it along with the characters (if requested)
  */
-bool decoder_string(buffer_t *buf, field_t *field, bool should_hash_only) {
-    uint8_t string_length;
-    if (!buffer_read_u8(buf, &string_length)) {
+static bool read_string_length(buffer_t *buf, bool should_hash, size_t max_length, uint32_t *string_length) {
+    size_t start = buf->offset;
+
+    if (!buffer_read_varint(buf, string_length) || *string_length >= max_length || !buffer_can_read(buf, *string_length)) {
         return false;
     }
 
-    char value[string_length + 1];
-    memset(value, 0, sizeof(value));
+    if (should_hash) {
+        transaction_hash_update(buf->ptr + start, buf->offset - start);
+        transaction_hash_update(buf->ptr + buf->offset, *string_length);
+    }
+
+    return true;
+}
 
-    if (!buffer_move_partial(buf, (uint8_t *) value, sizeof(value), string_length)) {
+/**
+ * Read string which consist of [varint length] [n chars] and append it straight from the buffer to the field value (if given)
+ */
+static bool read_string(buffer_t *buf, field_t *field, bool should_hash, size_t max_length) {
+    uint32_t string_length;
+    if (!read_string_length(buf, should_hash, max_length, &string_length)) {
         return false;
     }
 
-    value[string_length] = '\0';  // string end
+    if (field != NULL) {
+        field_append(field, (const char *) buf->ptr + buf->offset, string_length);
+    }
 
-    if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, &string_length, 1, NULL, 0);
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, (uint8_t *) value, string_length, NULL, 0);
-    } else {
-        snprintf(field->value, MEMBER_SIZE(field_t, value), "%s", value);
+    return buffer_seek_cur(buf, string_length);
+}
+
+/**
+ * Decode string which consist of [varint length] [n chars], strings longer than a page are reviewed page by page
+ */
+bool decoder_string(buffer_t *buf, field_t *field, bool should_hash_only) {
+    if (!should_hash_only) {
+        field_clear_value(field);
     }
-    return true;
+
+    return read_string(buf, should_hash_only ? NULL : field, should_hash_only, MAX_TRANSACTION_LEN);
+}
+
+/**
+ * Decode JSON payload of custom_json, displayed raw as it has no id to select a renderer. Operations under review are
+ * rendered with their id by operation_ir_render. The payload may span several APDU chunks of the transaction.
+ */
+bool decoder_custom_json(buffer_t *buf, field_t *field, bool should_hash_only) {
+    uint32_t json_length;
+
+    if (!read_string_length(buf, should_hash_only, MAX_TRANSACTION_LEN, &json_length)) {
+        return false;
+    }
+
+    if (!should_hash_only) {
+        field_clear_value(field);
+        custom_json_render(NULL, 0, (const char *) buf->ptr + buf->offset, json_length, field);
+    }
+
+    return buffer_seek_cur(buf, json_length);
 }
 
 bool decoder_array_of_strings(buffer_t *buf, field_t *field, bool should_hash_only) {
@@ -139,78 +159,62 @@ bool decoder_array_of_strings(buffer_t *buf, field_t *field, bool should_hash_on
     }
 
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, &size, sizeof(size), NULL, 0);
+        transaction_hash_update(&size, sizeof(size));
+    } else {
+        field_clear_value(field);
+        field_append_string(field, "[ ");
     }
 
-    uint32_t max_value_size = MEMBER_SIZE(field_t, value);
-
-    char value[max_value_size];
-    memset(value, 0, max_value_size);
-
-    char tmp[50];
-
-    snprintf(value, max_value_size, "[ ");
-
     for (uint8_t i = 0; i < size; i++) {
-        memset(tmp, 0, sizeof(tmp));
-
-        uint8_t string_length;
-        if (!buffer_read_u8(buf, &string_length) || string_length >= sizeof(tmp) || !buffer_move_partial(buf, (uint8_t *) tmp, sizeof(tmp), string_length)) {
+        if (!read_string(buf, should_hash_only ? NULL : field, should_hash_only, MAX_ARRAY_STRING_LEN)) {
             return false;
         }
 
-        if (should_hash_only) {
-            cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, &string_length, sizeof(string_length), NULL, 0);
-            cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, (uint8_t *) tmp, string_length, NULL, 0);
+        if (!should_hash_only && i != size - 1) {
+            field_append_string(field, ", ");
         }
-
-        snprintf(value + strlen(value), sizeof(value) - strlen(value), i == size - 1 ? "%s" : "%s, ", tmp);
     }
 
-    snprintf(value + strlen(value), sizeof(value) - strlen(value), " ]");
-
     if (!should_hash_only) {
-        snprintf(field->value, MEMBER_SIZE(field_t, value), "%s", value);
+        field_append_string(field, " ]");
     }
     return true;
 }
 
 bool decoder_array_of_u64(buffer_t *buf, field_t *field, bool should_hash_only) {
-    uint32_t max_value_size = MEMBER_SIZE(field_t, value);
     char u64_str[MAX_U64_LEN];
-    char value[max_value_size];
     uint8_t size;
     uint64_t proposal_id;
 
-    memset(value, 0, max_value_size);
-
     if (!buffer_read_u8(buf, &size)) {
         return false;
     }
 
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, (uint8_t *) &size, sizeof(size), NULL, 0);
+        transaction_hash_update((uint8_t *) &size, sizeof(size));
+    } else {
+        field_clear_value(field);
+        field_append_string(field, "[ ");
     }
 
-    snprintf(value, max_value_size, "[ ");
-
     for (uint8_t i = 0; i < size; i++) {
-        memset(u64_str, 0, 10);
+        memset(u64_str, 0, sizeof(u64_str));
         if (!buffer_read_u64(buf, &proposal_id, LE) || !format_u64(proposal_id, u64_str, ARRAYLEN(u64_str))) {
             return false;
         }
 
         if (should_hash_only) {
-            cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, (uint8_t *) &proposal_id, sizeof(proposal_id), NULL, 0);
+            transaction_hash_update((uint8_t *) &proposal_id, sizeof(proposal_id));
+        } else {
+            field_append_string(field, u64_str);
+            if (i != size - 1) {
+                field_append_string(field, ", ");
+            }
         }
-
-        snprintf(value + strlen(value), max_value_size - strlen(value), i == size - 1 ? "%s" : "%s, ", u64_str);
     }
 
-    snprintf(value + strlen(value), max_value_size - strlen(value), " ]");
-
     if (!should_hash_only) {
-        snprintf(field->value, MEMBER_SIZE(field_t, value), "%s", value);
+        field_append_string(field, " ]");
     }
     return true;
 }
@@ -225,9 +229,10 @@ bool decoder_boolean(buffer_t *buf, field_t *field, bool should_hash_only) {
     }
 
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, &value, 1, NULL, 0);
+        transaction_hash_update(&value, 1);
     } else {
-        snprintf(field->value, MEMBER_SIZE(field_t, value), "%s", value ? "true" : "false");
+        field_clear_value(field);
+        field_append_string(field, value ? "true" : "false");
     }
     return true;
 }
@@ -239,18 +244,42 @@ bool decoder_date_time(buffer_t *buf, field_t *field, bool should_hash_only) {
     }
 
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, (uint8_t *) &timestamp, sizeof(timestamp), NULL, 0);
+        transaction_hash_update((uint8_t *) &timestamp, sizeof(timestamp));
     } else {
+        field_clear_value(field);
         if (!format_timestamp(timestamp, field->value, MEMBER_SIZE(field_t, value))) {
             return false;
         }
+        field->length = strlen(field->value);
     }
     return true;
 }
 
+/**
+ * Append owner of a key derived on this device, i.e. " (this device, owner, account 0)", when the transaction review
+ * screens are rendered, nothing for other keys or callers
+ */
+static void append_key_owner(field_t *field, const uint8_t key[static PUBKEY_COMPRESSED_LEN]) {
+    if (!G_context.tx_info.label_own_keys) {
+        return;
+    }
+
+    const key_index_entry_t *entry = key_index_find(&G_key_index, key);
+    char tmp[48] = {0};
+
+    if (entry != NULL) {
+        snprintf(tmp,
+                 sizeof(tmp),
+                 " (this device, %s, account %u)",
+                 key_index_role_name(entry->role),
+                 (unsigned int) (G_key_index.first_account + entry->account));
+        field_append_string(field, tmp);
+    }
+}
+
 bool decoder_public_key(buffer_t *buf, field_t *field, bool should_hash_only) {
     uint8_t value[PUBKEY_COMPRESSED_LEN] = {0};
-    char wif[PUBKEY_WIF_STR_LEN] = {0};
+    char wif[PUBKEY_WIF_STR_LEN + 1] = {0};  // keys with invalid prefix encode to one character more
 
     if (!buffer_move_partial(buf, value, PUBKEY_COMPRESSED_LEN, PUBKEY_COMPRESSED_LEN) ||
         !wif_from_compressed_public_key((uint8_t *) value, PUBKEY_COMPRESSED_LEN, wif, PUBKEY_WIF_STR_LEN)) {
@@ -258,9 +287,11 @@ bool decoder_public_key(buffer_t *buf, field_t *field, bool should_hash_only) {
     }
 
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, (uint8_t *) value, PUBKEY_COMPRESSED_LEN, NULL, 0);
+        transaction_hash_update((uint8_t *) value, PUBKEY_COMPRESSED_LEN);
     } else {
-        snprintf(field->value, MEMBER_SIZE(field_t, value), "%s", wif);
+        field_clear_value(field);
+        field_append_string(field, wif);
+        append_key_owner(field, value);
     }
     return true;
 }
@@ -271,11 +302,13 @@ bool decoder_asset(buffer_t *buf, field_t *field, bool should_hash_only) {
         return false;
     }
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, (uint8_t *) &asset, sizeof(asset_t), NULL, 0);
+        transaction_hash_update((uint8_t *) &asset, sizeof(asset_t));
     } else {
+        field_clear_value(field);
         if (!format_asset(&asset, field->value, MEMBER_SIZE(field_t, value))) {
             return false;
         }
+        field->length = strlen(field->value);
     }
     return true;
 }
@@ -286,9 +319,11 @@ bool decoder_weight(buffer_t *buf, field_t *field, bool should_hash_only) {
         return false;
     }
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, (uint8_t *) &weight, sizeof(weight), NULL, 0);
+        transaction_hash_update((uint8_t *) &weight, sizeof(weight));
     } else {
+        field_clear_value(field);
         snprintf(field->value, MEMBER_SIZE(field_t, value), "%d.%02d%%", weight / 100, abs(weight) % 100);
+        field->length = strlen(field->value);
     }
     return true;
 }
@@ -299,9 +334,11 @@ bool decoder_uint32(buffer_t *buf, field_t *field, bool should_hash_only) {
         return false;
     }
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, (uint8_t *) &value, sizeof(value), NULL, 0);
+        transaction_hash_update((uint8_t *) &value, sizeof(value));
     } else {
+        field_clear_value(field);
         snprintf(field->value, MEMBER_SIZE(field_t, value), "%d", value);
+        field->length = strlen(field->value);
     }
     return true;
 }
@@ -312,11 +349,12 @@ bool decoder_uint64(buffer_t *buf, field_t *field, bool should_hash_only) {
         return false;
     }
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, (uint8_t *) &value, sizeof(value), NULL, 0);
+        transaction_hash_update((uint8_t *) &value, sizeof(value));
     } else {
         char u64_str[MAX_U64_LEN];
         format_u64(value, u64_str, ARRAYLEN(u64_str));
-        snprintf(field->value, MEMBER_SIZE(field_t, value), "%s", u64_str);
+        field_clear_value(field);
+        field_append_string(field, u64_str);
     }
     return true;
 }
@@ -327,9 +365,11 @@ bool decoder_uint16(buffer_t *buf, field_t *field, bool should_hash_only) {
         return false;
     }
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, (uint8_t *) &value, sizeof(value), NULL, 0);
+        transaction_hash_update((uint8_t *) &value, sizeof(value));
     } else {
+        field_clear_value(field);
         snprintf(field->value, MEMBER_SIZE(field_t, value), "%d", value);
+        field->length = strlen(field->value);
     }
     return true;
 }
@@ -340,88 +380,110 @@ bool decoder_uint8(buffer_t *buf, field_t *field, bool should_hash_only) {
         return false;
     }
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, &value, sizeof(value), NULL, 0);
+        transaction_hash_update(&value, sizeof(value));
     } else {
+        field_clear_value(field);
         snprintf(field->value, MEMBER_SIZE(field_t, value), "%d", value);
+        field->length = strlen(field->value);
     }
     return true;
 }
 
-bool decoder_authority_type(buffer_t *buf, field_t *field, bool should_hash_only) {
-    size_t initial_offset = buf->offset;
-
+/**
+ * Decode authority which consist of [weight threshold] [account_auths] [key_auths] and append it to the field value (if given)
+ */
+static bool read_authority(buffer_t *buf, field_t *field) {
     uint8_t count;
     uint16_t threshold;
     uint32_t weight;
 
-    uint8_t tmp[MAX_ACCOUNT_NAME_LEN] = {0};
-    char value[MEMBER_SIZE(field_t, value)] = {0};
+    uint8_t key[PUBKEY_COMPRESSED_LEN] = {0};
     char wif[PUBKEY_WIF_STR_LEN + 1] = {0};
+    char tmp[PUBKEY_WIF_STR_LEN + 16] = {0};
 
     // weight_threshold
     if (!buffer_read_u32(buf, &weight, LE) || !buffer_read_u8(buf, &count)) {
         return false;
     }
 
-    snprintf(value, sizeof(value), "Weight: %d, [ ", weight);
+    if (field != NULL) {
+        snprintf(tmp, sizeof(tmp), "Weight: %d, [ ", weight);
+        field_append_string(field, tmp);
+    }
 
     // account_auths count
     for (uint8_t i = 0; i < count; i++) {
-        memset(tmp, 0, sizeof(tmp));
+        if (field != NULL) {
+            field_append_string(field, "[ ");
+        }
 
-        uint8_t string_length;
+        if (!read_string(buf, field, false, MAX_ACCOUNT_NAME_LEN) || !buffer_read_u16(buf, &threshold, LE)) {
+            return false;
+        }
 
-        // clang-format off
-    if (!buffer_read_u8(buf, &string_length) || 
-        string_length >= sizeof(tmp) || 
-        !buffer_move_partial(buf, tmp, sizeof(tmp), string_length) ||
-        !buffer_read_u16(buf, &threshold, LE)) {
-        return false;
+        if (field != NULL) {
+            snprintf(tmp, sizeof(tmp), i == count - 1 ? ", %d ]" : ", %d ], ", threshold);
+            field_append_string(field, tmp);
+        }
     }
-        // clang-format on
 
-        snprintf(value + strlen(value), sizeof(value) - strlen(value), i == count - 1 ? "[ %s, %d ]" : "[ %s, %d ], ", tmp, threshold);
+    if (field != NULL) {
+        field_append_string(field, " ], [ ");
     }
 
-    snprintf(value + strlen(value), sizeof(value) - strlen(value), " ], [ ");
-
     // key_auths
     if (!buffer_read_u8(buf, &count)) {
         return false;
     }
 
     for (uint8_t i = 0; i < count; i++) {
-        memset(tmp, 0, sizeof(tmp));
         memset(wif, 0, sizeof(wif));
 
-        if (!buffer_move_partial(buf, tmp, sizeof(tmp), PUBKEY_COMPRESSED_LEN) || !buffer_read_u16(buf, &threshold, LE) ||
-            !wif_from_compressed_public_key((uint8_t *) tmp, PUBKEY_COMPRESSED_LEN, wif, PUBKEY_WIF_STR_LEN)) {
+        if (!buffer_move_partial(buf, key, sizeof(key), PUBKEY_COMPRESSED_LEN) || !buffer_read_u16(buf, &threshold, LE) ||
+            !wif_from_compressed_public_key(key, PUBKEY_COMPRESSED_LEN, wif, PUBKEY_WIF_STR_LEN)) {
             return false;
         }
 
-        snprintf(value + strlen(value), sizeof(value) - strlen(value), i == count - 1 ? "[ %s, %d ]" : "[ %s, %d ], ", wif, threshold);
+        if (field != NULL) {
+            field_append_string(field, "[ ");
+            field_append_string(field, wif);
+            append_key_owner(field, key);
+            snprintf(tmp, sizeof(tmp), i == count - 1 ? ", %d ]" : ", %d ], ", threshold);
+            field_append_string(field, tmp);
+        }
+    }
+
+    if (field != NULL) {
+        field_append_string(field, " ]");
+    }
+
+    return true;
+}
+
+bool decoder_authority_type(buffer_t *buf, field_t *field, bool should_hash_only) {
+    size_t initial_offset = buf->offset;
+
+    if (!should_hash_only) {
+        field_clear_value(field);
     }
 
-    snprintf(value + strlen(value), sizeof(value) - strlen(value), " ]");
+    if (!read_authority(buf, should_hash_only ? NULL : field)) {
+        return false;
+    }
 
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, buf->ptr + initial_offset, buf->offset - initial_offset, NULL, 0);
-    } else {
-        snprintf(field->value, MEMBER_SIZE(field_t, value), "%s", value);
+        transaction_hash_update(buf->ptr + initial_offset, buf->offset - initial_offset);
     }
     return true;
 }
 
 bool decoder_optional_authority_type(buffer_t *buf, field_t *field, bool should_hash_only) {
     size_t initial_offset = buf->offset;
-
     uint8_t count;
-    uint16_t threshold;
-    uint32_t weight;
 
-    uint8_t tmp[MAX_ACCOUNT_NAME_LEN] = {0};
-    char value[MEMBER_SIZE(field_t, value)] = {0};
-    char wif[PUBKEY_WIF_STR_LEN + 1] = {0};
+    if (!should_hash_only) {
+        field_clear_value(field);
+    }
 
     // this field may be optional so we need to check first byte
     if (!buffer_read_u8(buf, &count)) {
@@ -429,59 +491,15 @@ bool decoder_optional_authority_type(buffer_t *buf, field_t *field, bool should_
     }
 
     if (count != 0) {
-        // weight_threshold
-        if (!buffer_read_u32(buf, &weight, LE) || !buffer_read_u8(buf, &count)) {
-            return false;
-        }
-
-        snprintf(value, sizeof(value), "Weight: %d, [ ", weight);
-
-        // account_auths count
-        for (uint8_t i = 0; i < count; i++) {
-            memset(tmp, 0, sizeof(tmp));
-
-            uint8_t string_length;
-
-            // clang-format off
-        if (!buffer_read_u8(buf, &string_length) || 
-            string_length >= sizeof(tmp) || 
-            !buffer_move_partial(buf, tmp, sizeof(tmp), string_length) ||
-            !buffer_read_u16(buf, &threshold, LE)) {
+        if (!read_authority(buf, should_hash_only ? NULL : field)) {
             return false;
         }
-            // clang-format on
-
-            snprintf(value + strlen(value), sizeof(value) - strlen(value), i == count - 1 ? "[ %s, %d ]" : "[ %s, %d ], ", tmp, threshold);
-        }
-
-        snprintf(value + strlen(value), sizeof(value) - strlen(value), " ], [ ");
-
-        // key_auths
-        if (!buffer_read_u8(buf, &count)) {
-            return false;
-        }
-
-        for (uint8_t i = 0; i < count; i++) {
-            memset(tmp, 0, sizeof(tmp));
-            memset(wif, 0, sizeof(wif));
-
-            if (!buffer_move_partial(buf, tmp, sizeof(tmp), PUBKEY_COMPRESSED_LEN) || !buffer_read_u16(buf, &threshold, LE) ||
-                !wif_from_compressed_public_key((uint8_t *) tmp, PUBKEY_COMPRESSED_LEN, wif, PUBKEY_WIF_STR_LEN)) {
-                return false;
-            }
-
-            snprintf(value + strlen(value), sizeof(value) - strlen(value), i == count - 1 ? "[ %s, %d ]" : "[ %s, %d ], ", wif, threshold);
-        }
-
-        snprintf(value + strlen(value), sizeof(value) - strlen(value), " ]");
-    } else {
-        snprintf(value, sizeof(value), "no changes");
+    } else if (!should_hash_only) {
+        field_append_string(field, "no changes");
     }
 
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, buf->ptr + initial_offset, buf->offset - initial_offset, NULL, 0);
-    } else {
-        snprintf(field->value, MEMBER_SIZE(field_t, value), "%s", value);
+        transaction_hash_update(buf->ptr + initial_offset, buf->offset - initial_offset);
     }
     return true;
 }
@@ -493,29 +511,33 @@ bool decoder_empty_extensions(buffer_t *buf, field_t *field, bool should_hash_on
     }
 
     if (should_hash_only) {
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, &size, sizeof(size), NULL, 0);
+        transaction_hash_update(&size, sizeof(size));
     } else {
-        snprintf(field->value, MEMBER_SIZE(field_t, value), "[ ]");
+        field_clear_value(field);
+        field_append_string(field, "[ ]");
     }
     return true;
 }
 
 bool decoder_beneficiaries_extensions(buffer_t *buf, field_t *field, bool should_hash_only) {
     size_t initial_offset = buf->offset;
-    uint8_t size, type, account_name_len, beneficiaries;
+    uint8_t size, type, beneficiaries;
     uint16_t weight;
-    char account_name[MAX_ACCOUNT_NAME_LEN + 1] = {0};
-    char value[MEMBER_SIZE(field_t, value)] = {0};
+    char tmp[16] = {0};
 
     if (!buffer_read_u8(buf, &size)) {
         return false;
     }
 
+    if (!should_hash_only) {
+        field_clear_value(field);
+    }
+
     if (size == 0) {
         if (should_hash_only) {
-            cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, &size, sizeof(size), NULL, 0);
+            transaction_hash_update(&size, sizeof(size));
         } else {
-            snprintf(field->value, MEMBER_SIZE(field_t, value), "[ ]");
+            field_append_string(field, "[ ]");
         }
     } else if (size == 1) {
         if (!buffer_read_u8(buf, &type) || type != EXT_TYPE_BENEFICIARIES) {  // only allow beneficiaries extension
@@ -526,32 +548,25 @@ bool decoder_beneficiaries_extensions(buffer_t *buf, field_t *field, bool should
             return false;
         }
 
-        snprintf(value, sizeof(value), "Beneficiaries: [");
+        if (!should_hash_only) {
+            field_append_string(field, "Beneficiaries: [");
+        }
 
         for (uint8_t i = 0; i < beneficiaries; i++) {
-            // clang-format off
-            if (!buffer_read_u8(buf, &account_name_len) || 
-                account_name_len >= sizeof(value) || 
-                !buffer_move_partial(buf, (uint8_t *)account_name, sizeof(account_name) - 1, account_name_len) ||
-                !buffer_read_u16(buf, &weight, LE)) {
+            if (!read_string(buf, should_hash_only ? NULL : field, false, MAX_ACCOUNT_NAME_LEN + 1) || !buffer_read_u16(buf, &weight, LE)) {
                 return false;
             }
-            // clang-format on
-
-            snprintf(value + strlen(value),
-                     sizeof(value) - strlen(value),
-                     i == beneficiaries - 1 ? "%s: %d.%02d%%" : "%s: %d.%02d%%, ",
-                     account_name,
-                     weight / 100,
-                     weight % 100);
-        }
 
-        snprintf(value + strlen(value), sizeof(value) - strlen(value), "]");
+            if (!should_hash_only) {
+                snprintf(tmp, sizeof(tmp), i == beneficiaries - 1 ? ": %d.%02d%%" : ": %d.%02d%%, ", weight / 100, weight % 100);
+                field_append_string(field, tmp);
+            }
+        }
 
         if (should_hash_only) {
-            cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, buf->ptr + initial_offset, buf->offset - initial_offset, NULL, 0);
+            transaction_hash_update(buf->ptr + initial_offset, buf->offset - initial_offset);
         } else {
-            snprintf(field->value, MEMBER_SIZE(field_t, value), "%s", value);
+            field_append_string(field, "]");
         }
 
     } else {
@@ -560,4 +575,132 @@ bool decoder_beneficiaries_extensions(buffer_t *buf, field_t *field, bool should
     }
 
     return true;
-}
\ No newline at end of file
+}
+
+/**
+ * Compare property keys the way flat_map<string, bytes> orders them
+ */
+static int compare_keys(const char *a, size_t a_length, const char *b, size_t b_length) {
+    int result = memcmp(a, b, a_length < b_length ? a_length : b_length);
+
+    return result != 0 ? result : (a_length > b_length) - (a_length < b_length);
+}
+
+/**
+ * Decode value of known witness property with the decoder of its type and append it to the field value (if given).
+ * The value has to be read whole and fit a single page, so that the hash pass rejects anything the review can not show.
+ */
+static bool read_witness_property(buffer_t *value, const witness_property_t *property, field_t *field) {
+    decoder_t *decoder = (decoder_t *) PIC(property->decoder);
+    field_t tmp;
+
+    for (uint8_t i = 0; i < property->count; i++) {
+        field_reset(&tmp, 0);
+        if (!(*decoder)(value, &tmp, false) || tmp.length > FIELD_PAGE_LEN) {
+            return false;
+        }
+
+        if (field != NULL) {
+            field_append_string(field, i == 0 ? "" : " / ");
+            field_append(field, tmp.value, tmp.length);
+        }
+    }
+
+    return value->offset == value->size;
+}
+
+/**
+ * Append value of unknown witness property as hex of its first bytes, i.e. "0102030405060708... (40 bytes)"
+ */
+static void append_property_preview(field_t *field, const buffer_t *value) {
+    char hex[2 * PROPERTY_PREVIEW_LEN + 1] = {0};
+    char tmp[24] = {0};
+    size_t length = value->size < PROPERTY_PREVIEW_LEN ? value->size : PROPERTY_PREVIEW_LEN;
+
+    format_hash(value->ptr, length, hex, sizeof(hex));
+    field_append_string(field, hex);
+
+    if (value->size > length) {
+        snprintf(tmp, sizeof(tmp), "... (%d bytes)", (int) value->size);
+        field_append_string(field, tmp);
+    }
+}
+
+/**
+ * Decode witness properties which consist of [varint count] [count * ([varint key length] [key] [varint value length] [value])]
+ * and are sorted by key. Both lists are sorted, so known keys are matched in a single walk through WITNESS_PROPERTIES.
+ */
+bool decoder_witness_properties(buffer_t *buf, field_t *field, bool should_hash_only) {
+    size_t initial_offset = buf->offset;
+    const char *previous = NULL;
+    uint32_t count, key_length, value_length, previous_length = 0;
+    uint8_t known = 0;
+
+    if (!buffer_read_varint(buf, &count)) {
+        return false;
+    }
+
+    if (!should_hash_only) {
+        field_clear_value(field);
+        if (count == 0) {
+            field_append_string(field, "[ ]");
+        }
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (!buffer_read_varint(buf, &key_length) || key_length >= MAX_PROPERTY_KEY_LEN || !buffer_can_read(buf, key_length)) {
+            return false;
+        }
+
+        const char *key = (const char *) buf->ptr + buf->offset;
+
+        // keys are unique and in ascending order, otherwise the node would read the map differently
+        if ((previous != NULL && compare_keys(previous, previous_length, key, key_length) >= 0) || !buffer_seek_cur(buf, key_length) ||
+            !buffer_read_varint(buf, &value_length) || !buffer_can_read(buf, value_length)) {
+            return false;
+        }
+
+        buffer_t value = {.ptr = buf->ptr + buf->offset, .size = value_length, .offset = 0};
+        buffer_seek_cur(buf, value_length);
+        previous = key;
+        previous_length = key_length;
+
+        /* Use PIC macro to access const data (stored in .text area) */
+        const char *known_key = NULL;
+        while (known < ARRAYLEN(WITNESS_PROPERTIES)) {
+            known_key = (const char *) PIC(WITNESS_PROPERTIES[known].key);
+            if (compare_keys(known_key, strlen(known_key), key, key_length) >= 0) {
+                break;
+            }
+            known++;
+        }
+
+        const witness_property_t *property = NULL;
+        if (known < ARRAYLEN(WITNESS_PROPERTIES) && compare_keys(known_key, strlen(known_key), key, key_length) == 0) {
+            property = &WITNESS_PROPERTIES[known];
+        }
+
+        if (!should_hash_only) {
+            field_append_string(field, i == 0 ? "" : ", ");
+            if (property != NULL) {
+                field_append_string(field, name_pool_get(property->name));
+            } else {
+                field_append(field, key, key_length);
+            }
+            field_append_string(field, ": ");
+        }
+
+        if (property != NULL) {
+            if (!read_witness_property(&value, property, should_hash_only ? NULL : field)) {
+                return false;
+            }
+        } else if (!should_hash_only) {
+            append_property_preview(field, &value);
+        }
+    }
+
+    if (should_hash_only) {
+        transaction_hash_update(buf->ptr + initial_offset, buf->offset - initial_offset);
+    }
+    return true;
+}
@@ -8,11 +8,17 @@
 
 #include "types.h"
 
+/**
+ * Update transaction digest with serialized data, every hashed byte of the transaction goes through here
+ */
+void transaction_hash_update(const uint8_t *data, size_t length);
+
 bool decoder_array_of_strings(buffer_t *buf, field_t *field, bool should_hash_only);
 bool decoder_array_of_u64(buffer_t *buf, field_t *field, bool should_hash_only);
 bool decoder_asset(buffer_t *buf, field_t *field, bool should_hash_only);
 bool decoder_authority_type(buffer_t *buf, field_t *field, bool should_hash_only);
 bool decoder_optional_authority_type(buffer_t *buf, field_t *field, bool should_hash_only);
+bool decoder_custom_json(buffer_t *buf, field_t *field, bool should_hash_only);
 bool decoder_boolean(buffer_t *buf, field_t *field, bool should_hash_only);
 bool decoder_date_time(buffer_t *buf, field_t *field, bool should_hash_only);
 bool decoder_operation_name(buffer_t *buf, field_t *field, bool should_hash_only);
@@ -24,4 +30,5 @@ bool decoder_uint64(buffer_t *buf, field_t *field, bool should_hash_only);
 bool decoder_uint8(buffer_t *buf, field_t *field, bool should_hash_only);
 bool decoder_weight(buffer_t *buf, field_t *field, bool should_hash_only);
 bool decoder_empty_extensions(buffer_t *buf, field_t *field, bool should_hash_only);
-bool decoder_beneficiaries_extensions(buffer_t *buf, field_t *field, bool should_hash_only);
\ No newline at end of file
+bool decoder_beneficiaries_extensions(buffer_t *buf, field_t *field, bool should_hash_only);
+bool decoder_witness_properties(buffer_t *buf, field_t *field, bool should_hash_only);
\ No newline at end of file
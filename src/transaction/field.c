@@ -0,0 +1,57 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <string.h>
+
+#include "field.h"
+
+void field_reset(field_t *field, uint8_t page) {
+    field->page = page;
+    field_clear_value(field);
+}
+
+void field_clear_value(field_t *field) {
+    memset(field->value, 0, sizeof(field->value));
+    field->length = 0;
+}
+
+void field_append(field_t *field, const char *data, size_t length) {
+    size_t page_start = (size_t) field->page * FIELD_PAGE_LEN;
+    size_t page_end = page_start + FIELD_PAGE_LEN;
+    size_t start = field->length;
+    size_t end = start + length;
+
+    // copy only part of the data overlapping with the selected page
+    if (end > page_start && start < page_end) {
+        size_t from = start > page_start ? start : page_start;
+        size_t to = end < page_end ? end : page_end;
+
+        memcpy(field->value + (from - page_start), data + (from - start), to - from);
+    }
+
+    field->length = end > UINT16_MAX ? UINT16_MAX : (uint16_t) end;
+}
+
+void field_append_string(field_t *field, const char *str) {
+    field_append(field, str, strlen(str));
+}
+
+uint8_t field_page_count(const field_t *field) {
+    size_t count = (field->length + FIELD_PAGE_LEN - 1) / FIELD_PAGE_LEN;
+
+    return count == 0 ? 1 : (count > UINT8_MAX ? UINT8_MAX : (uint8_t) count);
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "types.h"
+#include "common/macros.h"
+
+/**
+ * Number of characters rendered on a single page of field value
+ */
+#define FIELD_PAGE_LEN (MEMBER_SIZE(field_t, value) - 1)
+
+/**
+ * Prepare field to render given page of the next decoded value
+ *
+ * @param[out] field
+ *  Pointer to the field
+ * @param[in] page
+ *  Index of value page to render
+ */
+void field_reset(field_t *field, uint8_t page);
+
+/**
+ * Clear rendered value, keeping the selected page. Called by decoders before rendering.
+ *
+ * @param[out] field
+ *  Pointer to the field
+ */
+void field_clear_value(field_t *field);
+
+/**
+ * Append data to the field value. Only characters within the selected page are stored,
+ * total length of the value is always accounted.
+ *
+ * @param[in,out] field
+ *  Pointer to the field
+ * @param[in] data
+ *  Pointer to characters to append
+ * @param[in] length
+ *  Number of characters to append
+ */
+void field_append(field_t *field, const char *data, size_t length);
+
+/**
+ * Append null terminated string to the field value
+ *
+ * @param[in,out] field
+ *  Pointer to the field
+ * @param[in] str
+ *  Null terminated string to append
+ */
+void field_append_string(field_t *field, const char *str);
+
+/**
+ * Get number of pages of rendered value
+ *
+ * @param[in] field
+ *  Pointer to the field
+ * @return number of pages, at least 1
+ */
+uint8_t field_page_count(const field_t *field);
@@ -0,0 +1,129 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdio.h>
+
+#include "field_pager.h"
+#include "field.h"
+#include "names.h"
+#include "operation_ir.h"
+#include "template_diff.h"
+#include "globals.h"
+#include "perf.h"
+#include "common/macros.h"
+
+static int8_t g_tx_field_position = -1;
+static uint8_t g_tx_field_page;
+static uint8_t g_tx_field_page_count = 1;
+
+void field_pager_reset(void) {
+    g_tx_field_position = -1;
+    g_tx_field_page = 0;
+    g_tx_field_page_count = 1;
+}
+
+uint8_t field_pager_render(field_t *field, uint8_t position, uint8_t page) {
+    field_reset(field, page);
+
+    // We dont need to validate the return code because at this point we're already sure the transaction parses correctly
+    operation_ir_render(G_context.tx_info.operation.ptr, G_context.tx_info.parser, &G_context.tx_info.ir, position, field);
+
+    return field_page_count(field);
+}
+
+/**
+ * Decode field at given position, rendering selected page of its value
+ */
+static void decode_field(field_t *field, int8_t position, uint8_t page) {
+    PERF_BEGIN(PERF_REVIEW_STEP);
+
+    g_tx_field_page_count = field_pager_render(field, (uint8_t) position, page);
+
+    PERF_END(PERF_REVIEW_STEP);
+}
+
+bool parse_field(field_t *field, bool reverse_order, bool start_from_last_operation) {
+    // Because encoded fields have various lenght and we want to be able to parse fields in reverse
+    // order, we need to iterate decoders from the very beginning up to the
+    // g_tx_field_position. Long values are split into pages, rendered one at a time.
+
+    // Edge case, when we want to start from the last operation
+    if (start_from_last_operation) {
+        g_tx_field_position = G_context.tx_info.parser->size;
+    }
+
+    // Fields which did not change since the last approved operation of this type are skipped
+    if (reverse_order) {
+        if (g_tx_field_position >= 0 && g_tx_field_position < G_context.tx_info.parser->size && g_tx_field_page > 0) {
+            // previous page of the same field
+            g_tx_field_page--;
+        } else if (g_tx_field_position >= 0) {
+            do {
+                g_tx_field_position--;
+            } while (!template_diff_is_changed(g_tx_field_position));
+
+            if (g_tx_field_position == -1) {
+                // no more data
+                return false;
+            }
+
+            // start from the last page of the previous field
+            decode_field(field, g_tx_field_position, 0);
+            g_tx_field_page = g_tx_field_page_count - 1;
+        } else {
+            return false;
+        }
+    } else {
+        if (g_tx_field_position >= 0 && g_tx_field_page + 1 < g_tx_field_page_count) {
+            // next page of the same field
+            g_tx_field_page++;
+        } else {
+            int8_t next_position = g_tx_field_position + 1;
+            while (next_position < G_context.tx_info.parser->size && !template_diff_is_changed(next_position)) {
+                next_position++;
+            }
+
+            if (next_position < G_context.tx_info.parser->size) {
+                g_tx_field_position = next_position;
+                g_tx_field_page = 0;
+            } else {
+                // no more data
+                return false;
+            }
+        }
+    }
+
+    // Display field value
+    decode_field(field, g_tx_field_position, g_tx_field_page);
+
+    // Display field name, with page number for values longer than a single page
+    if (g_tx_field_page_count > 1) {
+        snprintf(field->title,
+                 MEMBER_SIZE(field_t, title),
+                 "%s (%d/%d)",
+                 name_pool_get(G_context.tx_info.parser->names[g_tx_field_position]),
+                 g_tx_field_page + 1,
+                 g_tx_field_page_count);
+    } else {
+        snprintf(field->title, MEMBER_SIZE(field_t, title), "%s", name_pool_get(G_context.tx_info.parser->names[g_tx_field_position]));
+    }
+
+    // Display previous value next to the changed one
+    template_diff_format_field(g_tx_field_position, field);
+
+    return true;
+}
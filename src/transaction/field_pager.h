@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "types.h"
+
+/**
+ * Restart review of the operation in global context before its first field. Review screens and host builds share
+ * the pager, which keeps the field being displayed and the page of its value.
+ */
+void field_pager_reset(void);
+
+/**
+ * Decode operation in global context up to the field at given position and render given page of its value. Review
+ * state of the pager is left untouched.
+ *
+ * @param[out] field
+ *  Output field, only its value is rendered
+ * @param[in] position
+ *  Field position in the operation parser
+ * @param[in] page
+ *  Index of value page to render
+ * @return number of pages of the value
+ */
+uint8_t field_pager_render(field_t *field, uint8_t position, uint8_t page);
+
+/**
+ * Traverse DER encoded operation up to g_tx_field_position and copy it's value and title to specified field.
+ *
+ * @param[out] field
+ *  Output field that will be used to display information (title of the operation field and its value) on the screen
+ * @param[in] reverse_order
+ *  Traverse the operation in reverse order to handle FLOW_LOOP
+ * @param start_from_last_operation
+ *  Handle edge case when we want to display the last operation when entering from the first screen, moving left
+ * @return true if success, false otherwise
+ */
+bool parse_field(field_t *field, bool reverse_order, bool start_from_last_operation);
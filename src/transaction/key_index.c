@@ -0,0 +1,177 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "os.h"
+
+#include "key_index.h"
+#include "account_create.h"
+#include "decoders.h"
+#include "constants.h"
+#include "globals.h"
+#include "crypto.h"
+#include "common/buffer.h"
+
+#define HARDENED_OFFSET 0x80000000
+
+static uint8_t count_roles(uint8_t roles) {
+    uint8_t count = 0;
+
+    for (; roles != 0; roles >>= 1) {
+        count += roles & 1;
+    }
+
+    return count;
+}
+
+parser_status_e key_index_parse(buffer_t *buf, key_index_t *index) {
+    uint32_t first_account;
+    uint8_t account_count;
+    uint8_t roles;
+
+    if (!buffer_read_u32(buf, &first_account, BE) || !buffer_read_u8(buf, &account_count) || !buffer_read_u8(buf, &roles) ||
+        buf->offset != buf->size) {
+        return WRONG_LENGTH_ERROR;
+    }
+
+    // accounts must not overflow into hardened indices, every key must fit the index
+    if (account_count == 0 || first_account >= HARDENED_OFFSET || account_count > HARDENED_OFFSET - first_account || roles == 0 || (roles & ~KEY_INDEX_ALL_ROLES) != 0 ||
+        account_count * count_roles(roles) > MAX_KEY_INDEX_ENTRIES) {
+        return WRONG_LENGTH_ERROR;
+    }
+
+    memset(index, 0, sizeof(key_index_t));
+    index->first_account = first_account;
+    index->account_count = account_count;
+    index->roles = roles;
+
+    return PARSING_OK;
+}
+
+uint8_t key_index_account_count(const key_index_t *index) {
+    return index->account_count != 0 ? index->account_count : 1;
+}
+
+uint8_t key_index_roles(const key_index_t *index) {
+    return index->roles != 0 ? index->roles : KEY_INDEX_ALL_ROLES;
+}
+
+bool key_index_add(key_index_t *index, const uint8_t key[static PUBKEY_COMPRESSED_LEN], uint8_t role, uint8_t account) {
+    uint8_t position = index->size;
+
+    if (index->size >= MAX_KEY_INDEX_ENTRIES) {
+        return false;
+    }
+
+    // insertion sort, the index holds only a few keys
+    while (position > 0 && memcmp(index->entries[position - 1].fingerprint, key, KEY_FINGERPRINT_LEN) > 0) {
+        index->entries[position] = index->entries[position - 1];
+        position--;
+    }
+
+    memmove(index->entries[position].fingerprint, key, KEY_FINGERPRINT_LEN);
+    index->entries[position].role = role;
+    index->entries[position].account = account;
+    index->size++;
+
+    return true;
+}
+
+const key_index_entry_t *key_index_find(const key_index_t *index, const uint8_t key[static PUBKEY_COMPRESSED_LEN]) {
+    uint8_t low = 0;
+    uint8_t high = index->size;
+
+    while (low < high) {
+        const uint8_t middle = (low + high) / 2;
+        const int order = memcmp(index->entries[middle].fingerprint, key, KEY_FINGERPRINT_LEN);
+
+        if (order == 0) {
+            return &index->entries[middle];
+        }
+        if (order < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return NULL;
+}
+
+const char *key_index_role_name(uint8_t role) {
+    switch (role) {
+        case OWNER_KEY_ROLE & ~HARDENED_OFFSET:
+            return "owner";
+        case ACTIVE_KEY_ROLE & ~HARDENED_OFFSET:
+            return "active";
+        case MEMO_KEY_ROLE & ~HARDENED_OFFSET:
+            return "memo";
+        case POSTING_KEY_ROLE & ~HARDENED_OFFSET:
+            return "posting";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * Check whether any field of the operation displays public keys
+ */
+static bool shows_public_keys(const parser_t *parser) {
+    for (uint8_t i = 0; i < parser->size; i++) {
+        /* Use PIC macro to access const data (stored in .text area) */
+        const decoder_t *decoder = (const decoder_t *) PIC(parser->decoders[i]);
+
+        if (decoder == &decoder_public_key || decoder == &decoder_authority_type || decoder == &decoder_optional_authority_type ||
+            decoder == &decoder_witness_properties) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void key_index_ensure(const parser_t *parser) {
+    uint8_t key[PUBKEY_COMPRESSED_LEN];
+    uint32_t bip32_path[ACCOUNT_KEY_PATH_LEN];
+
+    if (G_key_index.built || !shows_public_keys(parser)) {
+        return;
+    }
+
+    const uint8_t roles = key_index_roles(&G_key_index);
+    G_key_index.size = 0;
+
+    for (uint8_t account = 0; account < key_index_account_count(&G_key_index); account++) {
+        for (uint8_t role = 0; role < 8; role++) {
+            if ((roles & (1 << role)) == 0) {
+                continue;
+            }
+
+            // roles are hardened in the path, as OWNER_KEY_ROLE is
+            account_key_path(G_key_index.first_account + account, OWNER_KEY_ROLE | role, bip32_path);
+            crypto_derive_compressed_public_key(bip32_path, ACCOUNT_KEY_PATH_LEN, key);
+            key_index_add(&G_key_index, key, role, account);
+
+            io_seproxyhal_io_heartbeat();
+        }
+    }
+
+    G_key_index.built = true;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "types.h"
+#include "common/buffer.h"
+
+/**
+ * SLIP-48 roles indexed when the host did not configure the index: owner, active, memo and posting
+ */
+#define KEY_INDEX_ALL_ROLES 0x1B
+
+/**
+ * Parse key ownership index configuration sent with SET_KEY_INDEX command. The configured index is empty until its
+ * keys are derived, see key_index_add.
+ *
+ * @param[in] buf
+ *  Pointer to buffer with first account, account count and roles bitmask
+ * @param[out] index
+ *  Pointer to index to configure
+ * @return PARSING_OK if success, error status otherwise.
+ */
+parser_status_e key_index_parse(buffer_t *buf, key_index_t *index);
+
+/**
+ * Get number of indexed accounts, one if the index is not configured
+ *
+ * @param[in] index
+ *  Pointer to the index
+ * @return number of accounts starting at index->first_account
+ */
+uint8_t key_index_account_count(const key_index_t *index);
+
+/**
+ * Get indexed SLIP-48 roles, KEY_INDEX_ALL_ROLES if the index is not configured
+ *
+ * @param[in] index
+ *  Pointer to the index
+ * @return roles bitmask, bit n set for role n
+ */
+uint8_t key_index_roles(const key_index_t *index);
+
+/**
+ * Add derived key to the index, keeping entries sorted by fingerprint
+ *
+ * @param[in,out] index
+ *  Pointer to the index
+ * @param[in] key
+ *  Compressed public key
+ * @param[in] role
+ *  SLIP-48 role of the key, not hardened
+ * @param[in] account
+ *  Account of the key, relative to index->first_account
+ * @return true if success, false if the index is full
+ */
+bool key_index_add(key_index_t *index, const uint8_t key[static PUBKEY_COMPRESSED_LEN], uint8_t role, uint8_t account);
+
+/**
+ * Find key in the index with binary search by fingerprint
+ *
+ * @param[in] index
+ *  Pointer to the index
+ * @param[in] key
+ *  Compressed public key
+ * @return pointer to the entry of the key, NULL if it is not derived on this device
+ */
+const key_index_entry_t *key_index_find(const key_index_t *index, const uint8_t key[static PUBKEY_COMPRESSED_LEN]);
+
+/**
+ * Get displayed name of SLIP-48 role
+ *
+ * @param[in] role
+ *  SLIP-48 role, not hardened
+ * @return role name, i.e. "owner"
+ */
+const char *key_index_role_name(uint8_t role);
+
+/**
+ * Derive keys of the configured paths into G_key_index, unless they were derived already or the parsed operation shows
+ * no public keys, so decoders can mark keys of this device without deriving them
+ *
+ * @param[in] parser
+ *  Parser of the operation to review
+ */
+void key_index_ensure(const parser_t *parser);
@@ -0,0 +1,49 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <string.h>
+
+#include "last_signature.h"
+#include "globals.h"
+
+void last_signature_store(const uint8_t digest[static DIGEST_LEN], const uint8_t signature[static SIGNATURE_LEN]) {
+    memmove(G_last_signature.digest, digest, DIGEST_LEN);
+    memmove(G_last_signature.signature, signature, SIGNATURE_LEN);
+    memmove(G_last_signature.bip32_path, G_context.bip32_path, sizeof(uint32_t) * G_context.bip32_path_len);
+    G_last_signature.bip32_path_len = G_context.bip32_path_len;
+    G_last_signature.ttl = LAST_SIGNATURE_TTL_TICKS;
+}
+
+void last_signature_tick(void) {
+    if (G_last_signature.ttl == 0) {
+        return;
+    }
+
+    if (--G_last_signature.ttl == 0) {
+        explicit_bzero(&G_last_signature, sizeof(G_last_signature));
+    }
+}
+
+const uint8_t *last_signature_find(const uint8_t digest[static DIGEST_LEN], const uint32_t *bip32_path, uint8_t bip32_path_len) {
+    if (G_last_signature.ttl == 0 || G_last_signature.bip32_path_len != bip32_path_len ||
+        memcmp(G_last_signature.bip32_path, bip32_path, sizeof(uint32_t) * bip32_path_len) != 0 ||
+        memcmp(G_last_signature.digest, digest, DIGEST_LEN) != 0) {
+        return NULL;
+    }
+
+    return G_last_signature.signature;
+}
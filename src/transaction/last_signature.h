@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "types.h"
+
+/**
+ * Keep signature of the digest made with the key of global context, replacing the previous one
+ *
+ * @param[in] digest
+ *  Pointer to the signed digest
+ * @param[in] signature
+ *  Pointer to the compact signature
+ */
+void last_signature_store(const uint8_t digest[static DIGEST_LEN], const uint8_t signature[static SIGNATURE_LEN]);
+
+/**
+ * Account one ticker event, wipe the signature when its time is up
+ */
+void last_signature_tick(void);
+
+/**
+ * Get kept signature of the digest made with the key of given BIP32 path
+ *
+ * @param[in] digest
+ *  Pointer to the digest presented by the host
+ * @param[in] bip32_path
+ *  Pointer to BIP32 path of the signing key
+ * @param[in] bip32_path_len
+ *  Length of BIP32 path
+ * @return pointer to the compact signature, NULL if there is no matching signature
+ */
+const uint8_t *last_signature_find(const uint8_t digest[static DIGEST_LEN], const uint32_t *bip32_path, uint8_t bip32_path_len);
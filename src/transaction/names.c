@@ -0,0 +1,52 @@
+/*******************************************************************************
+ *   Ledger App Hive
+ *   (c) 2021 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "names.h"
+
+/* Field and operation names packed into single pool, parsers refer to names by 16-bit offsets */
+
+#define NAME_POOL_FIELD_TEXT(id, text) .field_##id = text,
+#define NAME_POOL_OPERATION_TEXT(number, name) .operation_##name = #name,
+#define OPERATION_NAME_OFFSET(number, name) [number] = offsetof(name_pool_t, operation_##name),
+
+_Static_assert(sizeof(name_pool_t) <= UINT16_MAX, "name pool offsets do not fit uint16_t");
+
+static const name_pool_t NAME_POOL = {
+    .empty = "",
+    FIELD_NAMES(NAME_POOL_FIELD_TEXT)
+    OPERATION_NAMES(NAME_POOL_OPERATION_TEXT)
+};
+
+/* Gaps of unsupported operation numbers are left 0, i.e. the empty name */
+static const uint16_t operation_offsets[MAX_OPERATION_NUMBER] = {OPERATION_NAMES(OPERATION_NAME_OFFSET)};
+
+const char *name_pool_get(uint16_t offset) {
+    if (offset >= sizeof(NAME_POOL)) {
+        return NAME_POOL.empty;
+    }
+    return (const char *) &NAME_POOL + offset;
+}
+
+const char *operation_name(uint8_t operation_number) {
+    if (operation_number >= MAX_OPERATION_NUMBER || operation_offsets[operation_number] == 0) {
+        return NULL;
+    }
+    return name_pool_get(operation_offsets[operation_number]);
+}
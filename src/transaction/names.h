@@ -0,0 +1,184 @@
+#pragma once
+
+#include <stddef.h>  // offsetof
+#include <stdint.h>  // uint*_t
+
+/**
+ * Field names displayed during transaction review, every name is stored once in the name pool.
+ * X(identifier, text)
+ */
+#define FIELD_NAMES(X) \
+    X(OPERATION, "Operation")                  \
+    X(VOTER, "Voter")                          \
+    X(AUTHOR, "Author")                        \
+    X(PERMLINK, "Permlink")                    \
+    X(WEIGHT, "Weight")                        \
+    X(PARENT_AUTHOR, "Parent author")          \
+    X(PARENT_PERMLINK, "Parent permlink")      \
+    X(TITLE, "Title")                          \
+    X(BODY, "Body")                            \
+    X(JSON_METADATA, "JSON metadata")          \
+    X(FROM, "From")                            \
+    X(TO, "To")                                \
+    X(AMOUNT, "Amount")                        \
+    X(MEMO, "Memo")                            \
+    X(ACCOUNT, "Account")                      \
+    X(VESTING_SHARES, "Vesting shares")        \
+    X(OWNER, "Owner")                          \
+    X(ORDER_ID, "Order ID")                    \
+    X(AMOUNT_TO_SELL, "Amount to sell")        \
+    X(MIN_TO_RECEIVE, "Min to receive")        \
+    X(FILL_OR_KILL, "Fill or kill")            \
+    X(EXPIRATION, "Expiration")                \
+    X(PUBLISHER, "Publisher")                  \
+    X(BASE, "Base")                            \
+    X(QUOTE, "Quote")                          \
+    X(REQUEST_ID, "Request ID")                \
+    X(FEE, "Fee")                              \
+    X(CREATOR, "Creator")                      \
+    X(NEW_ACC_NAME, "New acc. name")           \
+    X(ACTIVE, "Active")                        \
+    X(POSTING, "Posting")                      \
+    X(MEMO_KEY, "Memo key")                    \
+    X(URL, "Url")                              \
+    X(SIGNING_KEY, "Signing key")              \
+    X(ACC_CREATION_FEE, "Acc. creation fee")   \
+    X(MAX_BLOCK_SIZE, "Max block size")        \
+    X(HBD_INTEREST_RATE, "HBD interest rate")  \
+    X(WITNESS, "Witness")                      \
+    X(APPROVE, "Approve")                      \
+    X(PROXY, "Proxy")                          \
+    X(REQ_AUTHS, "Req. auths")                 \
+    X(REQ_POSTING_AUTHS, "Req. posting auths") \
+    X(ID, "ID")                                \
+    X(JSON, "JSON")                            \
+    X(MAX_PAYOUT, "Max payout")                \
+    X(PERCENT_HBD, "Percent HBD")              \
+    X(ALLOW_VOTES, "Allow votes")              \
+    X(ALLOW_CURATION, "Allow curation")        \
+    X(EXTENSIONS, "Extensions")                \
+    X(FROM_ACCOUNT, "From account")            \
+    X(TO_ACCOUNT, "To account")                \
+    X(PERCENT, "Percent")                      \
+    X(AUTOVEST, "Autovest")                    \
+    X(RECOVERY_ACCOUNT, "Recovery account")    \
+    X(ACC_TO_RECOVER, "Acc. to recover")       \
+    X(NEW_OWNER_AUTH, "New owner auth")        \
+    X(REC_OWNER_AUTH, "Rec. owner auth")       \
+    X(NEW_RECOVERY_ACC, "New recovery acc")    \
+    X(DECLINE, "Decline")                      \
+    X(RESET_ACCOUNT, "Reset account")          \
+    X(ACC_TO_RESET, "Acc. to reset")           \
+    X(NEW_OWNER_AUTHS, "New owner auths")      \
+    X(CUR_RESET_ACC, "Cur. reset acc.")        \
+    X(NEW_RESET_ACC, "New reset acc.")         \
+    X(REWARD_HIVE, "Reward HIVE")              \
+    X(REWARD_HBD, "Reward HBD")                \
+    X(REWARD_VESTS, "Reward VESTS")            \
+    X(DELEGATOR, "Delegator")                  \
+    X(DELEGATEE, "Delegatee")                  \
+    X(RECEIVER, "Receiver")                    \
+    X(START_DATE, "Start date")                \
+    X(END_DATE, "End date")                    \
+    X(DAILY_PAY, "Daily pay")                  \
+    X(SUBJECT, "Subject")                      \
+    X(PROPOSALS, "Proposals")                  \
+    X(PROPOSAL_OWNER, "Proposal owner")        \
+    X(RECURRENCE, "Recurrence")                \
+    X(EXECUTIONS, "Executions")                \
+    X(PROPERTIES, "Properties")                \
+    X(SUBSIDY_BUDGET, "Acc. subsidy budget")   \
+    X(SUBSIDY_DECAY, "Acc. subsidy decay")     \
+    X(HBD_EXCHANGE_RATE, "HBD exchange rate")  \
+    X(SBD_EXCHANGE_RATE, "SBD exchange rate")  \
+    X(SBD_INTEREST_RATE, "SBD interest rate")  \
+    X(NEW_SIGNING_KEY, "New signing key")
+
+/**
+ * Names of supported operations by operation number, the identifier is the name itself.
+ * X(operation number, name)
+ */
+#define OPERATION_NAMES(X) \
+    X(0, vote)                          \
+    X(1, comment)                       \
+    X(2, transfer)                      \
+    X(3, transfer_to_vesting)           \
+    X(4, withdraw_vesting)              \
+    X(5, limit_order_create)            \
+    X(6, limit_order_cancel)            \
+    X(7, feed_publish)                  \
+    X(8, convert)                       \
+    X(9, account_create)                \
+    X(10, account_update)               \
+    X(11, witness_update)               \
+    X(12, account_witness_vote)         \
+    X(13, account_witness_proxy)        \
+    X(17, delete_comment)               \
+    X(18, custom_json)                  \
+    X(19, comment_options)              \
+    X(20, set_withdraw_vesting_route)   \
+    X(22, claim_account)                \
+    X(23, create_claimed_account)       \
+    X(24, request_account_recovery)     \
+    X(25, recover_account)              \
+    X(26, change_recovery_account)      \
+    X(32, transfer_to_savings)          \
+    X(33, transfer_from_savings)        \
+    X(34, cancel_transfer_from_savings) \
+    X(36, decline_voting_rights)        \
+    X(37, reset_account)                \
+    X(38, set_reset_account)            \
+    X(39, claim_reward_balance)         \
+    X(40, delegate_vesting_shares)      \
+    X(42, witness_set_properties)       \
+    X(44, create_proposal)              \
+    X(45, update_proposal_votes)        \
+    X(46, remove_proposal)              \
+    X(47, update_proposal)              \
+    X(48, collateralized_convert)       \
+    X(49, recurrent_transfer)
+
+/**
+ * Number of operation numbers covered by OPERATION_NAMES
+ */
+#define MAX_OPERATION_NUMBER 50
+
+/**
+ * Layout of the name pool: NUL terminated names packed one after another, so the offset of a member is the offset
+ * of the name in the pool. The pool starts with an empty string, offset 0 is an empty name.
+ */
+#define NAME_POOL_FIELD(id, text) char field_##id[sizeof(text)];
+#define NAME_POOL_OPERATION(number, name) char operation_##name[sizeof(#name)];
+
+typedef struct {
+    char empty[1];
+    FIELD_NAMES(NAME_POOL_FIELD)
+    OPERATION_NAMES(NAME_POOL_OPERATION)
+} name_pool_t;
+
+/**
+ * Offset of field name in the name pool
+ */
+#define FIELD_NAME(id) ((uint16_t) offsetof(name_pool_t, field_##id))
+
+/**
+ * Get name stored in the name pool.
+ *
+ * @param[in] offset
+ *   Offset of the name, i.e. FIELD_NAME(id).
+ *
+ * @return pointer to NUL terminated name.
+ *
+ */
+const char *name_pool_get(uint16_t offset);
+
+/**
+ * Get name of operation.
+ *
+ * @param[in] operation_number
+ *   Hive operation number.
+ *
+ * @return pointer to NUL terminated name, NULL if the operation number is unknown.
+ *
+ */
+const char *operation_name(uint8_t operation_number);
@@ -0,0 +1,157 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <string.h>
+
+#include "operation_ir.h"
+#include "decoders.h"
+#include "custom_json.h"
+#include "field.h"
+#include "perf.h"
+#include "common/macros.h"
+#include "common/read.h"
+
+/* Field types of decoders reading a single value, fields of other decoders are composite */
+static const struct {
+    decoder_t *decoder;
+    field_type_e type;
+} FIELD_TYPES[] = {
+    {&decoder_operation_name, FIELD_TYPE_UINT},
+    {&decoder_boolean, FIELD_TYPE_UINT},
+    {&decoder_date_time, FIELD_TYPE_UINT},
+    {&decoder_uint8, FIELD_TYPE_UINT},
+    {&decoder_uint16, FIELD_TYPE_UINT},
+    {&decoder_uint32, FIELD_TYPE_UINT},
+    {&decoder_uint64, FIELD_TYPE_UINT},
+    {&decoder_weight, FIELD_TYPE_UINT},
+    {&decoder_string, FIELD_TYPE_STRING},
+    {&decoder_custom_json, FIELD_TYPE_JSON},
+    {&decoder_asset, FIELD_TYPE_ASSET},
+    {&decoder_public_key, FIELD_TYPE_PUBLIC_KEY},
+    {&decoder_authority_type, FIELD_TYPE_AUTHORITY},
+};
+
+/**
+ * Get field type of values read by the decoder, decoders are compared as stored in parsers (before PIC)
+ */
+static field_type_e get_field_type(decoder_t *decoder) {
+    for (size_t i = 0; i < ARRAYLEN(FIELD_TYPES); i++) {
+        if (FIELD_TYPES[i].decoder == decoder) {
+            return FIELD_TYPES[i].type;
+        }
+    }
+
+    return FIELD_TYPE_COMPOSITE;
+}
+
+bool operation_ir_build(buffer_t *operation, const parser_t *parser, operation_ir_t *ir) {
+    ir->size = 0;
+
+    for (uint8_t i = 0; i < parser->size; i++) {
+        /* Use PIC macro to access const functions (stored in .text area) */
+        decoder_t *decoder = (decoder_t *) PIC(parser->decoders[i]);
+        size_t start = operation->offset;
+
+        if (!(*decoder)(operation, NULL, true)) {
+            return false;
+        }
+
+        ir->fields[i].type = get_field_type(parser->decoders[i]);
+        ir->fields[i].offset = (uint16_t) start;
+        ir->fields[i].length = (uint16_t) (operation->offset - start);
+        ir->size++;
+    }
+
+    return true;
+}
+
+buffer_t operation_ir_slice(const uint8_t *operation, const field_ir_t *field) {
+    return (buffer_t){.ptr = (uint8_t *) operation + field->offset, .size = field->length, .offset = 0};
+}
+
+uint64_t operation_ir_uint(const uint8_t *operation, const field_ir_t *field) {
+    const uint8_t *value = operation + field->offset;
+
+    switch (field->length) {
+        case sizeof(uint8_t):
+            return value[0];
+        case sizeof(uint16_t):
+            return read_u16_le(value, 0);
+        case sizeof(uint32_t):
+            return read_u32_le(value, 0);
+        case sizeof(uint64_t):
+            return read_u64_le(value, 0);
+        default:
+            return 0;
+    }
+}
+
+size_t operation_ir_string(const uint8_t *operation, const field_ir_t *field, const char **value) {
+    buffer_t string = operation_ir_slice(operation, field);
+    uint32_t length;
+
+    // varint length prefix is followed by the characters, both were validated by the hash pass
+    buffer_read_varint(&string, &length);
+    *value = (const char *) string.ptr + string.offset;
+
+    return length;
+}
+
+void operation_ir_asset(const uint8_t *operation, const field_ir_t *field, asset_t *asset) {
+    memcpy(asset, operation + field->offset, sizeof(asset_t));
+}
+
+bool operation_ir_equal(const uint8_t *operation, const field_ir_t *field, const uint8_t *other_operation, const field_ir_t *other_field) {
+    return field->length == other_field->length && memcmp(operation + field->offset, other_operation + other_field->offset, field->length) == 0;
+}
+
+/**
+ * Render custom_json payload with the id of the same operation, so that payloads of known ids are shown compactly
+ */
+static bool render_json(const uint8_t *operation, const operation_ir_t *ir, uint8_t position, field_t *field) {
+    const char *id = NULL;
+    size_t id_length = 0;
+    const char *json;
+    size_t json_length = operation_ir_string(operation, &ir->fields[position], &json);
+
+    // id is the field preceding the payload
+    if (position > 0 && ir->fields[position - 1].type == FIELD_TYPE_STRING) {
+        id_length = operation_ir_string(operation, &ir->fields[position - 1], &id);
+    }
+
+    field_clear_value(field);
+    custom_json_render(id, id_length, json, json_length, field);
+
+    return true;
+}
+
+bool operation_ir_render(const uint8_t *operation, const parser_t *parser, const operation_ir_t *ir, uint8_t position, field_t *field) {
+    if (position >= ir->size) {
+        return false;
+    }
+
+    PERF_STATS_DECODER();
+
+    if (ir->fields[position].type == FIELD_TYPE_JSON) {
+        return render_json(operation, ir, position, field);
+    }
+
+    buffer_t value = operation_ir_slice(operation, &ir->fields[position]);
+    decoder_t *decoder = (decoder_t *) PIC(parser->decoders[position]);
+
+    return (*decoder)(&value, field, false);
+}
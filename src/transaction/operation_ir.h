@@ -0,0 +1,103 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "types.h"
+#include "common/buffer.h"
+#include "common/format.h"
+
+/**
+ * Validate and hash serialized operation field by field, recording type and position of every field. Fields are
+ * checked once here, accessors below read them without bounds checks.
+ *
+ * @param[in,out] operation
+ *  Pointer to buffer with serialized operation, offset is moved past its last field
+ * @param[in] parser
+ *  Pointer to the operation parser
+ * @param[out] ir
+ *  Pointer to the typed representation to fill
+ * @return true if every field is valid, false otherwise
+ */
+bool operation_ir_build(buffer_t *operation, const parser_t *parser, operation_ir_t *ir);
+
+/**
+ * Get buffer holding exactly the serialized field
+ *
+ * @param[in] operation
+ *  Pointer to serialized operation
+ * @param[in] field
+ *  Pointer to the field
+ * @return buffer with the field at offset 0
+ */
+buffer_t operation_ir_slice(const uint8_t *operation, const field_ir_t *field);
+
+/**
+ * Get value of FIELD_TYPE_UINT field
+ *
+ * @param[in] operation
+ *  Pointer to serialized operation
+ * @param[in] field
+ *  Pointer to the field
+ * @return unsigned integer value
+ */
+uint64_t operation_ir_uint(const uint8_t *operation, const field_ir_t *field);
+
+/**
+ * Get characters of FIELD_TYPE_STRING or FIELD_TYPE_JSON field, they are not null terminated
+ *
+ * @param[in] operation
+ *  Pointer to serialized operation
+ * @param[in] field
+ *  Pointer to the field
+ * @param[out] value
+ *  Pointer to the first character in the operation
+ * @return length of the string
+ */
+size_t operation_ir_string(const uint8_t *operation, const field_ir_t *field, const char **value);
+
+/**
+ * Get value of FIELD_TYPE_ASSET field
+ *
+ * @param[in] operation
+ *  Pointer to serialized operation
+ * @param[in] field
+ *  Pointer to the field
+ * @param[out] asset
+ *  Pointer to the asset to fill
+ */
+void operation_ir_asset(const uint8_t *operation, const field_ir_t *field, asset_t *asset);
+
+/**
+ * Check if two serialized fields are equal
+ *
+ * @param[in] operation
+ *  Pointer to the first serialized operation
+ * @param[in] field
+ *  Pointer to field of the first operation
+ * @param[in] other_operation
+ *  Pointer to the second serialized operation
+ * @param[in] other_field
+ *  Pointer to field of the second operation
+ * @return true if both fields have the same bytes, false otherwise
+ */
+bool operation_ir_equal(const uint8_t *operation, const field_ir_t *field, const uint8_t *other_operation, const field_ir_t *other_field);
+
+/**
+ * Render value of the field at given position with its decoder, page is selected by the field. Only the field itself
+ * is decoded, fields before it are not walked again.
+ *
+ * @param[in] operation
+ *  Pointer to serialized operation
+ * @param[in] parser
+ *  Pointer to the operation parser
+ * @param[in] ir
+ *  Pointer to typed representation of the operation
+ * @param[in] position
+ *  Field position in the operation parser
+ * @param[in,out] field
+ *  Pointer to the field with selected page, see field_reset
+ * @return true if success, false otherwise
+ */
+bool operation_ir_render(const uint8_t *operation, const parser_t *parser, const operation_ir_t *ir, uint8_t position, field_t *field);
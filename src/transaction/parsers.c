@@ -18,6 +18,7 @@
 #include "parsers.h"
 #include "constants.h"
 #include "decoders.h"
+#include "names.h"
 #include "globals.h"
 #include "common/buffer.h"
 #include "common/asn1.h"
@@ -28,148 +29,148 @@
 // 0 vote
 const parser_t vote_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_string, &decoder_weight}, 
-    .names = {"Operation", "Voter", "Author", "Permlink", "Weight"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(VOTER), FIELD_NAME(AUTHOR), FIELD_NAME(PERMLINK), FIELD_NAME(WEIGHT)},
     .size = 5
 };
 
 // 1 comment
 parser_t const comment_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_string, &decoder_string, &decoder_string, &decoder_string, &decoder_string},
-    .names = {"Operation", "Parent author", "Parent permlink", "Author", "Permlink", "Title", "Body", "JSON metadata"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(PARENT_AUTHOR), FIELD_NAME(PARENT_PERMLINK), FIELD_NAME(AUTHOR), FIELD_NAME(PERMLINK), FIELD_NAME(TITLE), FIELD_NAME(BODY), FIELD_NAME(JSON_METADATA)},
     .size = 8
 };
 
 // 2 transfer && 32 transfer_to_savings
 const parser_t transfer_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_asset, &decoder_string},
-    .names = {"Operation", "From", "To", "Amount", "Memo"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(FROM), FIELD_NAME(TO), FIELD_NAME(AMOUNT), FIELD_NAME(MEMO)},
     .size = 5
 };
 
 // 3 transfer_to_vesting
 const parser_t transfer_to_vesting_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_asset},
-    .names = {"Operation", "From", "To", "Amount"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(FROM), FIELD_NAME(TO), FIELD_NAME(AMOUNT)},
     .size = 4
 };
 
 // 4 withdraw_vesting
 const parser_t withdraw_vesting_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_asset},
-    .names = {"Operation", "Account", "Vesting shares"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(ACCOUNT), FIELD_NAME(VESTING_SHARES)},
     .size = 3
 };
 
 // 5 limit_order_create
 const parser_t limit_order_create_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_uint32, &decoder_asset, &decoder_asset, &decoder_boolean, &decoder_date_time},
-    .names = {"Operation", "Owner", "Order ID", "Amount to sell", "Min to receive", "Fill or kill", "Expiration"}, 
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(OWNER), FIELD_NAME(ORDER_ID), FIELD_NAME(AMOUNT_TO_SELL), FIELD_NAME(MIN_TO_RECEIVE), FIELD_NAME(FILL_OR_KILL), FIELD_NAME(EXPIRATION)}, 
     .size = 7
 };
 
 // 6 limit_order_cancel
 const parser_t limit_order_cancel_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_uint32},
-    .names = {"Operation", "Owner", "Order ID"}, 
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(OWNER), FIELD_NAME(ORDER_ID)}, 
     .size = 3
 };
 
 // 7 feed_publish
 const parser_t feed_publish_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_asset, &decoder_asset},
-    .names = {"Operation", "Publisher", "Base", "Quote"}, 
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(PUBLISHER), FIELD_NAME(BASE), FIELD_NAME(QUOTE)}, 
     .size = 4
 };
 
 // 8 convert
 const parser_t convert_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_uint32, &decoder_asset},
-    .names = {"Operation", "Owner", "Request ID", "Amount"}, 
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(OWNER), FIELD_NAME(REQUEST_ID), FIELD_NAME(AMOUNT)}, 
     .size = 4
 };
 
 // 9 account_create
 const parser_t account_create_parser = {
     .decoders = {&decoder_operation_name, &decoder_asset, &decoder_string, &decoder_string, &decoder_authority_type, &decoder_authority_type, &decoder_authority_type, &decoder_public_key, &decoder_string},
-    .names = {"Operation", "Fee", "Creator", "New acc. name", "Owner", "Active", "Posting", "Memo key", "JSON metadata"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(FEE), FIELD_NAME(CREATOR), FIELD_NAME(NEW_ACC_NAME), FIELD_NAME(OWNER), FIELD_NAME(ACTIVE), FIELD_NAME(POSTING), FIELD_NAME(MEMO_KEY), FIELD_NAME(JSON_METADATA)},
     .size = 9
 };
 
 // 10 account_update
 const parser_t account_update_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_optional_authority_type, &decoder_optional_authority_type, &decoder_optional_authority_type, &decoder_public_key, &decoder_string},
-    .names = {"Operation", "Account", "Owner", "Active", "Posting", "Memo key", "JSON metadata"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(ACCOUNT), FIELD_NAME(OWNER), FIELD_NAME(ACTIVE), FIELD_NAME(POSTING), FIELD_NAME(MEMO_KEY), FIELD_NAME(JSON_METADATA)},
     .size = 7
 };
 
 // 11 witness_update
 const parser_t witness_update_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_public_key, &decoder_asset, &decoder_uint32, &decoder_weight, &decoder_asset},
-    .names = {"Operation", "Owner", "Url", "Signing key", "Acc. creation fee", "Max block size", "HBD interest rate", "Fee"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(OWNER), FIELD_NAME(URL), FIELD_NAME(SIGNING_KEY), FIELD_NAME(ACC_CREATION_FEE), FIELD_NAME(MAX_BLOCK_SIZE), FIELD_NAME(HBD_INTEREST_RATE), FIELD_NAME(FEE)},
     .size = 8
 };
 
 // 12 account_witness_vote
 parser_t const account_witness_vote_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_boolean},
-    .names = {"Operation", "Account", "Witness", "Approve"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(ACCOUNT), FIELD_NAME(WITNESS), FIELD_NAME(APPROVE)},
     .size = 4
 };
 
 // 13 set_witness_proxy
 const parser_t set_witness_proxy_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string},
-    .names = {"Operation", "Account", "Proxy"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(ACCOUNT), FIELD_NAME(PROXY)},
     .size = 3
 };
 
 // 17 delete_comment
 const parser_t delete_comment_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string},
-    .names = {"Operation", "Author", "Permlink"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(AUTHOR), FIELD_NAME(PERMLINK)},
     .size = 3
 };
 
 // 18 custom_json
 const parser_t custom_json_parser = {
-    .decoders = {&decoder_operation_name, &decoder_array_of_strings, &decoder_array_of_strings, &decoder_string, &decoder_string},
-    .names = {"Operation", "Req. auths", "Req. posting auths", "ID", "JSON"},
+    .decoders = {&decoder_operation_name, &decoder_array_of_strings, &decoder_array_of_strings, &decoder_string, &decoder_custom_json},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(REQ_AUTHS), FIELD_NAME(REQ_POSTING_AUTHS), FIELD_NAME(ID), FIELD_NAME(JSON)},
     .size = 5
 };
 
 // 19 comment_options
 const parser_t comment_options_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_asset, &decoder_weight, &decoder_boolean, &decoder_boolean, &decoder_beneficiaries_extensions},
-    .names = {"Operation", "Author", "Permlink", "Max payout", "Percent HBD", "Allow votes", "Allow curation", "Extensions"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(AUTHOR), FIELD_NAME(PERMLINK), FIELD_NAME(MAX_PAYOUT), FIELD_NAME(PERCENT_HBD), FIELD_NAME(ALLOW_VOTES), FIELD_NAME(ALLOW_CURATION), FIELD_NAME(EXTENSIONS)},
     .size = 8
 };
 
 // 20 set_withdraw_vesting_route
 const parser_t set_withdraw_vesting_route_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_weight, &decoder_boolean},
-    .names = {"Operation", "From account", "To account", "Percent", "Autovest"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(FROM_ACCOUNT), FIELD_NAME(TO_ACCOUNT), FIELD_NAME(PERCENT), FIELD_NAME(AUTOVEST)},
     .size = 5
 };
 
 // 22 claim_account
 const parser_t claim_account_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_asset},
-    .names = {"Operation", "Creator", "Fee"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(CREATOR), FIELD_NAME(FEE)},
     .size = 3
 };
 
 // 23 create_claimed_account
 const parser_t create_claimed_account_parser = {
-    .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_authority_type, &decoder_authority_type, &decoder_authority_type, &decoder_public_key, &decoder_string},
-    .names = {"Operation", "Creator", "New acc. name", "Owner", "Active", "Posting", "Memo key", "JSON metadata"},
-    .size = 8
+    .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_authority_type, &decoder_authority_type, &decoder_authority_type, &decoder_public_key, &decoder_string, &decoder_empty_extensions},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(CREATOR), FIELD_NAME(NEW_ACC_NAME), FIELD_NAME(OWNER), FIELD_NAME(ACTIVE), FIELD_NAME(POSTING), FIELD_NAME(MEMO_KEY), FIELD_NAME(JSON_METADATA), FIELD_NAME(EXTENSIONS)},
+    .size = 9
 };
 
 
 // 24 request_account_recovery
 const parser_t request_account_recovery_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_authority_type, &decoder_empty_extensions},
-    .names = {"Operation", "Recovery account", "Acc. to recover", "New owner auth", "Extensions"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(RECOVERY_ACCOUNT), FIELD_NAME(ACC_TO_RECOVER), FIELD_NAME(NEW_OWNER_AUTH), FIELD_NAME(EXTENSIONS)},
     .size = 5
 };
 
@@ -177,105 +178,112 @@ const parser_t request_account_recovery_parser = {
 // 25 recover_account
 const parser_t recover_account_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_authority_type, &decoder_authority_type, &decoder_empty_extensions},
-    .names = {"Operation", "Acc. to recover", "New owner auth", "Rec. owner auth", "Extensions"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(ACC_TO_RECOVER), FIELD_NAME(NEW_OWNER_AUTH), FIELD_NAME(REC_OWNER_AUTH), FIELD_NAME(EXTENSIONS)},
     .size = 5
 };
 
 // 26 change_recovery_account
 const parser_t change_recovery_account_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_empty_extensions},
-    .names = {"Operation", "Acc. to recover", "New recovery acc", "Extensions"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(ACC_TO_RECOVER), FIELD_NAME(NEW_RECOVERY_ACC), FIELD_NAME(EXTENSIONS)},
     .size = 4
 };
 
 // 33 transfer_from_savings
 const parser_t transfer_from_savings_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_uint32, &decoder_string, &decoder_asset, &decoder_string},
-    .names = {"Operation", "From", "Request ID", "To", "Amount", "Memo"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(FROM), FIELD_NAME(REQUEST_ID), FIELD_NAME(TO), FIELD_NAME(AMOUNT), FIELD_NAME(MEMO)},
     .size = 6
 };
 
 // 34 cancel_transfer_from_savings
 const parser_t cancel_transfer_from_savings_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_uint32},
-    .names = {"Operation", "From", "Request ID"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(FROM), FIELD_NAME(REQUEST_ID)},
     .size = 3
 };
 
 // 36 decline_voting_rights
 const parser_t decline_voting_rights_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_boolean},
-    .names = {"Operation", "Account", "Decline"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(ACCOUNT), FIELD_NAME(DECLINE)},
     .size = 3
 };
 
 // 37 reset_account
 const parser_t reset_account_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_authority_type},
-    .names = {"Operation", "Reset account", "Acc. to reset", "New owner auths"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(RESET_ACCOUNT), FIELD_NAME(ACC_TO_RESET), FIELD_NAME(NEW_OWNER_AUTHS)},
     .size = 4
 };
 
 // 38 set_reset_account
 const parser_t set_reset_account_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_string},
-    .names = {"Operation", "Account", "Cur. reset acc.", "New reset acc."},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(ACCOUNT), FIELD_NAME(CUR_RESET_ACC), FIELD_NAME(NEW_RESET_ACC)},
     .size = 4
 };
 
 // 39 claim_reward_balance
 const parser_t claim_reward_balance_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_asset, &decoder_asset, &decoder_asset},
-    .names = {"Operation", "Account", "Reward HIVE", "Reward HBD", "Reward VESTS"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(ACCOUNT), FIELD_NAME(REWARD_HIVE), FIELD_NAME(REWARD_HBD), FIELD_NAME(REWARD_VESTS)},
     .size = 5
 };
 
 // 40 delegate_vesting_shares
 const parser_t delegate_vesting_shares_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_asset},
-    .names = {"Operation", "Delegator", "Delegatee", "Vesting shares"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(DELEGATOR), FIELD_NAME(DELEGATEE), FIELD_NAME(VESTING_SHARES)},
+    .size = 4
+};
+
+// 42 witness_set_properties
+const parser_t witness_set_properties_parser = {
+    .decoders = {&decoder_operation_name, &decoder_string, &decoder_witness_properties, &decoder_empty_extensions},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(OWNER), FIELD_NAME(PROPERTIES), FIELD_NAME(EXTENSIONS)},
     .size = 4
 };
 
 // 44 create_proposal
 const parser_t create_proposal_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_date_time, &decoder_date_time, &decoder_asset, &decoder_string, &decoder_string, &decoder_empty_extensions},
-    .names = {"Operation", "Creator", "Receiver", "Start date", "End date", "Daily pay", "Subject", "Permlink", "Extensions"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(CREATOR), FIELD_NAME(RECEIVER), FIELD_NAME(START_DATE), FIELD_NAME(END_DATE), FIELD_NAME(DAILY_PAY), FIELD_NAME(SUBJECT), FIELD_NAME(PERMLINK), FIELD_NAME(EXTENSIONS)},
     .size = 9
 };
 
 // 45 update_proposal_votes
 const parser_t update_proposal_votes_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_array_of_u64, &decoder_boolean, &decoder_empty_extensions},
-    .names = {"Operation", "Voter", "Proposals", "Approve", "Extensions"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(VOTER), FIELD_NAME(PROPOSALS), FIELD_NAME(APPROVE), FIELD_NAME(EXTENSIONS)},
     .size = 5
 };
 
 // 46 remove_proposal
 const parser_t remove_proposal_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_array_of_u64},
-    .names = {"Operation", "Proposal owner", "Proposals"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(PROPOSAL_OWNER), FIELD_NAME(PROPOSALS)},
     .size = 3
 };
 
 // 47 update_proposal
 const parser_t update_proposal_parser = {
     .decoders = {&decoder_operation_name, &decoder_uint32, &decoder_array_of_u64},
-    .names = {"Operation", "Proposal owner", "Proposals"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(PROPOSAL_OWNER), FIELD_NAME(PROPOSALS)},
     .size = 3
 };
 
 // 48 collateralized_convert
 const parser_t collateralized_convert_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_uint32, &decoder_asset},
-    .names = {"Operation", "Owner", "Request ID", "Amount"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(OWNER), FIELD_NAME(REQUEST_ID), FIELD_NAME(AMOUNT)},
     .size = 4
 };
 
 // 49 recurrent_transfer
 const parser_t recurrent_transfer_parser = {
     .decoders = {&decoder_operation_name, &decoder_string, &decoder_string, &decoder_asset, &decoder_string, &decoder_uint16, &decoder_uint16},
-    .names = {"Operation", "From", "To", "Amount", "Memo", "Recurrence", "Executions"},
+    .names = {FIELD_NAME(OPERATION), FIELD_NAME(FROM), FIELD_NAME(TO), FIELD_NAME(AMOUNT), FIELD_NAME(MEMO), FIELD_NAME(RECURRENCE), FIELD_NAME(EXECUTIONS)},
     .size = 7
 };
 
@@ -345,6 +353,8 @@ const parser_t *get_operation_parser(uint8_t operation_nr) {
             return &claim_reward_balance_parser;
         case 40:
             return &delegate_vesting_shares_parser;
+        case 42:
+            return &witness_set_properties_parser;
         case 44:
             return &create_proposal_parser;
         case 45:
@@ -0,0 +1,186 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "session_policy.h"
+#include "operation_ir.h"
+#include "constants.h"
+#include "globals.h"
+#include "common/buffer.h"
+#include "common/bip32.h"
+
+/**
+ * Read length prefixed string into null terminated output buffer
+ */
+static bool read_string(buffer_t *buf, char *out, size_t out_len) {
+    uint8_t length;
+
+    if (!buffer_read_u8(buf, &length) || length >= out_len || !buffer_move_partial(buf, (uint8_t *) out, out_len - 1, length)) {
+        return false;
+    }
+
+    out[length] = '\0';
+
+    return true;
+}
+
+/**
+ * Check if length prefixed string in the buffer equals to the expected one
+ */
+static bool read_string_equal(buffer_t *buf, const char *expected) {
+    uint8_t length;
+
+    if (!buffer_read_u8(buf, &length) || !buffer_can_read(buf, length)) {
+        return false;
+    }
+
+    bool equal = length == strlen(expected) && memcmp(buf->ptr + buf->offset, expected, length) == 0;
+
+    return buffer_seek_cur(buf, length) && equal;
+}
+
+/**
+ * Check if string field of the operation in global context equals to the expected one
+ */
+static bool field_string_equal(uint8_t position, const char *expected) {
+    const char *value;
+    size_t length = operation_ir_string(G_context.tx_info.operation.ptr, &G_context.tx_info.ir.fields[position], &value);
+
+    return length == strlen(expected) && memcmp(value, expected, length) == 0;
+}
+
+parser_status_e session_policy_parse(buffer_t *buf, session_policy_t *policy) {
+    memset(policy, 0, sizeof(session_policy_t));
+
+    /* Parse:
+     *  - BIP32 path
+     */
+    if (!buffer_read_u8(buf, &policy->bip32_path_len) || !buffer_read_bip32_path(buf, policy->bip32_path, (size_t) policy->bip32_path_len)) {
+        return BIP32_PATH_PARSING_ERROR;
+    }
+
+    /* Parse:
+     *  - operation number
+     *  - signatures limit
+     *  - account name
+     */
+    if (!buffer_read_u8(buf, &policy->operation) || !buffer_read_u16(buf, &policy->remaining, BE) ||
+        !read_string(buf, policy->account, sizeof(policy->account)) || policy->account[0] == '\0') {
+        return FIELD_PARSING_ERROR;
+    }
+
+    /* Parse operation specific limits:
+     *  - vote: weight range
+     *  - custom_json: allowed id (empty for any)
+     */
+    switch (policy->operation) {
+        case OPERATION_VOTE:
+            if (!buffer_read_u16(buf, (uint16_t *) &policy->min_weight, BE) || !buffer_read_u16(buf, (uint16_t *) &policy->max_weight, BE) ||
+                policy->min_weight > policy->max_weight || policy->min_weight < -10000 || policy->max_weight > 10000) {
+                return FIELD_PARSING_ERROR;
+            }
+            break;
+        case OPERATION_CUSTOM_JSON:
+            if (!read_string(buf, policy->custom_json_id, sizeof(policy->custom_json_id))) {
+                return FIELD_PARSING_ERROR;
+            }
+            break;
+        default:
+            return FIELD_PARSING_ERROR;
+    }
+
+    return (buf->offset == buf->size) ? PARSING_OK : WRONG_LENGTH_ERROR;
+}
+
+/**
+ * vote: voter (1), author, permlink, weight (4)
+ */
+static bool match_vote(const session_policy_t *policy) {
+    const int16_t weight = (int16_t) operation_ir_uint(G_context.tx_info.operation.ptr, &G_context.tx_info.ir.fields[4]);
+
+    return field_string_equal(1, policy->account) && weight >= policy->min_weight && weight <= policy->max_weight;
+}
+
+/**
+ * custom_json: required_auths (1), required_posting_auths (2), id (3), json
+ */
+static bool match_custom_json(const session_policy_t *policy) {
+    buffer_t required_auths = operation_ir_slice(G_context.tx_info.operation.ptr, &G_context.tx_info.ir.fields[1]);
+    buffer_t required_posting_auths = operation_ir_slice(G_context.tx_info.operation.ptr, &G_context.tx_info.ir.fields[2]);
+    uint8_t count;
+
+    // active authority is never covered by the session policy
+    if (!buffer_read_u8(&required_auths, &count) || count != 0) {
+        return false;
+    }
+
+    // policy account has to be the only posting authority
+    if (!buffer_read_u8(&required_posting_auths, &count) || count != 1 || !read_string_equal(&required_posting_auths, policy->account)) {
+        return false;
+    }
+
+    if (policy->custom_json_id[0] == '\0') {
+        return true;
+    }
+
+    return field_string_equal(3, policy->custom_json_id);
+}
+
+bool session_policy_match(const session_policy_t *policy) {
+    uint8_t operation_nr;
+
+    if (!policy->active || N_settings.session_signing_policy != SESSION_SIGNING_ENABLED) {
+        return false;
+    }
+
+    if (policy->bip32_path_len != G_context.bip32_path_len ||
+        memcmp(policy->bip32_path, G_context.bip32_path, sizeof(uint32_t) * policy->bip32_path_len) != 0) {
+        return false;
+    }
+
+    if (G_context.tx_info.ir.size == 0) {
+        return false;
+    }
+
+    operation_nr = (uint8_t) operation_ir_uint(G_context.tx_info.operation.ptr, &G_context.tx_info.ir.fields[0]);
+    if (operation_nr != policy->operation) {
+        return false;
+    }
+
+    switch (operation_nr) {
+        case OPERATION_VOTE:
+            return match_vote(policy);
+        case OPERATION_CUSTOM_JSON:
+            return match_custom_json(policy);
+        default:
+            return false;
+    }
+}
+
+void session_policy_consume(session_policy_t *policy) {
+    if (policy->remaining == 0) {
+        // unlimited until the app exits
+        return;
+    }
+
+    if (--policy->remaining == 0) {
+        explicit_bzero(policy, sizeof(session_policy_t));
+    }
+}
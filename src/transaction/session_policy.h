@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "types.h"
+#include "common/buffer.h"
+
+/**
+ * Operation number of vote operation
+ */
+#define OPERATION_VOTE 0
+
+/**
+ * Operation number of custom_json operation
+ */
+#define OPERATION_CUSTOM_JSON 18
+
+/**
+ * Parse session policy sent with SET_SESSION_POLICY command
+ *
+ * @param[in] buf
+ *  Pointer to buffer with BIP32 path and policy parameters
+ * @param[out] policy
+ *  Pointer to policy structure to fill
+ * @return PARSING_OK if success, error status otherwise.
+ */
+parser_status_e session_policy_parse(buffer_t *buf, session_policy_t *policy);
+
+/**
+ * Check if parsed transaction in global context is covered by the session policy
+ *
+ * @param[in] policy
+ *  Pointer to the approved session policy
+ * @return true if transaction can be signed with a single confirmation, false otherwise
+ */
+bool session_policy_match(const session_policy_t *policy);
+
+/**
+ * Account one signature made under the session policy, clear the policy when the limit is reached
+ *
+ * @param[in,out] policy
+ *  Pointer to the approved session policy
+ */
+void session_policy_consume(session_policy_t *policy);
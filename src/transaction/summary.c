@@ -0,0 +1,104 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "summary.h"
+#include "field.h"
+#include "operation_ir.h"
+#include "globals.h"
+#include "types.h"
+#include "common/macros.h"
+
+typedef struct {
+    uint8_t operation;
+    const char *template;
+} summary_template_t;
+
+// $N is replaced with the value of N-th field of the operation parser
+static const summary_template_t summary_templates[] = {
+    {0, "Vote $4 @$2/$3 by @$1"},                       // vote
+    {2, "Transfer $3 from @$1 to @$2 memo: $4"},        // transfer
+    {18, "custom_json $3: $4 posting: $2 active: $1"},  // custom_json
+    {39, "Claim $2, $3, $4 to @$1"},                    // claim_reward_balance
+};
+
+/**
+ * Decode N-th field of the operation in global context
+ */
+static bool decode_field(uint8_t index, field_t *field) {
+    field_reset(field, 0);
+
+    if (!operation_ir_render(G_context.tx_info.operation.ptr, G_context.tx_info.parser, &G_context.tx_info.ir, index, field)) {
+        return false;
+    }
+
+    // value longer than a single page would be truncated
+    return field_page_count(field) == 1;
+}
+
+/**
+ * Append string to the output buffer, fail if it does not fit
+ */
+static bool append(char *out, size_t out_len, size_t *offset, const char *value, size_t value_len) {
+    if (*offset + value_len >= out_len) {
+        return false;
+    }
+
+    memcpy(out + *offset, value, value_len);
+    *offset += value_len;
+    out[*offset] = '\0';
+
+    return true;
+}
+
+bool summary_format(char *out, size_t out_len) {
+    const char *template = NULL;
+    uint8_t operation_nr = G_context.tx_info.operation.ptr[0];
+
+    for (uint8_t i = 0; i < ARRAYLEN(summary_templates); i++) {
+        if (summary_templates[i].operation == operation_nr) {
+            template = (const char *) PIC(summary_templates[i].template);
+            break;
+        }
+    }
+
+    if (template == NULL || out_len == 0) {
+        return false;
+    }
+
+    field_t *field = &G_scratch_field;
+    size_t offset = 0;
+    out[0] = '\0';
+
+    for (const char *c = template; *c != '\0'; c++) {
+        if (*c == '$' && c[1] >= '0' && c[1] <= '9') {
+            uint8_t index = c[1] - '0';
+            c++;
+
+            if (index >= G_context.tx_info.parser->size || !decode_field(index, field) || !append(out, out_len, &offset, field->value, strlen(field->value))) {
+                return false;
+            }
+        } else if (!append(out, out_len, &offset, c, 1)) {
+            // truncated summary could hide part of the operation, details have to be reviewed instead
+            return false;
+        }
+    }
+
+    return true;
+}
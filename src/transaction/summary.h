@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Render one sentence summary of the parsed operation in global context (i.e "Vote 50.00% @author/permlink by @voter")
+ *
+ * Summary is built from a per operation template, where $N is replaced with decoded value of N-th operation field.
+ *
+ * @param[out] out
+ *  Pointer to output buffer
+ * @param[in] out_len
+ *  Length of output buffer
+ * @return true if operation has a summary template and rendered summary fits the buffer, false otherwise
+ */
+bool summary_format(char *out, size_t out_len);
@@ -0,0 +1,143 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "template_diff.h"
+#include "field.h"
+#include "operation_ir.h"
+#include "globals.h"
+#include "common/macros.h"
+
+#define TEMPLATE_DIFF_SEPARATOR     " -> "
+#define TEMPLATE_DIFF_SEPARATOR_LEN (sizeof(TEMPLATE_DIFF_SEPARATOR) - 1)
+
+/**
+ * Get template slot for given operation number, NULL if operation is not reviewed as a diff
+ */
+static operation_template_t *get_template(uint8_t operation) {
+    switch (operation) {
+        case OPERATION_FEED_PUBLISH:
+            return &G_operation_templates[0];
+        case OPERATION_WITNESS_UPDATE:
+            return &G_operation_templates[1];
+        default:
+            return NULL;
+    }
+}
+
+/**
+ * Get template matching operation type and signing key of the transaction in global context
+ */
+static const operation_template_t *get_matching_template(void) {
+    const operation_template_t *template = get_template(G_context.tx_info.operation.ptr[0]);
+
+    if (template == NULL || template->size == 0 || template->operation != G_context.tx_info.operation.ptr[0] ||
+        template->bip32_path_len != G_context.bip32_path_len ||
+        memcmp(template->bip32_path, G_context.bip32_path, sizeof(uint32_t) * template->bip32_path_len) != 0) {
+        return NULL;
+    }
+
+    return template;
+}
+
+bool template_diff_compute(void) {
+    G_context.tx_info.changed_fields = TEMPLATE_DIFF_ALL_FIELDS;
+
+    const operation_template_t *template = get_matching_template();
+    if (template == NULL) {
+        return false;
+    }
+
+    const operation_ir_t *current = &G_context.tx_info.ir;
+    const operation_ir_t *previous = &template->ir;
+    uint16_t changed_fields = 0;
+
+    if (current->size != previous->size) {
+        return false;
+    }
+
+    // Compare raw bytes of each field, operation name is always displayed
+    for (uint8_t i = 0; i < current->size; i++) {
+        if (i == 0 || !operation_ir_equal(G_context.tx_info.operation.ptr, &current->fields[i], template->raw, &previous->fields[i])) {
+            changed_fields |= (1 << i);
+        }
+    }
+
+    G_context.tx_info.changed_fields = changed_fields;
+
+    return true;
+}
+
+bool template_diff_is_changed(int8_t position) {
+    return position < 0 || (G_context.tx_info.changed_fields & (1 << position)) != 0;
+}
+
+void template_diff_format_field(int8_t position, field_t *field) {
+    const operation_template_t *template = get_matching_template();
+
+    // Nothing to compare with or value is displayed in pages
+    if (position <= 0 || G_context.tx_info.changed_fields == TEMPLATE_DIFF_ALL_FIELDS || template == NULL || field_page_count(field) > 1) {
+        return;
+    }
+
+    field_t *previous_field = &G_scratch_field;
+
+    field_reset(previous_field, 0);
+    operation_ir_render(template->raw, G_context.tx_info.parser, &template->ir, (uint8_t) position, previous_field);
+
+    if (field_page_count(previous_field) > 1) {
+        return;
+    }
+
+    const size_t previous_len = strlen(previous_field->value);
+    const size_t current_len = strlen(field->value);
+
+    // Do not display truncated value, show the new one only
+    if (previous_len + TEMPLATE_DIFF_SEPARATOR_LEN + current_len >= MEMBER_SIZE(field_t, value)) {
+        return;
+    }
+
+    // "old -> new", current value is moved behind the previous one with its terminator
+    memmove(field->value + previous_len + TEMPLATE_DIFF_SEPARATOR_LEN, field->value, current_len + 1);
+    memmove(field->value, previous_field->value, previous_len);
+    memmove(field->value + previous_len, TEMPLATE_DIFF_SEPARATOR, TEMPLATE_DIFF_SEPARATOR_LEN);
+    field->length = previous_len + TEMPLATE_DIFF_SEPARATOR_LEN + current_len;
+}
+
+void template_diff_store(void) {
+    operation_template_t *template = get_template(G_context.tx_info.operation.ptr[0]);
+
+    if (template == NULL) {
+        return;
+    }
+
+    if (G_context.tx_info.operation.size > sizeof(template->raw)) {
+        // too big to be kept, next operation of this type will be fully reviewed
+        explicit_bzero(template, sizeof(operation_template_t));
+        return;
+    }
+
+    template->operation = G_context.tx_info.operation.ptr[0];
+    memcpy(template->raw, G_context.tx_info.operation.ptr, G_context.tx_info.operation.size);
+    template->size = G_context.tx_info.operation.size;
+    // offsets of the fields are the same in the copy
+    template->ir = G_context.tx_info.ir;
+    memcpy(template->bip32_path, G_context.bip32_path, sizeof(template->bip32_path));
+    template->bip32_path_len = G_context.bip32_path_len;
+}
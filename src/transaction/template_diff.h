@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "types.h"
+
+/**
+ * Operation number of feed_publish operation
+ */
+#define OPERATION_FEED_PUBLISH 7
+
+/**
+ * Operation number of witness_update operation
+ */
+#define OPERATION_WITNESS_UPDATE 11
+
+/**
+ * Bitmask marking all operation fields to be reviewed
+ */
+#define TEMPLATE_DIFF_ALL_FIELDS 0xFFFF
+
+/**
+ * Compare parsed transaction in global context with the last approved operation of the same type
+ * and mark fields which differ from it in G_context.tx_info.changed_fields
+ *
+ * @return true if template was found and only changed fields have to be reviewed, false otherwise
+ */
+bool template_diff_compute(void);
+
+/**
+ * Check if field at given position has to be reviewed
+ *
+ * @param[in] position
+ *  Field position in the operation parser
+ * @return true if field is displayed to the user, false otherwise
+ */
+bool template_diff_is_changed(int8_t position);
+
+/**
+ * Prepend previous value of the changed field to its current value (i.e "0.312 HBD -> 0.318 HBD")
+ *
+ * @param[in] position
+ *  Field position in the operation parser
+ * @param[in,out] field
+ *  Pointer to the field already filled with the current value
+ */
+void template_diff_format_field(int8_t position, field_t *field);
+
+/**
+ * Keep operation from global context as a template for the next transaction of the same type
+ */
+void template_diff_store(void);
@@ -20,8 +20,10 @@
 #include "parsers.h"
 #include "constants.h"
 #include "decoders.h"
+#include "operation_ir.h"
 #include "globals.h"
 #include "common/buffer.h"
+#include "perf.h"
 #include "common/asn1.h"
 #include "common/bip32.h"
 
@@ -37,6 +39,8 @@ parser_status_e transaction_parse(buffer_t *buf) {
         return WRONG_LENGTH_ERROR;
     }
 
+    PERF_STATS_TRANSACTION();
+
     /* Parse:
      *  - BIP32 path
      */
@@ -56,7 +60,7 @@ parser_status_e transaction_parse(buffer_t *buf) {
         if (!buffer_read_tlv(buf, data, sizeof(data), &tag, &length)) {
             return FIELD_PARSING_ERROR;
         }
-        cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, data, length, NULL, 0);
+        transaction_hash_update(data, length);
     }
 
     if (data[0] != 1) {
@@ -75,15 +79,9 @@ parser_status_e transaction_parse(buffer_t *buf) {
     G_context.tx_info.operation = (buffer_t){.ptr = G_context.tx_info.raw_tx + buf->offset - length, .size = length, .offset = 0};
     G_context.tx_info.parser = get_operation_parser(G_context.tx_info.operation.ptr[0]);
 
-    // Hash operation
-    for (uint8_t i = 0; i < G_context.tx_info.parser->size; i++) {
-        decoder_t *fun = (decoder_t *) PIC(G_context.tx_info.parser->decoders[i]);
-
-        // check if it's correct
-        bool result = (*fun)(&G_context.tx_info.operation, NULL, true);
-        if (!result) {
-            return FIELD_PARSING_ERROR;
-        }
+    // Hash operation, fields are validated once here and rendered from their typed representation later
+    if (!operation_ir_build(&G_context.tx_info.operation, G_context.tx_info.parser, &G_context.tx_info.ir)) {
+        return FIELD_PARSING_ERROR;
     }
 
     G_context.tx_info.operation.offset = 0;
@@ -96,7 +94,7 @@ parser_status_e transaction_parse(buffer_t *buf) {
         return FIELD_PARSING_ERROR;
     }
 
-    cx_hash((cx_hash_t *) &G_context.tx_info.sha, 0, data, 1, NULL, 0);
+    transaction_hash_update(data, 1);
 
     return (buf->offset == buf->size) ? PARSING_OK : WRONG_LENGTH_ERROR;
 }
@@ -7,6 +7,7 @@
 #include "common/buffer.h"
 #include "common/wif.h"
 #include "common/bip32.h"
+#include "common/format.h"
 
 #include "os.h"
 #include "cx.h"
@@ -16,7 +17,9 @@
  */
 typedef struct {
     char title[60];
-    char value[255];
+    char value[255];  /// single page of rendered value
+    uint8_t page;     /// index of value page to render
+    uint16_t length;  /// length of whole rendered value, across all pages
 } field_t;
 
 /**
@@ -37,12 +40,22 @@ typedef enum {
  * Enumeration with expected INS of APDU commands.
  */
 typedef enum {
-    GET_PUBLIC_KEY = 0x02,    /// public key of corresponding BIP32 path
-    SIGN_TRANSACTION = 0x04,  /// sign transaction with BIP32 path
-    GET_VERSION = 0x06,       /// version of the application
-    GET_APP_NAME = 0x08,      /// name of the application
-    SIGN_HASH = 0x10,         /// sign hash with BIP32 path
-    GET_SETTINGS = 0x12       /// settings of the application
+    GET_PUBLIC_KEY = 0x02,       /// public key of corresponding BIP32 path
+    SIGN_TRANSACTION = 0x04,     /// sign transaction with BIP32 path
+    GET_VERSION = 0x06,          /// version of the application
+    GET_APP_NAME = 0x08,         /// name of the application
+    SIGN_HASH = 0x10,            /// sign hash with BIP32 path
+    GET_SETTINGS = 0x12,         /// settings of the application
+    SET_SESSION_POLICY = 0x14,   /// set or clear pre-approved signing session policy
+    SIGN_MESSAGE = 0x16,         /// sign arbitrary message with BIP32 path
+    GET_ECDH_SECRETS = 0x18,     /// memo key shared secrets with a batch of counterparties
+    DECRYPT_MEMO = 0x1A,         /// decrypt memo and display it on the device
+    GET_PERF_STATS = 0x1C,       /// performance counters, debug builds only
+    GET_LAST_SIGNATURE = 0x1E,   /// last signature of given digest, after a lost response
+    PREVIEW_TRANSACTION = 0x20,  /// parse transaction and return rendered fields, without review
+    CREATE_ACCOUNT = 0x22,       /// sign account creation with keys derived on the device
+    SET_KEY_INDEX = 0x24,        /// set or reset derived paths of the key ownership index
+    GET_RESPONSE = 0xC0          /// next part of chained response
 } command_e;
 
 /**
@@ -71,9 +84,15 @@ typedef enum {
  * Enumeration with user request type.
  */
 typedef enum {
-    CONFIRM_PUBLIC_KEY,   /// confirm public key formatted in a Hive way
-    CONFIRM_TRANSACTION,  /// confirm transaction information
-    CONFIRM_HASH          /// confirm hash
+    CONFIRM_PUBLIC_KEY,     /// confirm public key formatted in a Hive way
+    CONFIRM_TRANSACTION,    /// confirm transaction information
+    CONFIRM_HASH,           /// confirm hash
+    CONFIRM_SESSION_POLICY,  /// confirm signing session policy
+    CONFIRM_MESSAGE,         /// confirm arbitrary message
+    CONFIRM_ECDH,            /// confirm shared secrets export
+    DISPLAY_MEMO,            /// display decrypted memo
+    RENDER_TRANSACTION,      /// render transaction fields without review
+    CONFIRM_ACCOUNT          /// confirm account creation with keys derived on the device
 } request_type_e;
 
 /**
@@ -86,11 +105,41 @@ typedef bool decoder_t(buffer_t *, field_t *, bool);
  * Operation parser, will decode and hash properties from serialized operation
  */
 typedef struct parser_t {
-    decoder_t *decoders[9];
-    char names[9][30];
+    decoder_t *decoders[MAX_OPERATION_FIELDS];
+    uint16_t names[MAX_OPERATION_FIELDS];  /// offsets of field names in the name pool, see transaction/names.h
     uint8_t size;
 } parser_t;
 
+/**
+ * Type of serialized operation field, given by its decoder
+ */
+typedef enum {
+    FIELD_TYPE_COMPOSITE,  /// array, optional authority or extensions, read by its decoder only
+    FIELD_TYPE_AUTHORITY,  /// authority, read by its decoder only
+    FIELD_TYPE_UINT,       /// little endian unsigned integer, i.e. operation number, boolean, date or weight
+    FIELD_TYPE_STRING,     /// string prefixed with its length
+    FIELD_TYPE_JSON,       /// custom_json payload prefixed with its length, rendered with the id preceding it
+    FIELD_TYPE_ASSET,      /// amount, precision and symbol, see asset_t
+    FIELD_TYPE_PUBLIC_KEY  /// compressed public key
+} field_type_e;
+
+/**
+ * Field of validated operation, value is read straight from the serialized operation without bounds checks
+ */
+typedef struct {
+    uint8_t type;     /// field_type_e
+    uint16_t offset;  /// offset of serialized field in the operation
+    uint16_t length;  /// length of serialized field
+} field_ir_t;
+
+/**
+ * Typed representation of validated operation, built once by the hash pass of transaction_parse
+ */
+typedef struct {
+    field_ir_t fields[MAX_OPERATION_FIELDS];  /// fields in the order of the operation parser
+    uint8_t size;                             /// number of fields
+} operation_ir_t;
+
 /**
  * Structure for public key context information.
  */
@@ -109,6 +158,9 @@ typedef struct {
 
     const parser_t *parser;
     buffer_t operation;
+    operation_ir_t ir;        /// fields of the operation, see transaction/operation_ir.h
+    uint16_t changed_fields;  /// bitmask of fields to review, differing from the last approved template
+    bool label_own_keys;      /// whether keys derived on this device are labelled, set for the review screens only
 
     uint8_t digest[DIGEST_LEN];        /// message digest
     uint8_t signature[SIGNATURE_LEN];  /// compact transaction signature supported by Hive backend
@@ -124,15 +176,134 @@ typedef struct {
     uint8_t signature[SIGNATURE_LEN];  /// compact hash signature supported by Hive backend
 } hash_ctx_t;
 
+/**
+ * Structure for arbitrary message signing context, message itself is never buffered
+ */
+typedef struct {
+    cx_sha256_t sha;                            /// message hash computed while streaming
+    uint32_t length;                            /// total length of the message
+    uint8_t prefix[CHAIN_ID_LEN];               /// beginning of the message, to detect serialized transactions
+    char preview[MAX_MESSAGE_PREVIEW_LEN + 1];  /// printable preview of the beginning of the message
+    uint8_t digest[DIGEST_LEN];                 /// message digest
+    uint8_t signature[SIGNATURE_LEN];           /// compact message signature supported by Hive backend
+} message_ctx_t;
+
+/**
+ * Structure for batch of counterparties whose shared secrets with the memo key are requested
+ */
+typedef struct {
+    uint8_t public_keys[MAX_ECDH_KEYS][PUBKEY_COMPRESSED_LEN];  /// compressed counterparty public keys
+    char wifs[MAX_ECDH_KEYS * (PUBKEY_WIF_STR_LEN + 1)];         /// counterparty public keys in Hive format, comma separated
+    uint8_t count;                                              /// number of counterparties in the batch
+    uint8_t secrets[MAX_ECDH_KEYS * ECDH_SECRET_LEN];           /// computed shared secrets
+} ecdh_ctx_t;
+
+/**
+ * Structure for memo decryption context, ciphertext is decrypted chunk by chunk and never buffered
+ */
+typedef struct {
+    cx_aes_key_t key;                       /// AES-256 key derived from the shared secret and nonce
+    uint8_t iv[AES_BLOCK_LEN];              /// CBC chaining value, previous ciphertext block
+    uint8_t block[AES_BLOCK_LEN];           /// ciphertext block collected across chunks
+    uint8_t block_len;                      /// number of bytes collected in block
+    uint32_t encrypted_len;                 /// length of the whole ciphertext
+    uint32_t received_len;                  /// length of ciphertext received so far
+    uint32_t text_remaining;                /// memo characters not decrypted yet
+    bool text_length_read;                  /// whether memo length prefix was decrypted
+    bool is_sender;                         /// whether memo key is the sender of the memo
+    char counterparty[PUBKEY_WIF_STR_LEN];  /// other party public key in Hive format
+    char page[MAX_MEMO_PAGE_LEN + 1];       /// printable memo text decrypted from the last chunk
+    uint16_t page_len;                      /// length of the page
+    uint8_t page_number;                    /// index of the page, starting with 1
+} memo_ctx_t;
+
+/**
+ * Structure for pre-approved signing session policy
+ */
+typedef struct {
+    uint8_t operation;                                /// operation number covered by the policy
+    char account[MAX_HIVE_ACCOUNT_NAME_LEN + 1];      /// voter or the only required posting authority
+    char custom_json_id[MAX_CUSTOM_JSON_ID_LEN + 1];  /// allowed custom_json id, empty for any id
+    int16_t min_weight;                               /// minimal vote weight (basis points)
+    int16_t max_weight;                               /// maximal vote weight (basis points)
+    uint16_t remaining;                               /// signatures left, 0 means until the app exits
+    uint32_t bip32_path[MAX_BIP32_PATH];              /// BIP32 path of the key the policy is bound to
+    uint8_t bip32_path_len;                           /// length of BIP32 path
+    bool active;                                      /// whether policy was approved by the user
+} session_policy_t;
+
+/**
+ * Structure for account creation request, the transaction is assembled on the device
+ */
+typedef struct {
+    uint32_t bip32_path[MAX_BIP32_PATH];                   /// BIP32 path of the creator key signing the transaction
+    uint8_t bip32_path_len;                                /// length of BIP32 path
+    uint8_t chain_id[CHAIN_ID_LEN];                        /// chain id the transaction is signed for
+    uint8_t header[TRANSACTION_HEADER_LEN];                /// serialized ref_block_num, ref_block_prefix and expiration
+    uint8_t operation;                                     /// account_create or create_claimed_account
+    asset_t fee;                                           /// account creation fee, account_create only
+    char creator[MAX_HIVE_ACCOUNT_NAME_LEN + 1];           /// creator of the new account
+    char new_account_name[MAX_HIVE_ACCOUNT_NAME_LEN + 1];  /// name of the new account
+    uint32_t account_index;                                /// SLIP-48 account index the new keys are derived at
+} account_request_t;
+
+/**
+ * Key of this device in the key ownership index
+ */
+typedef struct {
+    uint8_t fingerprint[KEY_FINGERPRINT_LEN];  /// beginning of compressed public key
+    uint8_t role;                              /// SLIP-48 role, not hardened
+    uint8_t account;                           /// account index, relative to the first indexed account
+} key_index_entry_t;
+
+/**
+ * Structure for index of public keys derived on this device, sorted by fingerprint
+ */
+typedef struct {
+    uint32_t first_account;                            /// first indexed account, not hardened
+    uint8_t account_count;                             /// number of indexed accounts, 0 for the default set
+    uint8_t roles;                                     /// indexed SLIP-48 roles, bit n set for role n, 0 for the default set
+    key_index_entry_t entries[MAX_KEY_INDEX_ENTRIES];  /// indexed keys sorted by fingerprint
+    uint8_t size;                                      /// number of indexed keys
+    bool built;                                        /// whether keys of the configured paths were derived
+} key_index_t;
+
+/**
+ * Structure for last approved operation of given type, used for diff review
+ */
+typedef struct {
+    uint8_t operation;                    /// operation number
+    uint8_t raw[MAX_TEMPLATE_LEN];        /// serialized operation approved by the user
+    uint16_t size;                        /// length of serialized operation, 0 if there is no template
+    operation_ir_t ir;                    /// fields of the serialized operation
+    uint32_t bip32_path[MAX_BIP32_PATH];  /// BIP32 path the operation was signed with
+    uint8_t bip32_path_len;               /// length of BIP32 path
+} operation_template_t;
+
+/**
+ * Structure for the last produced signature, kept for a short time so it can be fetched again if the response is lost
+ */
+typedef struct {
+    uint8_t digest[DIGEST_LEN];           /// signed digest
+    uint8_t signature[SIGNATURE_LEN];     /// compact signature of the digest
+    uint32_t bip32_path[MAX_BIP32_PATH];  /// BIP32 path of the signing key
+    uint8_t bip32_path_len;               /// length of BIP32 path
+    uint16_t ttl;                         /// ticker events left before it is wiped, 0 if there is no signature
+} last_signature_t;
+
 /**
  * Structure for global context.
  */
 typedef struct {
     state_e state;  /// state of the context
     union {
-        pubkey_ctx_t pk_info;       /// public key context
-        transaction_ctx_t tx_info;  /// transaction context
-        hash_ctx_t hash_info;       /// hash signing context
+        pubkey_ctx_t pk_info;          /// public key context
+        transaction_ctx_t tx_info;     /// transaction context
+        hash_ctx_t hash_info;          /// hash signing context
+        session_policy_t policy_info;  /// session policy waiting for user approval
+        message_ctx_t message_info;    /// message signing context
+        ecdh_ctx_t ecdh_info;          /// shared secrets export context
+        memo_ctx_t memo_info;          /// memo decryption context
     };
     request_type_e req_type;              /// user request
     uint32_t bip32_path[MAX_BIP32_PATH];  /// BIP32 path
@@ -150,7 +321,13 @@ typedef enum {
 
 typedef enum { DISABLED = 0x00, ENABLED = 0x01 } sign_hash_policy_t;
 
+typedef enum { SESSION_SIGNING_DISABLED = 0x00, SESSION_SIGNING_ENABLED = 0x01 } session_signing_policy_t;
+
+typedef enum { SUMMARY_REVIEW_DISABLED = 0x00, SUMMARY_REVIEW_ENABLED = 0x01 } summary_review_policy_t;
+
 typedef struct {
     uint8_t initialized;
     sign_hash_policy_t sign_hash_policy;
+    session_signing_policy_t session_signing_policy;
+    summary_review_policy_t summary_review_policy;
 } settings_t;
\ No newline at end of file
@@ -17,14 +17,29 @@
  *****************************************************************************/
 
 #include <stdbool.h>  // bool
+#include <string.h>   // explicit_bzero
 
 #include "validate.h"
 #include "ui/menu.h"
+#include "ui/screens/signing_progress.h"
 #include "sw.h"
 #include "io.h"
 #include "crypto.h"
 #include "globals.h"
+#include "transaction/session_policy.h"
+#include "transaction/template_diff.h"
+#include "transaction/last_signature.h"
 #include "helper/send_response.h"
+#include "perf.h"
+
+/**
+ * Update the attempt number and let SEPROXYHAL process pending events between nonce candidates, so neither the screen
+ * nor the transport freeze while unlucky digests need several candidates
+ */
+static void ui_action_signing_progress(uint32_t attempts) {
+    ui_update_signing_progress(attempts);
+    io_seproxyhal_io_heartbeat();
+}
 
 void ui_action_validate_pubkey(bool choice) {
     if (choice) {
@@ -36,22 +51,101 @@ void ui_action_validate_pubkey(bool choice) {
     ui_menu_main(NULL);
 }
 
+/**
+ * Finalize hash of the approved transaction and sign it, the signature is kept in case the response is lost
+ */
+static bool sign_transaction(void) {
+    G_context.state = STATE_APPROVED;
+
+    ui_display_signing_progress("Transaction");
+
+    // refresh the display before intensive operation
+    io_seproxyhal_io_heartbeat();
+
+    // store hash (take 0 bytes from current hash and copy it to the output buffer)
+    PERF_BEGIN(PERF_HASH_FINAL);
+    cx_hash_final((cx_hash_t *) &G_context.tx_info.sha, G_context.tx_info.digest);
+    PERF_END(PERF_HASH_FINAL);
+
+    PERF_BEGIN(PERF_SIGN_DIGEST);
+    const bool signed_digest = crypto_sign_digest(G_context.tx_info.digest, G_context.tx_info.signature, &ui_action_signing_progress);
+    PERF_END(PERF_SIGN_DIGEST);
+
+    if (signed_digest) {
+        // kept before sending, the response may be lost with the link
+        last_signature_store(G_context.tx_info.digest, G_context.tx_info.signature);
+    }
+
+    return signed_digest;
+}
+
 void ui_action_validate_transaction(bool choice) {
+    if (choice) {
+        if (!sign_transaction()) {
+            io_send_sw(SW_SIGNATURE_FAIL);
+        } else {
+            // keep approved operation so the next one of the same type can be reviewed as a diff
+            template_diff_store();
+            helper_send_response_sig(G_context.tx_info.signature, MEMBER_SIZE(transaction_ctx_t, signature));
+        }
+    } else {
+        io_send_sw(SW_DENY);
+    }
+
+    G_context.state = STATE_NONE;
+    ui_menu_main(NULL);
+}
+
+void ui_action_validate_account(bool choice) {
+    if (choice) {
+        if (!sign_transaction()) {
+            io_send_sw(SW_SIGNATURE_FAIL);
+        } else {
+            helper_send_response_account();
+        }
+    } else {
+        io_send_sw(SW_DENY);
+    }
+
+    G_context.state = STATE_NONE;
+    ui_menu_main(NULL);
+}
+
+void ui_action_validate_session_transaction(bool choice) {
+    if (choice) {
+        session_policy_consume(&G_session_policy);
+    }
+
+    ui_action_validate_transaction(choice);
+}
+
+void ui_action_validate_session_policy(bool choice) {
+    if (choice) {
+        G_session_policy = G_context.policy_info;
+        G_session_policy.active = true;
+        io_send_sw(SW_OK);
+    } else {
+        io_send_sw(SW_DENY);
+    }
+
+    G_context.state = STATE_NONE;
+    ui_menu_main(NULL);
+}
+
+void ui_action_validate_hash(bool choice) {
     if (choice) {
         G_context.state = STATE_APPROVED;
 
-        ui_display_signing_message();
+        ui_display_signing_progress("hash");
 
         // refresh the display before intensive operation
         io_seproxyhal_io_heartbeat();
 
-        // store hash (take 0 bytes from current hash and copy it to the output buffer)
-        cx_hash_final((cx_hash_t *) &G_context.tx_info.sha, G_context.tx_info.digest);
-
-        if (!crypto_sign_digest(G_context.tx_info.digest, G_context.tx_info.signature)) {
+        if (!crypto_sign_digest(G_context.hash_info.hash, G_context.hash_info.signature, &ui_action_signing_progress)) {
             io_send_sw(SW_SIGNATURE_FAIL);
         } else {
-            helper_send_response_sig(G_context.tx_info.signature, MEMBER_SIZE(transaction_ctx_t, signature));
+            last_signature_store(G_context.hash_info.hash, G_context.hash_info.signature);
+            helper_send_response_sig(G_context.hash_info.signature, MEMBER_SIZE(hash_ctx_t, signature));
         }
     } else {
         io_send_sw(SW_DENY);
@@ -61,24 +155,85 @@ void ui_action_validate_transaction(bool choice) {
     ui_menu_main(NULL);
 }
 
-void ui_action_validate_hash(bool choice) {
+void ui_action_validate_message(bool choice) {
     if (choice) {
         G_context.state = STATE_APPROVED;
 
-        ui_display_signing_hash_message();
+        ui_display_signing_progress("message");
 
         // refresh the display before intensive operation
         io_seproxyhal_io_heartbeat();
 
-        if (!crypto_sign_digest(G_context.hash_info.hash, G_context.hash_info.signature)) {
+        cx_hash_final((cx_hash_t *) &G_context.message_info.sha, G_context.message_info.digest);
+
+        if (!crypto_sign_digest(G_context.message_info.digest, G_context.message_info.signature, &ui_action_signing_progress)) {
             io_send_sw(SW_SIGNATURE_FAIL);
         } else {
-            helper_send_response_sig(G_context.hash_info.signature, MEMBER_SIZE(hash_ctx_t, signature));
+            last_signature_store(G_context.message_info.digest, G_context.message_info.signature);
+            helper_send_response_sig(G_context.message_info.signature, MEMBER_SIZE(message_ctx_t, signature));
+        }
+    } else {
+        io_send_sw(SW_DENY);
+    }
+
+    G_context.state = STATE_NONE;
+    ui_menu_main(NULL);
+}
+
+void ui_action_validate_ecdh(bool choice) {
+    if (choice) {
+        cx_ecfp_private_key_t private_key = {0};
+        uint8_t chain_code[CHAINCODE_LEN] = {0};
+        ecdh_ctx_t *ecdh = &G_context.ecdh_info;
+        bool is_valid = true;
+
+        G_context.state = STATE_APPROVED;
+
+        ui_display_computing_ecdh_message();
+
+        // refresh the display before intensive operation
+        io_seproxyhal_io_heartbeat();
+
+        // private key is derived once for the whole batch
+        crypto_derive_private_key(&private_key, chain_code, G_context.bip32_path, G_context.bip32_path_len);
+
+        for (uint8_t i = 0; i < ecdh->count && is_valid; i++) {
+            is_valid = crypto_ecdh_shared_secret(&private_key, ecdh->public_keys[i], ecdh->secrets + i * ECDH_SECRET_LEN);
+            io_seproxyhal_io_heartbeat();
         }
+
+        explicit_bzero(&private_key, sizeof(private_key));
+        explicit_bzero(chain_code, sizeof(chain_code));
+
+        if (!is_valid) {
+            io_send_sw(SW_ECDH_PARSING_FAIL);
+        } else {
+            io_send_response(&(const buffer_t){.ptr = ecdh->secrets, .size = ecdh->count * ECDH_SECRET_LEN, .offset = 0}, SW_OK);
+        }
+
+        explicit_bzero(ecdh->secrets, sizeof(ecdh->secrets));
     } else {
         io_send_sw(SW_DENY);
     }
 
     G_context.state = STATE_NONE;
     ui_menu_main(NULL);
-}
\ No newline at end of file
+}
+
+void ui_action_validate_memo(bool choice) {
+    if (choice) {
+        io_send_sw(SW_OK);
+
+        if (G_context.state == STATE_TX_RECEIVING) {
+            // keep decryption state for the next chunk
+            ui_menu_main(NULL);
+            return;
+        }
+    } else {
+        io_send_sw(SW_DENY);
+    }
+
+    explicit_bzero(&G_context.memo_info, sizeof(G_context.memo_info));
+    G_context.state = STATE_NONE;
+    ui_menu_main(NULL);
+}
@@ -3,6 +3,11 @@
 #include <stdbool.h>  // bool
 #include "ui/screens/review_transaction.h"
 #include "ui/screens/review_hash.h"
+#include "ui/screens/review_session_policy.h"
+#include "ui/screens/review_message.h"
+#include "ui/screens/review_ecdh.h"
+#include "ui/screens/review_memo.h"
+#include "ui/screens/review_account.h"
 
 /**
  * Action for public key validation and export.
@@ -22,6 +27,33 @@ void ui_action_validate_pubkey(bool choice);
  */
 void ui_action_validate_transaction(bool choice);
 
+/**
+ * Action for transaction signed under the session policy with a single confirmation.
+ *
+ * @param[in] choice
+ *   User choice (either approved or rejected).
+ *
+ */
+void ui_action_validate_session_transaction(bool choice);
+
+/**
+ * Action for account creation validation, signs the transaction and sends back the new public keys.
+ *
+ * @param[in] choice
+ *   User choice (either approved or rejected).
+ *
+ */
+void ui_action_validate_account(bool choice);
+
+/**
+ * Action for session policy validation.
+ *
+ * @param[in] choice
+ *   User choice (either approved or rejected).
+ *
+ */
+void ui_action_validate_session_policy(bool choice);
+
 /**
  * Action for hash information validation.
  *
@@ -30,3 +62,30 @@ void ui_action_validate_transaction(bool choice);
  *
  */
 void ui_action_validate_hash(bool choice);
+
+/**
+ * Action for message information validation.
+ *
+ * @param[in] choice
+ *   User choice (either approved or rejected).
+ *
+ */
+void ui_action_validate_message(bool choice);
+
+/**
+ * Action for shared secrets export validation.
+ *
+ * @param[in] choice
+ *   User choice (either approved or rejected).
+ *
+ */
+void ui_action_validate_ecdh(bool choice);
+
+/**
+ * Action for decrypted memo page, either request the next page or stop decryption.
+ *
+ * @param[in] choice
+ *   User choice (either next page or cancel).
+ *
+ */
+void ui_action_validate_memo(bool choice);
@@ -0,0 +1,201 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ui/screens/review_account.h"
+#include "transaction/account_create.h"
+#include "transaction/names.h"
+#include "transaction/operation_ir.h"
+
+static action_validate_cb g_validate_callback;
+static char g_bip32_path[60];
+static char g_operation[sizeof("create_claimed_account")];
+static char g_creator[MAX_HIVE_ACCOUNT_NAME_LEN + 1];
+static char g_new_account[MAX_HIVE_ACCOUNT_NAME_LEN + 1];
+static char g_fee[MAX_HIVE_ASSET_LEN + 1];
+static char g_keys[sizeof("This device, account 2147483647")];
+
+#ifdef TARGET_NANOS
+// Step with title/text for BIP32 path
+UX_STEP_NOCB(ux_display_account_path_step,
+             bn_paging,
+             {
+                 .title = "Signing key path",
+                 .text = g_bip32_path,
+             });
+
+// Step with title/text for keys of the new account
+UX_STEP_NOCB(ux_display_account_keys_step,
+             bn_paging,
+             {
+                 .title = "Keys",
+                 .text = g_keys,
+             });
+
+// For Nano X and S+ utilize all three lines of text
+#else
+// Step with title/text for BIP32 path
+UX_STEP_NOCB(ux_display_account_path_step,
+             bnnn_paging,
+             {
+                 .title = "Signing key path",
+                 .text = g_bip32_path,
+             });
+
+// Step with title/text for keys of the new account
+UX_STEP_NOCB(ux_display_account_keys_step,
+             bnnn_paging,
+             {
+                 .title = "Keys",
+                 .text = g_keys,
+             });
+#endif
+
+// Step with title/text for operation
+UX_STEP_NOCB(ux_display_account_operation_step,
+             bn_paging,
+             {
+                 .title = "Operation",
+                 .text = g_operation,
+             });
+
+// Step with title/text for creator
+UX_STEP_NOCB(ux_display_account_creator_step,
+             bn,
+             {
+                 "Creator",
+                 g_creator,
+             });
+
+// Step with title/text for new account name
+UX_STEP_NOCB(ux_display_account_name_step,
+             bn,
+             {
+                 "New account",
+                 g_new_account,
+             });
+
+// Step with title/text for account creation fee
+UX_STEP_NOCB(ux_display_account_fee_step,
+             bn,
+             {
+                 "Fee",
+                 g_fee,
+             });
+
+// Step with approve button
+UX_STEP_CB(ux_display_account_approve_step,
+           pb,
+           (*g_validate_callback)(true),
+           {
+               &C_icon_validate_14,
+               "Approve",
+           });
+// Step with reject button
+UX_STEP_CB(ux_display_account_reject_step,
+           pb,
+           (*g_validate_callback)(false),
+           {
+               &C_icon_crossmark,
+               "Reject",
+           });
+
+// Step with icon and text
+UX_STEP_NOCB(ux_display_review_account_step,
+             pnn,
+             {
+                 &C_icon_eye,
+                 "Review",
+                 "Account creation",
+             });
+
+// FLOW to display account creation:
+// #1 screen : eye icon + "Review Account creation"
+// #2 screen : operation
+// #3 screen : creator
+// #4 screen : new account name
+// #5 screen : fee
+// #6 screen : keys of the new account
+// #7 screen : signing key path
+// #8 screen : approve button
+// #9 screen : reject button
+UX_FLOW(ux_display_account_flow,
+        &ux_display_review_account_step,
+        &ux_display_account_operation_step,
+        &ux_display_account_creator_step,
+        &ux_display_account_name_step,
+        &ux_display_account_fee_step,
+        &ux_display_account_keys_step,
+        &ux_display_account_path_step,
+        &ux_display_account_approve_step,
+        &ux_display_account_reject_step,
+        FLOW_LOOP);
+
+/**
+ * Copy string field of the operation in global context into null terminated output buffer
+ */
+static void copy_string_field(uint8_t position, char *out, size_t out_len) {
+    const char *value;
+    size_t length = operation_ir_string(G_context.tx_info.operation.ptr, &G_context.tx_info.ir.fields[position], &value);
+
+    snprintf(out, out_len, "%.*s", (int) length, value);
+}
+
+int ui_display_account(uint32_t account_index) {
+    const uint8_t *operation = G_context.tx_info.operation.ptr;
+    const operation_ir_t *ir = &G_context.tx_info.ir;
+
+    if (G_context.req_type != CONFIRM_ACCOUNT || G_context.state != STATE_PARSED) {
+        G_context.state = STATE_NONE;
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    memset(g_bip32_path, 0, sizeof(g_bip32_path));
+    if (!bip32_path_format(G_context.bip32_path, G_context.bip32_path_len, g_bip32_path, sizeof(g_bip32_path))) {
+        return io_send_sw(SW_WRONG_BIP32_PATH);
+    }
+
+    const uint8_t operation_nr = (uint8_t) operation_ir_uint(operation, &ir->fields[0]);
+    snprintf(g_operation, sizeof(g_operation), "%s", operation_name(operation_nr));
+
+    if (operation_nr == OPERATION_ACCOUNT_CREATE) {
+        // account_create: fee (1), creator (2), new_account_name (3)
+        asset_t fee;
+        operation_ir_asset(operation, &ir->fields[1], &fee);
+        if (!format_asset(&fee, g_fee, sizeof(g_fee))) {
+            return io_send_sw(SW_ACCOUNT_PARSING_FAIL);
+        }
+        copy_string_field(2, g_creator, sizeof(g_creator));
+        copy_string_field(3, g_new_account, sizeof(g_new_account));
+    } else {
+        // create_claimed_account: creator (1), new_account_name (2)
+        snprintf(g_fee, sizeof(g_fee), "Claimed account");
+        copy_string_field(1, g_creator, sizeof(g_creator));
+        copy_string_field(2, g_new_account, sizeof(g_new_account));
+    }
+
+    snprintf(g_keys, sizeof(g_keys), "This device, account %u", (unsigned int) account_index);
+
+    g_validate_callback = &ui_action_validate_account;
+
+    ux_flow_init(0, ux_display_account_flow, NULL);
+
+    return 0;
+}
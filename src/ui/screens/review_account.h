@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "os.h"
+#include "ux.h"
+#include "glyphs.h"
+
+#include "constants.h"
+#include "globals.h"
+#include "io.h"
+#include "sw.h"
+#include "common/bip32.h"
+#include "common/format.h"
+#include "common/macros.h"
+#include "ui/action/validate.h"
+
+/**
+ * Display account creation assembled on the device and ask confirmation to sign it with the creator key
+ *
+ * @param[in] account_index
+ *   Account index the keys of the new account were derived at
+ *
+ * @return 0 if success, negative integer otherwise.
+ *
+ */
+int ui_display_account(uint32_t account_index);
@@ -0,0 +1,149 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ui/screens/review_ecdh.h"
+
+static action_validate_cb g_validate_callback;
+static char g_bip32_path[60];
+static char g_count[20];
+
+#ifdef TARGET_NANOS
+// Step with title/text for BIP32 path
+UX_STEP_NOCB(ux_display_ecdh_path_step,
+             bn_paging,
+             {
+                 .title = "Memo key path",
+                 .text = g_bip32_path,
+             });
+
+// Step with title/text for counterparty public keys
+UX_STEP_NOCB(ux_display_ecdh_keys_step,
+             bn_paging,
+             {
+                 .title = "Counterparties",
+                 .text = G_context.ecdh_info.wifs,
+             });
+
+// For Nano X and S+ utilize all three lines of text
+#else
+// Step with title/text for BIP32 path
+UX_STEP_NOCB(ux_display_ecdh_path_step,
+             bnnn_paging,
+             {
+                 .title = "Memo key path",
+                 .text = g_bip32_path,
+             });
+
+// Step with title/text for counterparty public keys
+UX_STEP_NOCB(ux_display_ecdh_keys_step,
+             bnnn_paging,
+             {
+                 .title = "Counterparties",
+                 .text = G_context.ecdh_info.wifs,
+             });
+#endif
+
+// Step with title/text for number of counterparties
+UX_STEP_NOCB(ux_display_ecdh_count_step,
+             bn,
+             {
+                 "Shared secrets",
+                 g_count,
+             });
+
+// Step with approve button
+UX_STEP_CB(ux_display_ecdh_approve_step,
+           pb,
+           (*g_validate_callback)(true),
+           {
+               &C_icon_validate_14,
+               "Approve",
+           });
+// Step with reject button
+UX_STEP_CB(ux_display_ecdh_reject_step,
+           pb,
+           (*g_validate_callback)(false),
+           {
+               &C_icon_crossmark,
+               "Reject",
+           });
+
+// Step with icon and text
+UX_STEP_NOCB(ux_display_review_ecdh_step,
+             pnn,
+             {
+                 &C_icon_eye,
+                 "Export",
+                 "memo secrets",
+             });
+
+// FLOW to display shared secrets request:
+// #1 screen : eye icon + "Export memo secrets"
+// #2 screen : memo key path
+// #3 screen : number of shared secrets
+// #4 screen : counterparty public keys
+// #5 screen : approve button
+// #6 screen : reject button
+UX_FLOW(ux_display_ecdh_flow,
+        &ux_display_review_ecdh_step,
+        &ux_display_ecdh_path_step,
+        &ux_display_ecdh_count_step,
+        &ux_display_ecdh_keys_step,
+        &ux_display_ecdh_approve_step,
+        &ux_display_ecdh_reject_step,
+        FLOW_LOOP);
+
+// Shared secrets computing step
+UX_STEP_NOCB(ux_display_computing_ecdh_step,
+             pnn,
+             {
+                 &C_icon_processing,
+                 "Computing",
+                 "secrets",
+             });
+
+// FLOW to display computing step:
+// #1 screen : processing icon + "Computing secrets"
+UX_FLOW(ux_display_computing_ecdh_flow, &ux_display_computing_ecdh_step);
+
+void ui_display_computing_ecdh_message() {
+    ux_flow_init(0, ux_display_computing_ecdh_flow, NULL);
+}
+
+int ui_display_ecdh() {
+    if (G_context.req_type != CONFIRM_ECDH || G_context.state != STATE_PARSED) {
+        G_context.state = STATE_NONE;
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    memset(g_bip32_path, 0, sizeof(g_bip32_path));
+    if (!bip32_path_format(G_context.bip32_path, G_context.bip32_path_len, g_bip32_path, sizeof(g_bip32_path))) {
+        return io_send_sw(SW_WRONG_BIP32_PATH);
+    }
+
+    snprintf(g_count, sizeof(g_count), "%u", (unsigned int) G_context.ecdh_info.count);
+
+    g_validate_callback = &ui_action_validate_ecdh;
+
+    ux_flow_init(0, ux_display_ecdh_flow, NULL);
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "os.h"
+#include "ux.h"
+#include "glyphs.h"
+
+#include "constants.h"
+#include "globals.h"
+#include "io.h"
+#include "sw.h"
+#include "common/bip32.h"
+#include "common/macros.h"
+#include "ui/action/validate.h"
+
+/**
+ * Display memo key path and counterparty public keys and ask confirmation once for the whole batch
+ *
+ * @return 0 if success, negative integer otherwise.
+ *
+ */
+int ui_display_ecdh(void);
+
+/**
+ * Initialize "Computing secrets" display when batch got accepted
+ *
+ */
+void ui_display_computing_ecdh_message(void);
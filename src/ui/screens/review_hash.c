@@ -103,23 +103,6 @@ UX_FLOW(ux_display_hash_flow,
         &ux_display_hash_reject_step,
         FLOW_LOOP);
 
-// Transaction signing message step
-UX_STEP_NOCB(ux_display_signing_hash_step,
-             pnn,
-             {
-                 &C_icon_processing,
-                 "Signing",
-                 "hash",
-             });
-
-// FLOW to display transaction signing message:
-// #1 screen : eye processing + "Signing hash"
-UX_FLOW(ux_display_signing_hash_flow, &ux_display_signing_hash_step);
-
-void ui_display_signing_hash_message() {
-    ux_flow_init(0, ux_display_signing_hash_flow, NULL);
-}
-
 int ui_display_hash() {
     if (G_context.req_type != CONFIRM_HASH || G_context.state != STATE_PARSED) {
         G_context.state = STATE_NONE;
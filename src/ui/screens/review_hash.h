@@ -23,9 +23,3 @@
  *
  */
 int ui_display_hash(void);
-
-/**
- * Initialize "Signing hash" display when digest got accepted
- *
- */
-void ui_display_signing_hash_message(void);
\ No newline at end of file
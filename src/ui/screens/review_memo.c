@@ -0,0 +1,130 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ui/screens/review_memo.h"
+
+static action_validate_cb g_validate_callback;
+static char g_counterparty_title[10];
+static char g_page_title[20];
+static char g_next_label[10];
+
+#ifdef TARGET_NANOS
+// Step with title/text for the other party of the memo
+UX_STEP_NOCB(ux_display_memo_counterparty_step,
+             bn_paging,
+             {
+                 .title = g_counterparty_title,
+                 .text = G_context.memo_info.counterparty,
+             });
+
+// Step with title/text for decrypted page of the memo
+UX_STEP_NOCB(ux_display_memo_page_step,
+             bn_paging,
+             {
+                 .title = g_page_title,
+                 .text = G_context.memo_info.page,
+             });
+
+// For Nano X and S+ utilize all three lines of text
+#else
+// Step with title/text for the other party of the memo
+UX_STEP_NOCB(ux_display_memo_counterparty_step,
+             bnnn_paging,
+             {
+                 .title = g_counterparty_title,
+                 .text = G_context.memo_info.counterparty,
+             });
+
+// Step with title/text for decrypted page of the memo
+UX_STEP_NOCB(ux_display_memo_page_step,
+             bnnn_paging,
+             {
+                 .title = g_page_title,
+                 .text = G_context.memo_info.page,
+             });
+#endif
+
+// Step with next page (or done) button
+UX_STEP_CB(ux_display_memo_next_step,
+           pb,
+           (*g_validate_callback)(true),
+           {
+               &C_icon_validate_14,
+               g_next_label,
+           });
+// Step with cancel button
+UX_STEP_CB(ux_display_memo_cancel_step,
+           pb,
+           (*g_validate_callback)(false),
+           {
+               &C_icon_crossmark,
+               "Cancel",
+           });
+
+// Step with icon and text
+UX_STEP_NOCB(ux_display_review_memo_step,
+             pnn,
+             {
+                 &C_icon_eye,
+                 "Decrypted",
+                 "memo",
+             });
+
+// FLOW to display the first page of the memo:
+// #1 screen : eye icon + "Decrypted memo"
+// #2 screen : sender or recipient public key
+// #3 screen : memo text
+// #4 screen : next page (or done) button
+// #5 screen : cancel button
+UX_FLOW(ux_display_memo_first_page_flow,
+        &ux_display_review_memo_step,
+        &ux_display_memo_counterparty_step,
+        &ux_display_memo_page_step,
+        &ux_display_memo_next_step,
+        &ux_display_memo_cancel_step,
+        FLOW_LOOP);
+
+// FLOW to display subsequent pages of the memo:
+// #1 screen : memo text
+// #2 screen : next page (or done) button
+// #3 screen : cancel button
+UX_FLOW(ux_display_memo_page_flow, &ux_display_memo_page_step, &ux_display_memo_next_step, &ux_display_memo_cancel_step, FLOW_LOOP);
+
+int ui_display_memo(bool last) {
+    if (G_context.req_type != DISPLAY_MEMO || (G_context.state != STATE_TX_RECEIVING && G_context.state != STATE_PARSED)) {
+        G_context.state = STATE_NONE;
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    snprintf(g_counterparty_title, sizeof(g_counterparty_title), "%s", G_context.memo_info.is_sender ? "To" : "From");
+    snprintf(g_page_title, sizeof(g_page_title), "Memo (%u)", (unsigned int) G_context.memo_info.page_number);
+    snprintf(g_next_label, sizeof(g_next_label), "%s", last ? "Done" : "Next page");
+
+    g_validate_callback = &ui_action_validate_memo;
+
+    if (G_context.memo_info.page_number == 1) {
+        ux_flow_init(0, ux_display_memo_first_page_flow, NULL);
+    } else {
+        ux_flow_init(0, ux_display_memo_page_flow, NULL);
+    }
+
+    return 0;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "os.h"
+#include "ux.h"
+#include "glyphs.h"
+
+#include "constants.h"
+#include "globals.h"
+#include "io.h"
+#include "sw.h"
+#include "common/macros.h"
+#include "ui/action/validate.h"
+
+/**
+ * Display page of memo decrypted from the last chunk, the first page also shows the other party of the memo
+ *
+ * @param[in] last
+ *   Whether it is the last page of the memo.
+ *
+ * @return 0 if success, negative integer otherwise.
+ *
+ */
+int ui_display_memo(bool last);
@@ -0,0 +1,188 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ui/screens/review_session_policy.h"
+#include "transaction/session_policy.h"
+
+static action_validate_cb g_validate_callback;
+static char g_bip32_path[60];
+static char g_operation[sizeof("custom_json")];
+static char g_account[MAX_HIVE_ACCOUNT_NAME_LEN + 1];
+static char g_limit[MAX_CUSTOM_JSON_ID_LEN + 1];
+static char g_signatures[20];
+
+#ifdef TARGET_NANOS
+// Step with title/text for BIP32 path
+UX_STEP_NOCB(ux_display_policy_path_step,
+             bn_paging,
+             {
+                 .title = "Signing key path",
+                 .text = g_bip32_path,
+             });
+
+// Step with title/text for operation covered by the policy
+UX_STEP_NOCB(ux_display_policy_operation_step,
+             bn_paging,
+             {
+                 .title = "Operation",
+                 .text = g_operation,
+             });
+
+// Step with title/text for operation specific limit
+UX_STEP_NOCB(ux_display_policy_limit_step,
+             bn_paging,
+             {
+                 .title = "Limit",
+                 .text = g_limit,
+             });
+
+// For Nano X and S+ utilize all three lines of text
+#else
+// Step with title/text for BIP32 path
+UX_STEP_NOCB(ux_display_policy_path_step,
+             bnnn_paging,
+             {
+                 .title = "Signing key path",
+                 .text = g_bip32_path,
+             });
+
+// Step with title/text for operation covered by the policy
+UX_STEP_NOCB(ux_display_policy_operation_step,
+             bnnn_paging,
+             {
+                 .title = "Operation",
+                 .text = g_operation,
+             });
+
+// Step with title/text for operation specific limit
+UX_STEP_NOCB(ux_display_policy_limit_step,
+             bnnn_paging,
+             {
+                 .title = "Limit",
+                 .text = g_limit,
+             });
+#endif
+
+// Step with title/text for account
+UX_STEP_NOCB(ux_display_policy_account_step,
+             bn,
+             {
+                 "Account",
+                 g_account,
+             });
+
+// Step with title/text for number of signatures
+UX_STEP_NOCB(ux_display_policy_signatures_step,
+             bn,
+             {
+                 "Signatures",
+                 g_signatures,
+             });
+
+// Step with approve button
+UX_STEP_CB(ux_display_policy_approve_step,
+           pb,
+           (*g_validate_callback)(true),
+           {
+               &C_icon_validate_14,
+               "Approve",
+           });
+// Step with reject button
+UX_STEP_CB(ux_display_policy_reject_step,
+           pb,
+           (*g_validate_callback)(false),
+           {
+               &C_icon_crossmark,
+               "Reject",
+           });
+
+// Step with icon and text
+UX_STEP_NOCB(ux_display_review_policy_step,
+             pnn,
+             {
+                 &C_icon_eye,
+                 "Review",
+                 "Session policy",
+             });
+
+// FLOW to display session policy:
+// #1 screen : eye icon + "Review Session policy"
+// #2 screen : signing key path
+// #3 screen : operation
+// #4 screen : account
+// #5 screen : operation specific limit
+// #6 screen : number of signatures
+// #7 screen : approve button
+// #8 screen : reject button
+UX_FLOW(ux_display_session_policy_flow,
+        &ux_display_review_policy_step,
+        &ux_display_policy_path_step,
+        &ux_display_policy_operation_step,
+        &ux_display_policy_account_step,
+        &ux_display_policy_limit_step,
+        &ux_display_policy_signatures_step,
+        &ux_display_policy_approve_step,
+        &ux_display_policy_reject_step,
+        FLOW_LOOP);
+
+int ui_display_session_policy() {
+    const session_policy_t *policy = &G_context.policy_info;
+
+    if (G_context.req_type != CONFIRM_SESSION_POLICY || G_context.state != STATE_PARSED) {
+        G_context.state = STATE_NONE;
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    memset(g_bip32_path, 0, sizeof(g_bip32_path));
+    if (!bip32_path_format(policy->bip32_path, policy->bip32_path_len, g_bip32_path, sizeof(g_bip32_path))) {
+        return io_send_sw(SW_WRONG_BIP32_PATH);
+    }
+
+    snprintf(g_account, sizeof(g_account), "%s", policy->account);
+
+    if (policy->operation == OPERATION_VOTE) {
+        snprintf(g_operation, sizeof(g_operation), "vote");
+        snprintf(g_limit,
+                 sizeof(g_limit),
+                 "%s%d.%02d%% to %s%d.%02d%%",
+                 policy->min_weight < 0 ? "-" : "",
+                 abs(policy->min_weight) / 100,
+                 abs(policy->min_weight) % 100,
+                 policy->max_weight < 0 ? "-" : "",
+                 abs(policy->max_weight) / 100,
+                 abs(policy->max_weight) % 100);
+    } else {
+        snprintf(g_operation, sizeof(g_operation), "custom_json");
+        snprintf(g_limit, sizeof(g_limit), "%s", policy->custom_json_id[0] != '\0' ? policy->custom_json_id : "Any ID");
+    }
+
+    if (policy->remaining == 0) {
+        snprintf(g_signatures, sizeof(g_signatures), "Until app exit");
+    } else {
+        snprintf(g_signatures, sizeof(g_signatures), "%d", policy->remaining);
+    }
+
+    g_validate_callback = &ui_action_validate_session_policy;
+
+    ux_flow_init(0, ux_display_session_policy_flow, NULL);
+
+    return 0;
+}
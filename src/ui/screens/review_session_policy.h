@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "os.h"
+#include "ux.h"
+#include "glyphs.h"
+
+#include "constants.h"
+#include "globals.h"
+#include "io.h"
+#include "sw.h"
+#include "common/bip32.h"
+#include "common/macros.h"
+#include "ui/action/validate.h"
+
+/**
+ * Display signing session policy on the device and ask confirmation before enabling it
+ *
+ * @return 0 if success, negative integer otherwise.
+ *
+ */
+int ui_display_session_policy(void);
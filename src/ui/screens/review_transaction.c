@@ -20,12 +20,19 @@
 #include <string.h>   // memset
 
 #include "ui/screens/review_transaction.h"
+#include "transaction/session_policy.h"
+#include "transaction/template_diff.h"
+#include "transaction/summary.h"
+#include "transaction/field.h"
+#include "transaction/field_pager.h"
+#include "perf.h"
 
 static action_validate_cb g_validate_callback;
 static char g_bip32_path[60];
 static enum e_state g_current_state;
-static int8_t g_tx_field_position;
 static field_t g_tx_field_parsed;
+static char g_session_operation[MAX_HIVE_ACCOUNT_NAME_LEN + 20];
+static const char *g_review_subtitle;
 
 // This is a special function you must call for bn_paging to work properly in an edgecase.
 // It does some weird stuff with the `G_ux` global which is defined by the SDK.
@@ -110,7 +117,7 @@ UX_STEP_NOCB(ux_display_review_step,
              {
                  &C_icon_eye,
                  "Review",
-                 "Transaction",
+                 g_review_subtitle,
              });
 
 // FLOW to display transaction information:
@@ -128,22 +135,47 @@ UX_FLOW(ux_display_transaction_flow,
         &ux_display_tx_reject_step,
         FLOW_LOOP);
 
-// Transaction signing message step
-UX_STEP_NOCB(ux_display_signing_step,
-             pnn,
-             {
-                 &C_icon_processing,
-                 "Signing",
-                 "Transaction",
-             });
+// Step with single confirmation of transaction covered by the session policy
+UX_STEP_CB(ux_display_session_approve_step,
+           pnn,
+           (*g_validate_callback)(true),
+           {
+               &C_icon_validate_14,
+               "Approve",
+               g_session_operation,
+           });
 
-// FLOW to display transaction signing message:
-// #1 screen : eye processing + "Signing Transaction"
-UX_FLOW(ux_display_signing_tx_flow, &ux_display_signing_step);
+// FLOW to display transaction covered by the session policy:
+// #1 screen : approve button with operation name and signing account
+// #2 screen : reject button
+UX_FLOW(ux_display_session_transaction_flow, &ux_display_session_approve_step, &ux_display_tx_reject_step, FLOW_LOOP);
 
-void ui_display_signing_message() {
-    ux_flow_init(0, ux_display_signing_tx_flow, NULL);
-}
+static void display_transaction_details(void);
+
+// Step with button to review all transaction fields
+UX_STEP_CB(ux_display_show_details_step,
+           pb,
+           display_transaction_details(),
+           {
+               &C_icon_eye,
+               "Show details",
+           });
+
+// FLOW to display transaction summary:
+// #1 screen : eye icon + "Review Transaction"
+// #2 screen : signing key path
+// #3 screen : one sentence summary of the operation
+// #4 screen : show details button, displaying all fields
+// #5 screen : approve button
+// #6 screen : reject button
+UX_FLOW(ux_display_summary_flow,
+        &ux_display_review_step,
+        &ux_display_tx_path_step,
+        &ux_display_tx_field_step,
+        &ux_display_show_details_step,
+        &ux_display_tx_approve_step,
+        &ux_display_tx_reject_step,
+        FLOW_LOOP);
 
 int ui_display_transaction() {
     if (G_context.req_type != CONFIRM_TRANSACTION || G_context.state != STATE_PARSED) {
@@ -157,12 +189,50 @@ int ui_display_transaction() {
     }
 
     memset(&g_tx_field_parsed, 0, sizeof(field_t));
+    PERF_STATS_REVIEW();
 
-    g_tx_field_position = -1;
+    // Review only fields changed since the last approved operation of the same type, if there is one
+    bool is_diff = template_diff_compute();
+    g_review_subtitle = is_diff ? "Changes" : "Transaction";
     g_validate_callback = &ui_action_validate_transaction;
+
+    if (!is_diff && N_settings.summary_review_policy == SUMMARY_REVIEW_ENABLED &&
+        summary_format(g_tx_field_parsed.value, MEMBER_SIZE(field_t, value))) {
+        snprintf(g_tx_field_parsed.title, MEMBER_SIZE(field_t, title), "Summary");
+        ux_flow_init(0, ux_display_summary_flow, NULL);
+        return 0;
+    }
+
+    display_transaction_details();
+
+    return 0;
+}
+
+static void display_transaction_details(void) {
+    memset(&g_tx_field_parsed, 0, sizeof(field_t));
+
+    field_pager_reset();
     g_current_state = STATIC_SCREEN;
 
     ux_flow_init(0, ux_display_transaction_flow, NULL);
+}
+
+int ui_display_session_transaction() {
+    if (G_context.req_type != CONFIRM_TRANSACTION || G_context.state != STATE_PARSED) {
+        G_context.state = STATE_NONE;
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    snprintf(g_session_operation,
+             sizeof(g_session_operation),
+             "%s by %s",
+             G_session_policy.operation == OPERATION_VOTE ? "vote" : "custom_json",
+             G_session_policy.account);
+    PERF_STATS_REVIEW();
+
+    g_validate_callback = &ui_action_validate_session_transaction;
+
+    ux_flow_init(0, ux_display_session_transaction_flow, NULL);
 
     return 0;
 }
@@ -171,7 +241,7 @@ void display_next_state(bool is_upper_delimiter) {
     if (is_upper_delimiter) {
         if (g_current_state == STATIC_SCREEN) {
             // make sure we start from the first field
-            g_tx_field_position = -1;
+            field_pager_reset();
             bool more_data = parse_field(&g_tx_field_parsed, false, false);
             if (more_data) {
                 // We found some data to display so we now enter in dynamic mode.
@@ -225,56 +295,3 @@ void display_next_state(bool is_upper_delimiter) {
         }
     }
 }
-
-bool parse_field(field_t *field, bool reverse_order, bool start_from_last_operation) {
-    // Because encoded fields have various lenght and we want to be able to parse fields in reverse
-    // order, we need to iterate decoders from the very beginning up to the
-    // g_tx_field_position
-
-    // Edge case, when we want to start from the last operation
-    if (start_from_last_operation) {
-        g_tx_field_position = G_context.tx_info.parser->size;
-    }
-
-    if (reverse_order) {
-        if (g_tx_field_position >= 0) {
-            g_tx_field_position--;
-        } else {
-            return false;
-        }
-    } else {
-        if (g_tx_field_position < G_context.tx_info.parser->size - 1) {
-            g_tx_field_position++;
-        } else {
-            return false;
-        }
-    }
-
-    // Always start parsing the buffer from the beginning
-    G_context.tx_info.operation.offset = 0;
-
-    // Display field value
-    for (uint8_t i = 0; i < g_tx_field_position + 1; i++) {
-        /* Use PIC macro to access const functions (stored in .text area) */
-        decoder_t *decoder = (decoder_t *) PIC(G_context.tx_info.parser->decoders[i]);
-        // We dont need to validate the return code because at this point we're already sure the transaction parses correctly
-        (*decoder)(&G_context.tx_info.operation, field, false);
-    }
-
-    // Display field name
-    snprintf(field->title, MEMBER_SIZE(field_t, title), "%s", G_context.tx_info.parser->names[g_tx_field_position]);
-
-    if (reverse_order) {
-        if (g_tx_field_position == -1) {
-            // no more data
-            return false;
-        }
-    } else {
-        if (g_tx_field_position == G_context.tx_info.parser->size) {
-            // no more data
-            return false;
-        }
-    }
-
-    return true;
-}
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include "common/macros.h"
 #include "ui/action/validate.h"
 #include "transaction/transaction_parse.h"
+#include "transaction/field_pager.h"
 
 enum e_state {
     STATIC_SCREEN,
@@ -31,17 +32,12 @@ enum e_state {
 int ui_display_transaction(void);
 
 /**
- * Traverse DER encoded operation up to g_tx_field_position and copy it's value and title to specified field.
+ * Display single confirmation screen for transaction covered by the session policy
+ *
+ * @return 0 if success, negative integer otherwise.
  *
- * @param[out] field
- *  Output field that will be used to display information (title of the operation field and its value) on the screen
- * @param[in] reverse_order
- *  Traverse the operation in reverse order to handle FLOW_LOOP
- * @param start_from_last_operation
- *  Handle edge case when we want to display the last operation when entering from the first screen, moving left
- * @return true if success, false otherwise
  */
-bool parse_field(field_t *field, bool reverse_order, bool start_from_last_operation);
+int ui_display_session_transaction(void);
 
 /**
  * Parse operation and determine if there is more data to show, to handle dynamic flow of screens
@@ -50,9 +46,3 @@ bool parse_field(field_t *field, bool reverse_order, bool start_from_last_operat
  *  Determine if we're entering upper or lower delimiter in dynamic flow
  */
 void display_next_state(bool is_upper_delimiter);
-
-/**
- * Initialize "Signing transaction" display when TX got accepted
- *
- */
-void ui_display_signing_message(void);
\ No newline at end of file
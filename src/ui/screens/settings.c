@@ -23,18 +23,36 @@
 #include "menu.h"
 #include "settings.h"
 
-static char sign_hash_policy_prompt[9];  // max size of longest settings name which is "Disabled"
+static char sign_hash_policy_prompt[9];        // max size of longest settings name which is "Disabled"
+static char session_signing_policy_prompt[9];  // max size of longest settings name which is "Disabled"
+static char summary_review_policy_prompt[9];   // max size of longest settings name which is "Disabled"
 
 UX_STEP_CB(ux_settings_hash_sign_step, bn_paging, switch_settings_hash_signing(), {.title = "Hash signing", .text = sign_hash_policy_prompt});
+UX_STEP_CB(ux_settings_session_sign_step,
+           bn_paging,
+           switch_settings_session_signing(),
+           {.title = "Session signing", .text = session_signing_policy_prompt});
+UX_STEP_CB(ux_settings_summary_review_step,
+           bn_paging,
+           switch_settings_summary_review(),
+           {.title = "Summary review", .text = summary_review_policy_prompt});
 UX_STEP_VALID(ux_settings_back_step, pb, ui_menu_main(NULL), {&C_icon_back, "Back"});  // TODO make it back to ux_menu_settings_step
 
 // FLOW for the settings submenu:
 // #1 screen: blind signing
-// #3 screen: back button to main menu
-UX_FLOW(ux_settings_flow, &ux_settings_hash_sign_step, &ux_settings_back_step, FLOW_LOOP);
+// #2 screen: session signing
+// #3 screen: summary review
+// #4 screen: back button to main menu
+UX_FLOW(ux_settings_flow, &ux_settings_hash_sign_step, &ux_settings_session_sign_step, &ux_settings_summary_review_step, &ux_settings_back_step, FLOW_LOOP);
 
 void ui_display_settings(const ux_flow_step_t* const start_step) {
     strlcpy(sign_hash_policy_prompt, N_settings.sign_hash_policy == ENABLED ? "Enabled" : "Disabled", sizeof(sign_hash_policy_prompt));
+    strlcpy(session_signing_policy_prompt,
+            N_settings.session_signing_policy == SESSION_SIGNING_ENABLED ? "Enabled" : "Disabled",
+            sizeof(session_signing_policy_prompt));
+    strlcpy(summary_review_policy_prompt,
+            N_settings.summary_review_policy == SUMMARY_REVIEW_ENABLED ? "Enabled" : "Disabled",
+            sizeof(summary_review_policy_prompt));
     ux_flow_init(0, ux_settings_flow, start_step);
 }
 
@@ -44,6 +62,24 @@ void switch_settings_hash_signing(void) {
     ui_display_settings(&ux_settings_hash_sign_step);
 }
 
+void switch_settings_session_signing(void) {
+    session_signing_policy_t value = N_settings.session_signing_policy == SESSION_SIGNING_ENABLED ? SESSION_SIGNING_DISABLED : SESSION_SIGNING_ENABLED;
+    nvm_write((void*) &N_settings.session_signing_policy, (void*) &value, MEMBER_SIZE(settings_t, session_signing_policy));
+
+    // disabling the setting revokes the policy approved in the current session
+    if (value == SESSION_SIGNING_DISABLED) {
+        explicit_bzero(&G_session_policy, sizeof(G_session_policy));
+    }
+
+    ui_display_settings(&ux_settings_session_sign_step);
+}
+
+void switch_settings_summary_review(void) {
+    summary_review_policy_t value = N_settings.summary_review_policy == SUMMARY_REVIEW_ENABLED ? SUMMARY_REVIEW_DISABLED : SUMMARY_REVIEW_ENABLED;
+    nvm_write((void*) &N_settings.summary_review_policy, (void*) &value, MEMBER_SIZE(settings_t, summary_review_policy));
+    ui_display_settings(&ux_settings_summary_review_step);
+}
+
 // clang-format off
 #if defined(TARGET_NANOS)
 UX_STEP_CB(
@@ -72,3 +108,32 @@ UX_FLOW(ux_warning_hash_signing_disabled_flow, &ux_warning_hash_signing_step);
 void ui_display_hash_signing_disabled_warning(void) {
     ux_flow_init(0, ux_warning_hash_signing_disabled_flow, NULL);
 }
+
+// clang-format off
+#if defined(TARGET_NANOS)
+UX_STEP_CB(
+    ux_warning_session_signing_step,
+    bnnn_paging,
+    ui_menu_main(NULL),
+    {
+      "Error",
+      "Session signing must be enabled in Settings",
+    });
+#elif defined(TARGET_NANOX) || defined(TARGET_NANOS2)
+UX_STEP_CB(
+    ux_warning_session_signing_step,
+    pnn,
+    ui_menu_main(NULL),
+    {
+      &C_icon_crossmark,
+      "Session signing must be",
+      "enabled in Settings",
+    });
+#endif
+// clang-format on
+
+UX_FLOW(ux_warning_session_signing_disabled_flow, &ux_warning_session_signing_step);
+
+void ui_display_session_signing_disabled_warning(void) {
+    ux_flow_init(0, ux_warning_session_signing_disabled_flow, NULL);
+}
@@ -8,4 +8,7 @@
 
 void ui_display_settings(const ux_flow_step_t* const start_step);
 void switch_settings_hash_signing(void);
+void switch_settings_session_signing(void);
+void switch_settings_summary_review(void);
 void ui_display_hash_signing_disabled_warning(void);
+void ui_display_session_signing_disabled_warning(void);
@@ -0,0 +1,45 @@
+/*****************************************************************************
+ *   Ledger App Hive.
+ *   (c) 2022 Bartłomiej (@engrave) Górnicki
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdio.h>
+
+#include "ui/screens/signing_progress.h"
+
+static char g_progress[20];
+
+// Signing step
+UX_STEP_NOCB(ux_display_signing_progress_step,
+             pnn,
+             {
+                 &C_icon_processing,
+                 "Signing",
+                 g_progress,
+             });
+
+// FLOW to display signing progress:
+// #1 screen : eye processing + "Signing Transaction", "Signing attempt N" after a rejected nonce candidate
+UX_FLOW(ux_display_signing_progress_flow, &ux_display_signing_progress_step);
+
+void ui_display_signing_progress(const char *subject) {
+    snprintf(g_progress, sizeof(g_progress), "%s", subject);
+    ux_flow_init(0, ux_display_signing_progress_flow, NULL);
+}
+
+void ui_update_signing_progress(uint32_t attempts) {
+    snprintf(g_progress, sizeof(g_progress), "attempt %u", (unsigned int) (attempts + 1));
+    UX_REDISPLAY();
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "os.h"
+#include "ux.h"
+#include "glyphs.h"
+
+/**
+ * Display "Signing" screen with the subject being signed, shown until the signature is made
+ *
+ * @param[in] subject
+ *   Second line of the screen, i.e. "Transaction".
+ *
+ */
+void ui_display_signing_progress(const char *subject);
+
+/**
+ * Replace subject of the "Signing" screen with the number of the nonce candidate being tried, without initializing
+ * the flow again
+ *
+ * @param[in] attempts
+ *   Number of candidates rejected so far.
+ *
+ */
+void ui_update_signing_progress(uint32_t attempts);
@@ -0,0 +1,228 @@
+import Axios from 'axios';
+import { promises as fsPromises } from 'fs';
+import * as net from 'net';
+import * as path from 'path';
+import { performance } from 'perf_hooks';
+import { parseTrace, TraceEvent } from './utils/trace';
+
+/**
+ * Replay recorded APDU traces against Speculos or the native build (`hive_native --port`), both speak the Speculos
+ * APDU protocol. Latency percentiles are reported per instruction and compared with a baseline report.
+ *
+ *   npx ts-node replay.ts [--apdu-port 40000] [--buttons http://127.0.0.1:5000] [--iterations 5]
+ *                         [--report report.json] [--baseline baseline.json] [--threshold 10] [--allow-mismatch] trace...
+ */
+
+const INSTRUCTIONS: { [ins: number]: string } = {
+    0x02: 'GET_PUBLIC_KEY',
+    0x04: 'SIGN_TRANSACTION',
+    0x06: 'GET_VERSION',
+    0x08: 'GET_APP_NAME',
+    0x10: 'SIGN_HASH',
+    0x12: 'GET_SETTINGS',
+    0x14: 'SET_SESSION_POLICY',
+    0x16: 'SIGN_MESSAGE',
+    0x18: 'GET_ECDH_SECRETS',
+    0x1A: 'DECRYPT_MEMO',
+    0x1C: 'GET_PERF_STATS',
+    0x1E: 'GET_LAST_SIGNATURE',
+    0x20: 'PREVIEW_TRANSACTION',
+    0x22: 'CREATE_ACCOUNT',
+    0x24: 'SET_KEY_INDEX',
+    0xC0: 'GET_RESPONSE',
+};
+
+const PERCENTILES = [50, 90, 99];
+
+type Options = {
+    apduPort: number,
+    buttons?: string,
+    iterations: number,
+    report?: string,
+    baseline?: string,
+    threshold: number,
+    allowMismatch: boolean,
+    traces: string[]
+};
+
+type Statistics = { count: number, max: number, [percentile: string]: number };
+type Report = { [command: string]: Statistics };
+
+const parseOptions = (args: string[]): Options => {
+    const options: Options = { apduPort: 40000, iterations: 5, threshold: 10, allowMismatch: false, traces: [] };
+    for (let i = 0; i < args.length; i++) {
+        switch (args[i]) {
+            case '--apdu-port': options.apduPort = parseInt(args[++i], 10); break;
+            case '--buttons': options.buttons = args[++i]; break;
+            case '--iterations': options.iterations = parseInt(args[++i], 10); break;
+            case '--report': options.report = args[++i]; break;
+            case '--baseline': options.baseline = args[++i]; break;
+            case '--threshold': options.threshold = parseFloat(args[++i]); break;
+            case '--allow-mismatch': options.allowMismatch = true; break;
+            default: options.traces.push(args[i]);
+        }
+    }
+    if (options.traces.length === 0 || !(options.iterations > 0)) {
+        throw new Error('Usage: replay.ts [options] trace...');
+    }
+    return options;
+}
+
+/**
+ * Minimal client of the Speculos APDU protocol: length prefixed command, length prefixed response followed by status word
+ */
+class ApduSocket {
+    private socket: net.Socket;
+    private received = Buffer.alloc(0);
+    private waiting?: () => void;
+
+    private constructor(socket: net.Socket) {
+        this.socket = socket;
+        this.socket.on('data', data => {
+            this.received = Buffer.concat([this.received, data]);
+            this.waiting?.();
+        });
+    }
+
+    static open(port: number): Promise<ApduSocket> {
+        return new Promise((resolve, reject) => {
+            const socket = net.connect(port, '127.0.0.1', () => resolve(new ApduSocket(socket)));
+            socket.setNoDelay(true);
+            socket.once('error', reject);
+        });
+    }
+
+    async exchange(apdu: Buffer): Promise<Buffer> {
+        const header = Buffer.alloc(4);
+        header.writeUInt32BE(apdu.length);
+        this.socket.write(Buffer.concat([header, apdu]));
+
+        while (this.received.length < 4 || this.received.length < 4 + this.received.readUInt32BE(0) + 2) {
+            await new Promise<void>(resolve => this.waiting = resolve);
+        }
+        const length = 4 + this.received.readUInt32BE(0) + 2;
+        const response = this.received.slice(4, length);
+        this.received = this.received.slice(length);
+        return response;
+    }
+
+    close() {
+        this.socket.end();
+    }
+}
+
+const commandName = (apdu: Buffer): string => INSTRUCTIONS[apdu[1]] ?? `INS_${('0' + apdu[1].toString(16)).slice(-2)}`;
+
+/**
+ * Replay single trace, pending command is awaited when its response is reached so recorded button presses happen
+ * while the device waits for user confirmation
+ */
+const replay = async (socket: ApduSocket, name: string, events: TraceEvent[], options: Options, samples: Map<string, number[]>): Promise<number> => {
+    let pending: { command: string, start: number, response: Promise<Buffer>, interactive: boolean } | undefined;
+    let mismatches = 0;
+
+    for (const event of events) {
+        if (event.type === 'command') {
+            pending = { command: commandName(event.apdu), start: performance.now(), response: socket.exchange(event.apdu), interactive: false };
+        } else if (event.type === 'button') {
+            if (options.buttons) {
+                // confirmation time is dominated by the UI, such exchanges are reported separately
+                if (pending) {
+                    pending.interactive = true;
+                }
+                await Axios.post(`${options.buttons}/button/${event.button}`, { "action": "press-and-release" });
+            }
+        } else if (event.type === 'response' && pending) {
+            const response = await pending.response;
+            const elapsed = performance.now() - pending.start;
+
+            if (!response.equals(event.response)) {
+                mismatches++;
+                console.error(`${name}: ${pending.command} returned ${response.toString('hex')}, expected ${event.response.toString('hex')}`);
+            }
+
+            const command = pending.interactive ? `${pending.command} (with UI)` : pending.command;
+            samples.set(command, [...(samples.get(command) ?? []), elapsed]);
+            pending = undefined;
+        }
+    }
+
+    return mismatches;
+}
+
+const percentile = (sorted: number[], p: number): number => sorted[Math.min(sorted.length - 1, Math.ceil(p / 100 * sorted.length) - 1)];
+
+const statistics = (samples: Map<string, number[]>): Report => {
+    const report: Report = {};
+    for (const [command, values] of [...samples.entries()].sort((a, b) => a[0].localeCompare(b[0]))) {
+        const sorted = [...values].sort((a, b) => a - b);
+        report[command] = { count: sorted.length, max: sorted[sorted.length - 1] };
+        PERCENTILES.forEach(p => report[command][`p${p}`] = percentile(sorted, p));
+    }
+    return report;
+}
+
+/**
+ * Compare median and p90 latencies with the baseline, tail percentiles are too noisy to gate on
+ */
+const regressions = (report: Report, baseline: Report, threshold: number): string[] => {
+    const failures: string[] = [];
+    for (const command of Object.keys(report)) {
+        const stats = report[command];
+        for (const key of ['p50', 'p90']) {
+            const reference = baseline[command]?.[key];
+            if (reference !== undefined && stats[key] > reference * (1 + threshold / 100)) {
+                failures.push(`${command} ${key} ${stats[key].toFixed(3)} ms exceeds baseline ${reference.toFixed(3)} ms by more than ${threshold}%`);
+            }
+        }
+    }
+    return failures;
+}
+
+const main = async () => {
+    const options = parseOptions(process.argv.slice(2));
+    const samples = new Map<string, number[]>();
+    let mismatches = 0;
+
+    const traces = await Promise.all(options.traces.map(async trace => ({
+        name: path.basename(trace), events: parseTrace(await fsPromises.readFile(trace, 'utf8'))
+    })));
+
+    const socket = await ApduSocket.open(options.apduPort);
+    try {
+        for (let i = 0; i < options.iterations; i++) {
+            for (const trace of traces) {
+                mismatches += await replay(socket, trace.name, trace.events, options, samples);
+            }
+        }
+    } finally {
+        socket.close();
+    }
+
+    const report = statistics(samples);
+    const table: { [command: string]: { [key: string]: number } } = {};
+    for (const command of Object.keys(report)) {
+        table[command] = {};
+        for (const key of Object.keys(report[command])) {
+            table[command][key] = Math.round(report[command][key] * 1000) / 1000;
+        }
+    }
+    console.table(table);
+
+    if (options.report) {
+        await fsPromises.writeFile(options.report, JSON.stringify(report, null, 2) + '\n');
+    }
+
+    const failures = options.baseline ? regressions(report, JSON.parse(await fsPromises.readFile(options.baseline, 'utf8')), options.threshold) : [];
+    failures.forEach(failure => console.error(failure));
+
+    if (failures.length > 0 || (mismatches > 0 && !options.allowMismatch)) {
+        console.error(`${failures.length} latency regression(s), ${mismatches} mismatching response(s)`);
+        process.exit(1);
+    }
+}
+
+main().catch(error => {
+    console.error(error.message ?? error);
+    process.exit(1);
+});
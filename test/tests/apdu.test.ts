@@ -7,7 +7,7 @@ describe('APDU', async () => {
     it('should reject unsupported instruction', async () => {
         const transport = await Transport.open({ apduPort: 40000 });
         try {
-            await transport.send(0xD4, 0x16, 0x00, 0x00);
+            await transport.send(0xD4, 0xF0, 0x00, 0x00);
         } catch (error: any) {
             assert.equal(error.statusCode, 0x6D00); //SW_INS_NOT_SUPPORTED
         }
@@ -0,0 +1,67 @@
+import Transport from '@ledgerhq/hw-transport-node-speculos';
+import { expect } from 'chai';
+import * as speculosButtons from '../utils/speculosButtons';
+import { CLA, serializePath } from '../utils/apdu';
+
+const CREATE_ACCOUNT = 0x22;
+const CREATE_CLAIMED_ACCOUNT = 23;
+
+const CHAIN_ID = 'beeab0de00000000000000000000000000000000000000000000000000000000';
+// ref_block_num, ref_block_prefix and expiration of test/transactions/create_claimed_account.json
+const HEADER = '1942ef2cd86d207f3560';
+
+const serializeName = (name: string): Buffer => Buffer.concat([Buffer.from([name.length]), Buffer.from(name, 'ascii')]);
+
+const serializeRequest = (path: string, creator: string, newAccountName: string, accountIndex: number): Buffer => {
+    const index = Buffer.alloc(4);
+    index.writeUInt32BE(accountIndex, 0);
+
+    return Buffer.concat([
+        serializePath(path),
+        Buffer.from(CHAIN_ID + HEADER, 'hex'),
+        Buffer.from([CREATE_CLAIMED_ACCOUNT]),
+        serializeName(creator),
+        serializeName(newAccountName),
+        index
+    ]);
+};
+
+describe('Create account', async () => {
+
+    it('should sign create_claimed_account with keys derived on the device', async () => {
+        const transport = await Transport.open({ apduPort: 40000, buttonPort: 5000, automationPort: 5000 });
+        try {
+            const responsePromise = transport.send(CLA, CREATE_ACCOUNT, 0x00, 0x00, serializeRequest(`48'/13'/0'/0'/0'`, 'engrave', 'bob-01', 0));
+
+            // accept account creation
+            await speculosButtons.pressLeft();
+            await speculosButtons.pressLeft();
+            await speculosButtons.pressBoth();
+
+            const response = await responsePromise;
+            expect(response.slice(0, 65).toString('hex')).to.be.equal('20482953dd06af7d476a4bc95c6932d307c0c254eca48c7e5933fd0cb744afba30753918e422127cf511f4033758271be3d54ae3a8cb8523e070000b6d4f836ad9');
+
+            // owner, active, posting and memo keys of account 0
+            expect(response.slice(65, response.length - 2).toString('hex')).to.be.equal(
+                '0272da616d74acf1d1482c2efd4fdfe349ba353b449ab767d966d00599747a119d' +
+                '02e75770850a1ce160d1e1e4293bcc79d0711f0caa79e067d3430804289406075d' +
+                '02d6be011a0f4d43ab5ec1096fa803dcd134d2e7282525c555c840061ae4462302' +
+                '029fda9dc49f0f6a521194f2a6414bef6a4ef143455bbff7108bde50bc2847af36'
+            );
+        } finally {
+            await transport.close();
+        }
+    }).timeout(10000)
+
+    it('should reject invalid account name', async () => {
+        const transport = await Transport.open({ apduPort: 40000 });
+        try {
+            await transport.send(CLA, CREATE_ACCOUNT, 0x00, 0x00, serializeRequest(`48'/13'/0'/0'/0'`, 'engrave', 'Bob', 0));
+            expect.fail('should not reach this point');
+        } catch (error: any) {
+            expect(error.statusCode).to.be.equal(0xB010); // SW_ACCOUNT_PARSING_FAIL
+        } finally {
+            await transport.close();
+        }
+    })
+})
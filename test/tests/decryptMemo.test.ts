@@ -0,0 +1,87 @@
+import Transport from '@ledgerhq/hw-transport-node-speculos';
+import { expect } from 'chai';
+import { createCipheriv, createECDH, createHash } from 'crypto';
+import * as speculosButtons from '../utils/speculosButtons';
+import { CLA, serializePath } from '../utils/apdu';
+
+const DECRYPT_MEMO = 0x1A;
+
+// memo key at 48'/13'/3'/0'/0'
+const MEMO_PUBLIC_KEY = Buffer.from('029fda9dc49f0f6a521194f2a6414bef6a4ef143455bbff7108bde50bc2847af36', 'hex');
+const SENDER_PRIVATE_KEY = Buffer.from('4b7c4d2e5c1a0f3b9e8d7c6b5a4f3e2d1c0b0a09080706050403020100ffeedd', 'hex');
+
+const varint = (value: number): Buffer => {
+    const bytes = [];
+    do {
+        bytes.push((value & 0x7f) | (value > 0x7f ? 0x80 : 0));
+        value >>>= 7;
+    } while (value > 0);
+    return Buffer.from(bytes);
+}
+
+/**
+ * Encrypt memo the way Hive libraries do, serialized memo without base58 encoding and '#' prefix is returned
+ */
+const encryptMemo = (text: string): Buffer => {
+    const sender = createECDH('secp256k1');
+    sender.setPrivateKey(SENDER_PRIVATE_KEY);
+
+    const nonce = Buffer.from('0102030405060708', 'hex');
+    const sharedSecret = createHash('sha512').update(sender.computeSecret(MEMO_PUBLIC_KEY)).digest();
+    const encryptionKey = createHash('sha512').update(Buffer.concat([nonce, sharedSecret])).digest();
+    const check = createHash('sha256').update(encryptionKey).digest().slice(0, 4);
+
+    const plain = Buffer.concat([varint(Buffer.byteLength(text)), Buffer.from(text)]);
+    const cipher = createCipheriv('aes-256-cbc', encryptionKey.slice(0, 32), encryptionKey.slice(32, 48));
+    const encrypted = Buffer.concat([cipher.update(plain), cipher.final()]);
+
+    return Buffer.concat([Buffer.from(sender.getPublicKey(undefined, 'compressed')), MEMO_PUBLIC_KEY, nonce, check, varint(encrypted.length), encrypted]);
+}
+
+describe('Decrypt memo', async () => {
+
+    it('should decrypt and display memo', async () => {
+        const transport = await Transport.open({ apduPort: 40000, buttonPort: 5000, automationPort: 5000 });
+        try {
+            const memo = Buffer.concat([serializePath(`48'/13'/3'/0'/0'`), encryptMemo('Thank you for the coffee!')]);
+            const decryptionPromise = transport.send(CLA, DECRYPT_MEMO, 0x00, 0x00, memo);
+
+            // close memo
+            await speculosButtons.pressLeft();
+            await speculosButtons.pressLeft();
+            await speculosButtons.pressBoth();
+
+            const response = await decryptionPromise;
+            // memo is displayed only, nothing but status word is returned
+            expect(response.toString('hex')).to.be.equal('9000');
+        } finally {
+            await transport.close();
+        }
+    }).timeout(10000)
+
+    it('should reject memo with wrong checksum', async () => {
+        const transport = await Transport.open({ apduPort: 40000 });
+        try {
+            const encrypted = encryptMemo('Thank you for the coffee!');
+            encrypted[33 + 33 + 8] ^= 0xff;
+            await transport.send(CLA, DECRYPT_MEMO, 0x00, 0x00, Buffer.concat([serializePath(`48'/13'/3'/0'/0'`), encrypted]));
+            expect.fail('should not reach this point');
+        } catch (error: any) {
+            expect(error.statusCode).to.be.equal(0xB00E); // SW_MEMO_DECRYPTION_FAIL
+        } finally {
+            await transport.close();
+        }
+    })
+
+    it('should reject key which is not a memo key', async () => {
+        const transport = await Transport.open({ apduPort: 40000 });
+        try {
+            await transport.send(CLA, DECRYPT_MEMO, 0x00, 0x00, Buffer.concat([serializePath(`48'/13'/0'/0'/0'`), encryptMemo('Hi')]));
+            expect.fail('should not reach this point');
+        } catch (error: any) {
+            expect(error.statusCode).to.be.equal(0xB00D); // SW_MEMO_PARSING_FAIL
+        } finally {
+            await transport.close();
+        }
+    })
+})
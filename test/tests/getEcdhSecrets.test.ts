@@ -0,0 +1,69 @@
+import Transport from '@ledgerhq/hw-transport-node-speculos';
+import { expect } from 'chai';
+import * as speculosButtons from '../utils/speculosButtons';
+import { CLA, serializePath } from '../utils/apdu';
+
+const GET_ECDH_SECRETS = 0x18;
+
+const COUNTERPARTIES = [
+    {
+        publicKey: '03889adcc875aa21c7c77b1c857e156009df4c14ddb0153f145c983647025aa03b',
+        secret: '7e35ffb92ce6917024baccb56e19269f342520d4750c34dc78aa2d546b59efeae05ecac0c41ace3379eb7668edf0c36f28df6db39271571e5c1af5ea49261dbf'
+    },
+    {
+        publicKey: '0272da616d74acf1d1482c2efd4fdfe349ba353b449ab767d966d00599747a119d',
+        secret: 'b531f05e252adddf66e43af084723f70bc2fe27d791eb1c52adc3d831b6e5388825f8a43f95f29bd8f9eafe6f29bf3dabc0204c0b6e3cd4cfdc4c41817f20828'
+    },
+];
+
+const serializeRequest = (path: string, publicKeys: string[]): Buffer => Buffer.concat([
+    serializePath(path),
+    Buffer.from([publicKeys.length]),
+    ...publicKeys.map(publicKey => Buffer.from(publicKey, 'hex'))
+]);
+
+describe('Get ECDH secrets', async () => {
+
+    it('should return shared secrets for the whole batch with single approval', async () => {
+        const transport = await Transport.open({ apduPort: 40000, buttonPort: 5000, automationPort: 5000 });
+        try {
+            const request = serializeRequest(`48'/13'/3'/0'/0'`, COUNTERPARTIES.map(counterparty => counterparty.publicKey));
+            const secretsPromise = transport.send(CLA, GET_ECDH_SECRETS, 0x00, 0x00, request);
+
+            // accept batch
+            await speculosButtons.pressLeft();
+            await speculosButtons.pressLeft();
+            await speculosButtons.pressBoth();
+
+            const response = await secretsPromise;
+            expect(response.slice(0, response.length - 2).toString('hex')).to.be.equal(COUNTERPARTIES.map(counterparty => counterparty.secret).join(''));
+        } finally {
+            await transport.close();
+        }
+    }).timeout(10000)
+
+    it('should reject key which is not a memo key', async () => {
+        const transport = await Transport.open({ apduPort: 40000 });
+        try {
+            await transport.send(CLA, GET_ECDH_SECRETS, 0x00, 0x00, serializeRequest(`48'/13'/0'/0'/0'`, [COUNTERPARTIES[0].publicKey]));
+            expect.fail('should not reach this point');
+        } catch (error: any) {
+            expect(error.statusCode).to.be.equal(0xB00C); // SW_ECDH_PARSING_FAIL
+        } finally {
+            await transport.close();
+        }
+    })
+
+    it('should reject too many public keys', async () => {
+        const transport = await Transport.open({ apduPort: 40000 });
+        try {
+            const publicKeys = Array(5).fill(COUNTERPARTIES[0].publicKey);
+            await transport.send(CLA, GET_ECDH_SECRETS, 0x00, 0x00, serializeRequest(`48'/13'/3'/0'/0'`, publicKeys));
+            expect.fail('should not reach this point');
+        } catch (error: any) {
+            expect(error.statusCode).to.be.equal(0xB00C); // SW_ECDH_PARSING_FAIL
+        } finally {
+            await transport.close();
+        }
+    })
+})
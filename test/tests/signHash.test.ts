@@ -44,7 +44,7 @@ describe('Sign hash', async () => {
                 await speculosButtons.pressRight();
                 await speculosButtons.pressBoth();
                 await speculosButtons.pressBoth();
-                await speculosButtons.pressRight();
+                await speculosButtons.pressLeft(); // settings flow loops, back button is the last step
                 await speculosButtons.pressBoth();
 
                 const signingHashPromise = hive.signHash(input.hash, `48'/13'/0'/0'/0'`);
@@ -62,7 +62,7 @@ describe('Sign hash', async () => {
                 await speculosButtons.pressRight();
                 await speculosButtons.pressBoth();
                 await speculosButtons.pressBoth();
-                await speculosButtons.pressRight();
+                await speculosButtons.pressLeft(); // settings flow loops, back button is the last step
                 await speculosButtons.pressBoth();
 
             } finally {
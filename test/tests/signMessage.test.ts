@@ -0,0 +1,48 @@
+import Transport from '@ledgerhq/hw-transport-node-speculos';
+import { expect } from 'chai';
+import * as speculosButtons from '../utils/speculosButtons';
+import { serializePath, sendChunks } from '../utils/apdu';
+
+const SIGN_MESSAGE = 0x16;
+
+const prepareExpectedSignature = (name: string, message: Buffer, expectedSignature: string) => ({
+    name, message, expectedSignature
+})
+
+describe('Sign message', async () => {
+
+    [
+        prepareExpectedSignature('text message', Buffer.from('Hive login challenge: 8f2b7c1e', 'ascii'), '2022937ded195e1a359f919c1c4fab3662598b667b924289c6513145576d008b293800449a804e7bdf6d85c0a721ac4b2c19d50a54ebffd7ed24afe3e3ac772b90'),
+        prepareExpectedSignature('binary message longer than transaction buffer', Buffer.from([...Array(1000).keys()].map(i => (i * 7 + 13) % 256)), '1f72fbdbefea7aa5794e6fd765f677b64dfec94bf44d6740474317c90fa4ed22f84cd58fc78decfe22a51ab09edf5313dbfcdbb384fb411cbbcdcd0e0e899d92ac'),
+    ].forEach(input => {
+        it(`should properly sign ${input.name}`, async function () {
+            const transport = await Transport.open({ apduPort: 40000, buttonPort: 5000, automationPort: 5000 });
+            try {
+                const signingMessagePromise = sendChunks(transport, SIGN_MESSAGE, Buffer.concat([serializePath(`48'/13'/0'/0'/0'`), input.message]));
+
+                // accept message
+                await speculosButtons.pressLeft();
+                await speculosButtons.pressLeft();
+                await speculosButtons.pressBoth();
+
+                const signature = await signingMessagePromise;
+                expect(signature.toString('hex')).to.be.equal(input.expectedSignature);
+            } finally {
+                await transport.close();
+            }
+        }).timeout(10000)
+    })
+
+    it('should reject message starting with chain id', async () => {
+        const transport = await Transport.open({ apduPort: 40000 });
+        try {
+            const chainId = Buffer.from('beeab0de00000000000000000000000000000000000000000000000000000000', 'hex');
+            await sendChunks(transport, SIGN_MESSAGE, Buffer.concat([serializePath(`48'/13'/0'/0'/0'`), chainId, Buffer.from('transaction')]));
+            expect.fail('should not reach this point');
+        } catch (error: any) {
+            expect(error.statusCode).to.be.equal(0xB00B); // SW_MESSAGE_PARSING_FAIL
+        } finally {
+            await transport.close();
+        }
+    })
+})
@@ -3,6 +3,7 @@ import Hive from '@engrave/ledger-app-hive';
 import { expect } from 'chai';
 import { promises as fsPromises } from 'fs';
 import * as speculosButtons from '../utils/speculosButtons';
+import { recordStackUsage } from '../utils/stackUsage';
 
 const prepareExpectedSignature = (operation: string, expectedSignature: string) => ({
     operation, expectedSignature
@@ -30,7 +31,7 @@ describe('Sign transaction', async () => {
         prepareExpectedSignature('comment_options', '205a5850d6dace3b168893bbcdc9e5ce8ec12f37deeaca366fa3dadb1a085303775a802c257bf4cbe6dd51ef5b7638b926e63a68e2c2cfc81f3b88844709b5c7a6'),
         prepareExpectedSignature('set_withdraw_vesting_route', '1f5519b506188a995c6f8a10e0bc1c299b55e99b189d32f3b2c025db895e62031e609a503296a791a436ee058aa5611469fa6811760003342d41fe2740c8a521df'),
         prepareExpectedSignature('claim_account', '207436a6c83c1ec81cc6e4babdc123b8ea98b6072b522455643eb359a6eb7ea697068e2364678d23b539d7f7f815bf10983254d0c274c9e2c611b5632f2a6b9cdb'),
-        prepareExpectedSignature('create_claimed_account', '206f4b365ede329992a926024f4ee94e6ceae97abf79243cb6424406b3af455b4617ffcce56d56c44cad2fa6f9b54f75f49f8b9213e0083f02810477eeacaa30c5'),
+        prepareExpectedSignature('create_claimed_account', '2003379f04a193d572293d974ea9bd10c268aa09c79225761d2625f8672f02b08e65aaa2665787ddee4d958cb152b3b8650dbbdf56a405ad442486a5eb01c1d37b'),
         prepareExpectedSignature('request_account_recovery', '1f146c40780bae972cda6b6d68dcb868361ec420666295ca7c6650eb006d993fb91292f3649e6f5499aac22f21cbdd941ec77c39d86da4892080a81995cdab4b5a'),
         prepareExpectedSignature('recover_account', '206d43fec3f16b23bf269744512e1c6a5e81043d6a44ab7d277449cd972a7f7e6b0d40ef62e234da2a31b63e903d49e91b5438c1ae188f55bdbc2b3fb3fd834bfb'),
         prepareExpectedSignature('change_recovery_account', '1f1d7152c4ce34898025ac1ff7b91a1c9a3a6b272c2ef85da2c307b441a30d02ea1e76a3b2566710f6d3ca9eab12a2c95d8cbac81137c56433bdb9119d93343f2f'),
@@ -64,6 +65,8 @@ describe('Sign transaction', async () => {
                 const { signatures } = await signingTransactionPromise;
                 expect(signatures).to.be.instanceOf(Array).and.have.length(1);
                 expect(signatures[0]).to.be.equal(input.expectedSignature);
+
+                await recordStackUsage(transport, input.operation);
             } finally {
                 await transport.close();
             }
@@ -0,0 +1,41 @@
+import Transport from '@ledgerhq/hw-transport-node-speculos';
+
+const CLA = 0xD4;
+const P1_FIRST_CHUNK = 0x00;
+const P1_SUBSEQUENT_CHUNK = 0x80;
+const P2_LAST = 0x00;
+const P2_MORE = 0x80;
+const MAX_CHUNK_LEN = 250; // whole APDU including 5 bytes header must fit MAX_APDU_LEN
+
+/**
+ * Serialize BIP32 path as length followed by big endian path elements
+ */
+const serializePath = (path: string): Buffer => {
+    const elements = path.split('/').map(element => {
+        const hardened = element.endsWith(`'`);
+        const index = parseInt(hardened ? element.slice(0, -1) : element, 10);
+        return (hardened ? (index | 0x80000000) : index) >>> 0;
+    });
+
+    const buffer = Buffer.alloc(1 + 4 * elements.length);
+    buffer.writeUInt8(elements.length, 0);
+    elements.forEach((element, i) => buffer.writeUInt32BE(element, 1 + 4 * i));
+    return buffer;
+}
+
+/**
+ * Send data split into chunks, the last response without status word is returned
+ */
+const sendChunks = async (transport: Transport, ins: number, data: Buffer): Promise<Buffer> => {
+    let response = Buffer.alloc(0);
+    for (let offset = 0; offset < data.length || offset === 0; offset += MAX_CHUNK_LEN) {
+        const chunk = data.slice(offset, offset + MAX_CHUNK_LEN);
+        const isLast = offset + MAX_CHUNK_LEN >= data.length;
+        response = await transport.send(CLA, ins, offset === 0 ? P1_FIRST_CHUNK : P1_SUBSEQUENT_CHUNK, isLast ? P2_LAST : P2_MORE, chunk);
+    }
+    return response.slice(0, response.length - 2);
+}
+
+export {
+    CLA, serializePath, sendChunks
+};
@@ -1,10 +1,15 @@
-
 import Axios from 'axios';
+import { recordButton } from './trace';
+
+const press = async (button: string) => {
+    recordButton(button);
+    return Axios.post(`http://127.0.0.1:5000/button/${button}`, { "action": "press-and-release" });
+}
 
-const pressLeft = async () => Axios.post('http://127.0.0.1:5000/button/left', { "action": "press-and-release" });
-const pressRight = async () => Axios.post('http://127.0.0.1:5000/button/right', { "action": "press-and-release" });
-const pressBoth = async () => Axios.post('http://127.0.0.1:5000/button/both', { "action": "press-and-release" });
+const pressLeft = async () => press('left');
+const pressRight = async () => press('right');
+const pressBoth = async () => press('both');
 
 export {
     pressLeft, pressRight, pressBoth
-};
\ No newline at end of file
+};
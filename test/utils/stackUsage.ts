@@ -0,0 +1,49 @@
+import Transport from '@ledgerhq/hw-transport-node-speculos';
+import { promises as fsPromises } from 'fs';
+
+/**
+ * Stack high-water marks of debug builds (`make DEBUG=1`), read with GET_PERF_STATS after every signed fixture.
+ * Release builds do not support the command and nothing is collected. Marks are printed after the tests and
+ * written to STACK_REPORT file as JSON when the variable is set.
+ */
+const GET_PERF_STATS = 0x1C;
+const SIGN_TRANSACTION = 0x04;
+const SW_OK = 0x9000;
+const SW_INS_NOT_SUPPORTED = 0x6D00;
+const STACK_COUNTERS_OFFSET = 64; // stack size, previous INS, its high-water mark and the peak follow 16 counters
+
+type StackUsage = { size: number, used: number, free: number };
+
+const usages = new Map<string, StackUsage>();
+
+const recordStackUsage = async (transport: Transport, name: string) => {
+    const response = await transport.send(0xD4, GET_PERF_STATS, 0x00, 0x00, Buffer.alloc(0), [SW_OK, SW_INS_NOT_SUPPORTED]);
+    if (response.readUInt16BE(response.length - 2) !== SW_OK) {
+        return;
+    }
+
+    const size = response.readUInt32BE(STACK_COUNTERS_OFFSET);
+    const ins = response.readUInt32BE(STACK_COUNTERS_OFFSET + 4);
+    const used = response.readUInt32BE(STACK_COUNTERS_OFFSET + 8);
+    if (ins === SIGN_TRANSACTION) {
+        usages.set(name, { size, used, free: size - used });
+    }
+}
+
+const reportStackUsage = async () => {
+    if (usages.size === 0) {
+        return;
+    }
+
+    const report: { [name: string]: StackUsage } = {};
+    [...usages.keys()].sort().forEach(name => report[name] = usages.get(name) as StackUsage);
+    console.table(report);
+
+    if (process.env.STACK_REPORT) {
+        await fsPromises.writeFile(process.env.STACK_REPORT, JSON.stringify(report, null, 2) + '\n');
+    }
+}
+
+export {
+    recordStackUsage, reportStackUsage
+};
@@ -0,0 +1,95 @@
+import { promises as fsPromises } from 'fs';
+import * as path from 'path';
+
+/**
+ * APDU traces use the script format of the native build (see native/tests/), so a recorded trace can be replayed
+ * with `hive_native --script` as well:
+ *
+ *   # test title
+ *   => d40600000000
+ *   # button: both
+ *   <= 0101019000
+ *   # elapsed: 1.234 ms
+ */
+type TraceEvent =
+    | { type: 'command', apdu: Buffer }
+    | { type: 'button', button: string }
+    | { type: 'response', response: Buffer, elapsed?: number }
+    | { type: 'title', title: string };
+
+const BUTTON_PREFIX = '# button: ';
+const ELAPSED_PREFIX = '# elapsed: ';
+
+const serializeTrace = (events: TraceEvent[]): string => events.map(event => {
+    switch (event.type) {
+        case 'command':
+            return `=> ${event.apdu.toString('hex')}`;
+        case 'button':
+            return `${BUTTON_PREFIX}${event.button}`;
+        case 'response':
+            return `<= ${event.response.toString('hex')}` + (event.elapsed !== undefined ? `\n${ELAPSED_PREFIX}${event.elapsed.toFixed(3)} ms` : '');
+        case 'title':
+            return `\n# ${event.title}`;
+    }
+}).join('\n').trim() + '\n';
+
+const parseTrace = (content: string): TraceEvent[] => {
+    const events: TraceEvent[] = [];
+    for (const rawLine of content.split('\n')) {
+        const line = rawLine.trim();
+        if (line.startsWith('=>')) {
+            events.push({ type: 'command', apdu: Buffer.from(line.slice(2).trim(), 'hex') });
+        } else if (line.startsWith('<=')) {
+            events.push({ type: 'response', response: Buffer.from(line.slice(2).trim(), 'hex') });
+        } else if (line.startsWith(BUTTON_PREFIX)) {
+            events.push({ type: 'button', button: line.slice(BUTTON_PREFIX.length).trim() });
+        } else if (line.startsWith(ELAPSED_PREFIX)) {
+            const last = events[events.length - 1];
+            if (last?.type === 'response') {
+                last.elapsed = parseFloat(line.slice(ELAPSED_PREFIX.length));
+            }
+        } else if (line.startsWith('#')) {
+            events.push({ type: 'title', title: line.slice(1).trim() });
+        } else if (line !== '') {
+            throw new Error(`Invalid trace line: ${line}`);
+        }
+    }
+    return events;
+}
+
+/**
+ * Recorder collecting exchanges of the functional tests when APDU_TRACE_DIR is set, one trace per test file
+ */
+const traceDirectory = process.env.APDU_TRACE_DIR;
+const traces = new Map<string, TraceEvent[]>();
+let currentTrace: TraceEvent[] | undefined;
+
+const startTrace = (file: string, title: string) => {
+    if (!traceDirectory) {
+        return;
+    }
+    const name = path.basename(file).replace(/\.test\.ts$/, '');
+    if (!traces.has(name)) {
+        traces.set(name, []);
+    }
+    currentTrace = traces.get(name);
+    currentTrace?.push({ type: 'title', title });
+}
+
+const recordCommand = (apdu: Buffer) => currentTrace?.push({ type: 'command', apdu: Buffer.from(apdu) });
+const recordButton = (button: string) => currentTrace?.push({ type: 'button', button });
+const recordResponse = (response: Buffer, elapsed: number) => currentTrace?.push({ type: 'response', response: Buffer.from(response), elapsed });
+
+const writeTraces = async () => {
+    if (!traceDirectory) {
+        return;
+    }
+    await fsPromises.mkdir(traceDirectory, { recursive: true });
+    for (const [name, events] of traces) {
+        await fsPromises.writeFile(path.join(traceDirectory, `${name}.apdu`), serializeTrace(events));
+    }
+}
+
+export {
+    TraceEvent, serializeTrace, parseTrace, traceDirectory, startTrace, recordCommand, recordButton, recordResponse, writeTraces
+};
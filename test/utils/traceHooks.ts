@@ -0,0 +1,31 @@
+import Transport from '@ledgerhq/hw-transport-node-speculos';
+import { performance } from 'perf_hooks';
+import { traceDirectory, startTrace, recordCommand, recordResponse, writeTraces } from './trace';
+import { reportStackUsage } from './stackUsage';
+
+/**
+ * Mocha root hooks recording APDU traces, enabled with APDU_TRACE_DIR environment variable, and reporting stack
+ * usage collected by the tests
+ */
+if (traceDirectory) {
+    const exchange = Transport.prototype.exchange;
+    Transport.prototype.exchange = async function (this: Transport, apdu: Buffer): Promise<Buffer> {
+        recordCommand(apdu);
+        const start = performance.now();
+        const response = await exchange.call(this, apdu);
+        recordResponse(response, performance.now() - start);
+        return response;
+    };
+}
+
+export const mochaHooks = {
+    beforeEach(this: Mocha.Context) {
+        if (this.currentTest?.file) {
+            startTrace(this.currentTest.file, this.currentTest.fullTitle());
+        }
+    },
+    async afterAll() {
+        await writeTraces();
+        await reportStackUsage();
+    }
+};
@@ -204,6 +204,41 @@ static void test_buffer_read_bip32_path(void **state) {
 
 }
 
+static void test_buffer_read_varint(void **state) {
+    (void) state;
+
+    // clang-format off
+    uint8_t temp[] = {
+        0x7F,
+        0xE5, 0x8E, 0x26,
+        0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+        0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+        0x80
+    };
+    // clang-format on
+    buffer_t buf = {.ptr = temp, .size = sizeof(temp), .offset = 0};
+
+    uint32_t value = 0;
+    assert_true(buffer_read_varint(&buf, &value));
+    assert_int_equal(value, 127);
+    assert_int_equal(buf.offset, 1);
+
+    assert_true(buffer_read_varint(&buf, &value));
+    assert_int_equal(value, 624485);
+    assert_int_equal(buf.offset, 4);
+
+    assert_true(buffer_read_varint(&buf, &value));
+    assert_int_equal(value, 0xFFFFFFFF);
+    assert_int_equal(buf.offset, 9);
+
+    assert_false(buffer_read_varint(&buf, &value));  // overflows 32 bits
+    assert_int_equal(buf.offset, 9);
+
+    assert_true(buffer_seek_set(&buf, 14));
+    assert_false(buffer_read_varint(&buf, &value));  // truncated
+    assert_int_equal(value, 0);
+}
+
 int main() {
     const struct CMUnitTest tests[] = {cmocka_unit_test(test_buffer_can_read),
                                        cmocka_unit_test(test_buffer_seek),
@@ -212,7 +247,8 @@ int main() {
                                        cmocka_unit_test(test_buffer_move),
                                        cmocka_unit_test(test_buffer_move_partial), 
                                        cmocka_unit_test(test_buffer_read_tlv),
-                                       cmocka_unit_test(test_buffer_read_bip32_path)};
+                                       cmocka_unit_test(test_buffer_read_bip32_path),
+                                       cmocka_unit_test(test_buffer_read_varint)};
 
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
\ No newline at end of file
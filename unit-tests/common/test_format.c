@@ -102,6 +102,8 @@ static void test_format_asset(void **state) {
     asset_t asset_vests = {.amount = 13371337, .precision = 6, .symbol = {0x56, 0x45, 0x53, 0x54, 0x53, 0x00}};
     asset_t asset_steem_zero = {.amount = 0, .precision = 3, .symbol = {0x53, 0x54, 0x45, 0x45, 0x4d, 0x00, 0x00}};
     asset_t asset_testnet = {.amount = 0, .precision = 3, .symbol = {0x54, 0x45, 0x53, 0x54, 0x53, 0x00, 0x00}};
+    asset_t asset_long_symbol = {.amount = 1, .precision = 3, .symbol = {0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47}};
+    asset_t asset_large_precision = {.amount = -1, .precision = 255, .symbol = {0x53, 0x42, 0x44, 0x00}};
 
     // not enought space
     assert_false(format_asset(&asset_steem, out, sizeof(out) - 5));
@@ -125,6 +127,13 @@ static void test_format_asset(void **state) {
     // should parse testnet asset
     assert_true(format_asset(&asset_testnet, out, sizeof(out)));
     assert_string_equal(out, "0.000 TESTS");
+
+    // should parse asset with symbol of 7 characters, which is not null terminated
+    assert_true(format_asset(&asset_long_symbol, out, sizeof(out)));
+    assert_string_equal(out, "0.001 ABCDEFG");
+
+    // not enough space for zeroes required by precision
+    assert_false(format_asset(&asset_large_precision, out, sizeof(out)));
 }
 
 static void test_format_hash(void **state) {
@@ -0,0 +1,132 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "common/json.h"
+
+static bool tokenize(const char *document) {
+    json_token_t token;
+    json_t json;
+
+    json_init(&json, document, strlen(document));
+    do {
+        if (!json_next(&json, &token)) {
+            return false;
+        }
+    } while (token.type != JSON_TOKEN_NONE);
+
+    return true;
+}
+
+static void test_json_next(void **state) {
+    (void) state;
+
+    const char *document = " {\"a\": [1, \"x\\\"y\"], \"b\": null} ";
+    json_token_t token;
+    json_t json;
+
+    json_init(&json, document, strlen(document));
+
+    assert_true(json_next(&json, &token));
+    assert_int_equal(token.type, JSON_TOKEN_OBJECT);
+    assert_int_equal(token.depth, 0);
+
+    assert_true(json_next(&json, &token));
+    assert_int_equal(token.type, JSON_TOKEN_ARRAY);
+    assert_int_equal(token.depth, 1);
+    assert_int_equal(token.key_length, 1);
+    assert_memory_equal(token.key, "a", 1);
+
+    assert_true(json_next(&json, &token));
+    assert_int_equal(token.type, JSON_TOKEN_PRIMITIVE);
+    assert_int_equal(token.index, 0);
+    assert_true(json_token_equal(&token, "1"));
+
+    // escape sequences are kept as they are
+    assert_true(json_next(&json, &token));
+    assert_int_equal(token.type, JSON_TOKEN_STRING);
+    assert_int_equal(token.index, 1);
+    assert_true(json_token_equal(&token, "x\\\"y"));
+
+    assert_true(json_next(&json, &token));
+    assert_int_equal(token.type, JSON_TOKEN_END);
+    assert_int_equal(token.depth, 1);
+
+    assert_true(json_next(&json, &token));
+    assert_int_equal(token.type, JSON_TOKEN_PRIMITIVE);
+    assert_int_equal(token.index, 1);
+    assert_true(json_token_equal(&token, "null"));
+
+    assert_true(json_next(&json, &token));
+    assert_int_equal(token.type, JSON_TOKEN_END);
+    assert_int_equal(token.depth, 0);
+
+    assert_true(json_next(&json, &token));
+    assert_int_equal(token.type, JSON_TOKEN_NONE);
+}
+
+static void test_json_next_malformed(void **state) {
+    (void) state;
+
+    assert_true(tokenize("[]"));
+    assert_true(tokenize("\"text\""));
+    assert_true(tokenize("[[[[[[[[]]]]]]]]"));
+
+    assert_false(tokenize(""));
+    assert_false(tokenize("[1,]"));
+    assert_false(tokenize("[1 2]"));
+    assert_false(tokenize("{\"a\" 1}"));
+    assert_false(tokenize("{1: 1}"));
+    assert_false(tokenize("[1}"));
+    assert_false(tokenize("[\"unterminated]"));
+    assert_false(tokenize("[tru]"));
+    assert_false(tokenize("[] []"));
+    assert_false(tokenize("[\"\\"));
+
+    // nested deeper than JSON_MAX_DEPTH
+    assert_false(tokenize("[[[[[[[[[]]]]]]]]]"));
+}
+
+static void test_json_find(void **state) {
+    (void) state;
+
+    const char *document = "[\"follow\", {\"follower\": \"alice\", \"what\": [\"blog\"]}]";
+    const char *paths[] = {"0", "1.follower", "1.what", "1.following"};
+    json_token_t values[4];
+
+    assert_true(json_find(document, strlen(document), paths, 4, values));
+    assert_true(json_token_equal(&values[0], "follow"));
+    assert_true(json_token_equal(&values[1], "alice"));
+
+    // containers are returned whole
+    assert_int_equal(values[2].type, JSON_TOKEN_ARRAY);
+    assert_true(json_token_equal(&values[2], "[\"blog\"]"));
+
+    // missing member
+    assert_int_equal(values[3].type, JSON_TOKEN_NONE);
+
+    // value not covered by any path
+    const char *partial[] = {"0", "1.follower"};
+    assert_false(json_find(document, strlen(document), partial, 2, values));
+
+    // duplicated member
+    const char *duplicated = "{\"a\": 1, \"a\": 2}";
+    const char *members[] = {"a"};
+    assert_false(json_find(duplicated, strlen(duplicated), members, 1, values));
+
+    // whole document
+    const char *root[] = {""};
+    assert_true(json_find(document, strlen(document), root, 1, values));
+    assert_int_equal(values[0].length, strlen(document));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_json_next), cmocka_unit_test(test_json_next_malformed), cmocka_unit_test(test_json_find)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
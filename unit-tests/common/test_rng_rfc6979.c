@@ -0,0 +1,53 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+#include "cx.h"
+#include "common/rng_rfc6979.h"
+
+cx_err_t __wrap_cx_hmac_sha256_init_no_throw(cx_hmac_sha256_t *hmac, const uint8_t *key, size_t key_len) {
+    return CX_OK;
+}
+
+cx_err_t __wrap_cx_hmac_no_throw(cx_hmac_t *hmac, uint32_t mode, const uint8_t *in, size_t len, uint8_t *mac, size_t mac_len) {
+    if ((mode & CX_LAST) != 0) {
+        // zero candidate is lower than any curve order
+        memset(mac, 0, mac_len);
+    }
+    return CX_OK;
+}
+
+static void test_rng_rfc6979_state_length(void **state) {
+    (void) state;
+
+    static const uint8_t q[DIGEST_LEN] = {0xff};
+    uint8_t h1[DIGEST_LEN] = {0x01};
+    uint8_t x[DIGEST_LEN] = {0x02};
+    uint8_t rnd[DIGEST_LEN];
+    uint8_t K[DIGEST_LEN];
+    struct {
+        uint8_t V[RNG_RFC6979_V_LEN];
+        uint8_t guard[4];
+    } buffers;
+
+    memset(&buffers, 0xaa, sizeof(buffers));
+
+    // separator byte is written right after V, within RNG_RFC6979_V_LEN
+    rng_rfc6979(rnd, h1, x, sizeof(x), q, sizeof(q), buffers.V, K);
+    assert_int_equal(buffers.V[DIGEST_LEN], 0x01);
+    assert_memory_equal(buffers.guard, "\xaa\xaa\xaa\xaa", sizeof(buffers.guard));
+
+    rng_rfc6979(rnd, h1, NULL, 0, q, sizeof(q), buffers.V, K);
+    assert_int_equal(buffers.V[DIGEST_LEN], 0x00);
+    assert_memory_equal(buffers.guard, "\xaa\xaa\xaa\xaa", sizeof(buffers.guard));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_rng_rfc6979_state_length)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,99 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "common/signature.h"
+
+static void test_signature_check_canonical_integer(void **state) {
+    (void) state;
+
+    uint8_t value[32] = {0};
+
+    memset(value, 0x11, sizeof(value));
+    assert_true(signature_check_canonical_integer(value));
+
+    value[0] = 0x7F;
+    assert_true(signature_check_canonical_integer(value));
+
+    value[0] = 0x01;
+    assert_true(signature_check_canonical_integer(value));
+
+    // DER encoding would need a leading zero byte
+    value[0] = 0x80;
+    assert_false(signature_check_canonical_integer(value));
+
+    // DER encoding would be shorter than 32 bytes
+    value[0] = 0x00;
+    assert_false(signature_check_canonical_integer(value));
+
+    // canonical for Hive but never produced by the app
+    value[1] = 0x80;
+    assert_false(signature_check_canonical_integer(value));
+}
+
+static void test_signature_check_canonical(void **state) {
+    (void) state;
+
+    uint8_t signature[64] = {0};
+
+    memset(signature, 0x11, sizeof(signature));
+    assert_true(signature_check_canonical(signature));
+
+    // non-canonical s
+    signature[32] = 0x80;
+    assert_false(signature_check_canonical(signature));
+
+    // non-canonical r
+    signature[32] = 0x11;
+    signature[0] = 0x00;
+    assert_false(signature_check_canonical(signature));
+}
+
+static void test_signature_from_der(void **state) {
+    (void) state;
+
+    uint8_t der[MAX_DER_SIG_LEN] = {0};
+    uint8_t signature[SIGNATURE_LEN] = {0};
+    uint8_t expected[SIGNATURE_LEN] = {0};
+
+    // r with high bit is padded with zero in DER, s is one byte shorter, R.y is odd
+    der[0] = 0x31;
+    der[1] = 2 + 33 + 2 + 31;
+    der[2] = 0x02;
+    der[3] = 33;
+    der[4] = 0x00;
+    memset(der + 5, 0x81, 32);
+    der[37] = 0x02;
+    der[38] = 31;
+    memset(der + 39, 0x22, 31);
+
+    expected[0] = 27 + 4 + 1;
+    memset(expected + 1, 0x81, 32);
+    memset(expected + 1 + 32 + 1, 0x22, 31);
+
+    assert_true(signature_from_der(der, signature, sizeof(signature)));
+    assert_memory_equal(signature, expected, sizeof(expected));
+
+    // short s is padded, so the signature is not canonical
+    assert_false(signature_check_canonical(signature + 1));
+
+    // output buffer too short
+    assert_false(signature_from_der(der, signature, sizeof(signature) - 1));
+
+    // integer longer than 32 bytes
+    der[3] = 34;
+    assert_false(signature_from_der(der, signature, sizeof(signature)));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_signature_check_canonical_integer),
+                                       cmocka_unit_test(test_signature_check_canonical),
+                                       cmocka_unit_test(test_signature_from_der)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -34,3 +34,27 @@ size_t __wrap_cx_hash_get_size(int fd) {
 cx_err_t __wrap_cx_ripemd160_init_no_throw(cx_ripemd160_t *hash) {
     return mock();
 }
+
+void crypto_derive_compressed_public_key(const uint32_t *bip32_path, uint8_t bip32_path_len, uint8_t public_key[static PUBKEY_COMPRESSED_LEN]) {
+    // distinct key for every role and account of 48'/13'/role'/account'/0'
+    memset(public_key, 0, PUBKEY_COMPRESSED_LEN);
+    public_key[0] = 0x02;
+    public_key[1] = (uint8_t) bip32_path[2];
+    public_key[2] = (uint8_t) bip32_path[3];
+}
+
+void io_seproxyhal_io_heartbeat(void) {
+}
+
+void expect_any_cx_hash(void) {
+    // negative count keeps values queued for every call, and allows them to stay unused
+    will_return_count(__wrap_cx_hash_no_throw, 0, -2);
+    will_return_count(__wrap_cx_hash_get_size, 0, -2);
+
+    expect_any_count(__wrap_cx_hash_no_throw, hash, -2);
+    expect_any_count(__wrap_cx_hash_no_throw, mode, -2);
+    expect_any_count(__wrap_cx_hash_no_throw, in, -2);
+    expect_any_count(__wrap_cx_hash_no_throw, len, -2);
+    expect_any_count(__wrap_cx_hash_no_throw, out, -2);
+    expect_any_count(__wrap_cx_hash_no_throw, out_len, -2);
+}
@@ -7,9 +7,19 @@
 
 #include <cmocka.h>
 #include "cx.h"
+#include "constants.h"
 
 int __wrap_os_longjmp(int fd);
 void *__wrap_pic(void *link_address);
 cx_err_t __wrap_cx_hash_no_throw(cx_hash_t *hash, uint32_t mode, const uint8_t *in, size_t len, uint8_t *out, size_t out_len);
 size_t __wrap_cx_hash_get_size(int fd);
-cx_err_t __wrap_cx_ripemd160_init_no_throw(cx_ripemd160_t *hash);
\ No newline at end of file
+cx_err_t __wrap_cx_ripemd160_init_no_throw(cx_ripemd160_t *hash);
+/**
+ * Fake key derivation, key is 0x02 followed by the low bytes of role and account of the path, zero padded
+ */
+void crypto_derive_compressed_public_key(const uint32_t *bip32_path, uint8_t bip32_path_len, uint8_t public_key[static PUBKEY_COMPRESSED_LEN]);
+void io_seproxyhal_io_heartbeat(void);
+/**
+ * Accept any number of cx_hash calls until the end of the test, i.e. while fields are validated and hashed
+ */
+void expect_any_cx_hash(void);
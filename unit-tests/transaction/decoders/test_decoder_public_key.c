@@ -60,6 +60,71 @@ static void test_decoder_public_key(void **state) {
     assert_string_equal(field.value, "STM5r6G7EsPUUPYojYhd9nt8dEZ4fwBNUbz2nQyxXHf56ccp8v9j5");
 }
 
+static void test_decoder_public_key_owner(void **state) {
+    (void) state;
+
+    // clang-format off
+    uint8_t data[] = {
+        0x02, 0x7e, 0x40,  // uint8_t[33] compressed public key
+        0x35, 0x7c, 0xba,
+        0x6d, 0x9f, 0x35,
+        0x43, 0x92, 0x69,
+        0x4a, 0xb4, 0xaf,
+        0x20, 0x21, 0x8f,
+        0x5a, 0x10, 0x8f,
+        0xc8, 0xdc, 0xec,
+        0x28, 0xc1, 0xe1,
+        0x66, 0x70, 0x8c,
+        0x82, 0x40, 0x67
+    };
+    // clang-format on
+
+    field_t field = {0};
+    buffer_t buffer = {.offset = 0, .ptr = data, .size = sizeof(data)};
+
+    // posting key of the second indexed account
+    memset(&G_key_index, 0, sizeof(G_key_index));
+    G_key_index.first_account = 2;
+    memcpy(G_key_index.entries[0].fingerprint, data, KEY_FINGERPRINT_LEN);
+    G_key_index.entries[0].role = 4;
+    G_key_index.entries[0].account = 1;
+    G_key_index.size = 1;
+
+    will_return(__wrap_cx_ripemd160_init_no_throw, 0);
+    will_return(__wrap_cx_hash_no_throw, 0);
+    will_return(__wrap_cx_hash_get_size, 0);
+
+    expect_any(__wrap_cx_hash_no_throw, hash);
+    expect_any(__wrap_cx_hash_no_throw, mode);
+    expect_any(__wrap_cx_hash_no_throw, in);
+    expect_any(__wrap_cx_hash_no_throw, len);
+    expect_any(__wrap_cx_hash_no_throw, out);
+    expect_any(__wrap_cx_hash_no_throw, out_len);
+
+    // keys are labelled on the transaction review screens only
+    assert_true(decoder_public_key(&buffer, &field, false));
+    assert_string_equal(field.value, "STM5r6G7EsPUUPYojYhd9nt8dEZ4fwBNUbz2nQyxXHf56ccp8v9j5");
+
+    will_return(__wrap_cx_ripemd160_init_no_throw, 0);
+    will_return(__wrap_cx_hash_no_throw, 0);
+    will_return(__wrap_cx_hash_get_size, 0);
+
+    expect_any(__wrap_cx_hash_no_throw, hash);
+    expect_any(__wrap_cx_hash_no_throw, mode);
+    expect_any(__wrap_cx_hash_no_throw, in);
+    expect_any(__wrap_cx_hash_no_throw, len);
+    expect_any(__wrap_cx_hash_no_throw, out);
+    expect_any(__wrap_cx_hash_no_throw, out_len);
+
+    buffer.offset = 0;
+    G_context.tx_info.label_own_keys = true;
+    assert_true(decoder_public_key(&buffer, &field, false));
+    assert_string_equal(field.value, "STM5r6G7EsPUUPYojYhd9nt8dEZ4fwBNUbz2nQyxXHf56ccp8v9j5 (this device, posting, account 3)");
+
+    G_context.tx_info.label_own_keys = false;
+    memset(&G_key_index, 0, sizeof(G_key_index));
+}
+
 static void test_decoder_public_key_hashing(void **state) {
     (void) state;
 
@@ -111,8 +176,38 @@ static void test_decoder_public_key_hashing(void **state) {
     assert_string_equal(field.value, "");
 }
 
+static void test_decoder_public_key_invalid_prefix(void **state) {
+    (void) state;
+
+    // 0xff prefix encodes to the longest WIF, one character more than a valid key
+    uint8_t data[PUBKEY_COMPRESSED_LEN] = {0xff, 0x7e, 0x40, 0x35, 0x7c, 0xba, 0x6d, 0x9f, 0x35, 0x43, 0x92, 0x69, 0x4a, 0xb4, 0xaf, 0x20, 0x21,
+                                           0x8f, 0x5a, 0x10, 0x8f, 0xc8, 0xdc, 0xec, 0x28, 0xc1, 0xe1, 0x66, 0x70, 0x8c, 0x82, 0x40, 0x67};
+
+    field_t field = {0};
+    buffer_t buffer = {.offset = 0, .ptr = data, .size = sizeof(data)};
+
+    will_return(__wrap_cx_ripemd160_init_no_throw, 0);
+    will_return(__wrap_cx_hash_no_throw, 0);
+    will_return(__wrap_cx_hash_get_size, 0);
+
+    expect_any(__wrap_cx_hash_no_throw, hash);
+    expect_any(__wrap_cx_hash_no_throw, mode);
+    expect_any(__wrap_cx_hash_no_throw, in);
+    expect_any(__wrap_cx_hash_no_throw, len);
+    expect_any(__wrap_cx_hash_no_throw, out);
+    expect_any(__wrap_cx_hash_no_throw, out_len);
+
+    // checksum is zero as the hash is mocked
+    assert_true(decoder_public_key(&buffer, &field, false));
+    assert_int_equal(field.length, PUBKEY_WIF_STR_LEN);
+    assert_string_equal(field.value, "STM9ZeRtmnwz7agfMkz4HBbCGKAEvUceXg94jhehrZ69rnjU9UACRm");
+}
+
 int main() {
-    const struct CMUnitTest tests[] = {cmocka_unit_test(test_decoder_public_key), cmocka_unit_test(test_decoder_public_key_hashing)};
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_decoder_public_key),
+                                       cmocka_unit_test(test_decoder_public_key_owner),
+                                       cmocka_unit_test(test_decoder_public_key_hashing),
+                                       cmocka_unit_test(test_decoder_public_key_invalid_prefix)};
 
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
@@ -8,6 +8,7 @@
 #include <cmocka.h>
 #include "../unit-tests/mocks.h"
 #include "transaction/parsers.h"
+#include "transaction/field.h"
 #include "types.h"
 #include "globals.h"
 
@@ -84,8 +85,50 @@ static void test_decoder_string_hashing(void **state) {
     assert_string_equal(field.value, "");
 }
 
+static void test_decoder_string_varint_length(void **state) {
+    (void) state;
+
+    uint8_t data[2 + 200] = {0xc8, 0x01};  // 200 encoded on two bytes
+    memset(data + 2, 'a', 200);
+
+    field_t field;
+    buffer_t buffer = {.offset = 0, .ptr = data, .size = sizeof(data)};
+
+    field_reset(&field, 0);
+    assert_true(decoder_string(&buffer, &field, false));
+    assert_int_equal(buffer.offset, sizeof(data));
+    assert_int_equal(field.length, 200);
+
+    // prefix must not be read as a single byte length
+    buffer_seek_set(&buffer, 0);
+    buffer.size = 1 + 0xc8;
+    assert_false(decoder_string(&buffer, &field, false));
+}
+
+static void test_decoder_string_pages(void **state) {
+    (void) state;
+
+    uint8_t data[2 + 400] = {0x90, 0x03};  // 400 encoded on two bytes
+    memset(data + 2, 'a', FIELD_PAGE_LEN);
+    memset(data + 2 + FIELD_PAGE_LEN, 'b', 400 - FIELD_PAGE_LEN);
+
+    field_t field;
+    buffer_t buffer = {.offset = 0, .ptr = data, .size = sizeof(data)};
+
+    // string longer than a page is not truncated, every page shows its part
+    field_reset(&field, 1);
+    assert_true(decoder_string(&buffer, &field, false));
+    assert_int_equal(field.length, 400);
+    assert_int_equal(field_page_count(&field), 2);
+    assert_int_equal(strlen(field.value), 400 - FIELD_PAGE_LEN);
+    assert_int_equal(field.value[0], 'b');
+}
+
 int main() {
-    const struct CMUnitTest tests[] = {cmocka_unit_test(test_decoder_string), cmocka_unit_test(test_decoder_string_hashing)};
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_decoder_string),
+                                       cmocka_unit_test(test_decoder_string_hashing),
+                                       cmocka_unit_test(test_decoder_string_varint_length),
+                                       cmocka_unit_test(test_decoder_string_pages)};
 
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
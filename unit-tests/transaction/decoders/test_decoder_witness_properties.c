@@ -0,0 +1,116 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+#include "../unit-tests/mocks.h"
+#include "transaction/parsers.h"
+#include "types.h"
+#include "globals.h"
+
+// clang-format off
+static const uint8_t PROPERTIES[] = {
+    0x04,                                                                   // varint count
+    0x14, 'a', 'c', 'c', 'o', 'u', 'n', 't', '_', 'c', 'r', 'e', 'a', 't',  // account_creation_fee
+    'i', 'o', 'n', '_', 'f', 'e', 'e',
+    0x10,                                                                   // varint value length
+    0xb8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,                         // 3.000 HIVE
+    0x03, 0x53, 0x54, 0x45, 0x45, 0x4d, 0x00, 0x00,
+    0x11, 'h', 'b', 'd', '_', 'e', 'x', 'c', 'h', 'a', 'n', 'g', 'e', '_',  // hbd_exchange_rate
+    'r', 'a', 't', 'e',
+    0x20,
+    0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,                         // 0.250 HBD
+    0x03, 0x53, 0x42, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0xe8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,                         // 1.000 HIVE
+    0x03, 0x53, 0x54, 0x45, 0x45, 0x4d, 0x00, 0x00,
+    0x0c, 'n', 'e', 'w', '_', 'p', 'r', 'o', 'p', 'e', 'r', 't', 'y',       // unknown property
+    0x0a, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+    0x03, 'u', 'r', 'l',                                                    // url
+    0x05, 0x04, 'h', 'i', 'v', 'e'
+};
+// clang-format on
+
+static void test_decoder_witness_properties(void **state) {
+    (void) state;
+
+    uint8_t data[sizeof(PROPERTIES)];
+    memcpy(data, PROPERTIES, sizeof(data));
+
+    field_t field = {0};
+    buffer_t buffer = {.offset = 0, .ptr = data, .size = sizeof(data)};
+
+    assert_true(decoder_witness_properties(&buffer, &field, false));
+    assert_int_equal(buffer.offset, sizeof(data));
+    assert_string_equal(field.value,
+                        "Acc. creation fee: 3.000 HIVE, HBD exchange rate: 0.250 HBD / 1.000 HIVE, new_property: 0102030405060708... (10 bytes), Url: hive");
+
+    // no properties
+    uint8_t empty[] = {0x00};
+    buffer_t buffer_empty = {.offset = 0, .ptr = empty, .size = sizeof(empty)};
+    assert_true(decoder_witness_properties(&buffer_empty, &field, false));
+    assert_string_equal(field.value, "[ ]");
+
+    // truncated
+    buffer.size = sizeof(data) - 1;
+    assert_true(buffer_seek_set(&buffer, 0));
+    assert_false(decoder_witness_properties(&buffer, &field, false));
+}
+
+static void test_decoder_witness_properties_invalid(void **state) {
+    (void) state;
+
+    uint8_t data[sizeof(PROPERTIES)];
+    field_t field = {0};
+    buffer_t buffer = {.offset = 0, .ptr = data, .size = sizeof(data)};
+
+    // keys out of order, "zew_property" before "url"
+    memcpy(data, PROPERTIES, sizeof(data));
+    data[91] = 'z';
+    assert_false(decoder_witness_properties(&buffer, &field, false));
+
+    // value of known property longer than its type, fee is followed by part of the next key
+    memcpy(data, PROPERTIES, sizeof(data));
+    data[22] = 0x20;
+    assert_true(buffer_seek_set(&buffer, 0));
+    assert_false(decoder_witness_properties(&buffer, &field, false));
+
+    // asset which can not be displayed is rejected by the hash pass already
+    memcpy(data, PROPERTIES, sizeof(data));
+    data[31] = 0xff;
+    assert_true(buffer_seek_set(&buffer, 0));
+    assert_false(decoder_witness_properties(&buffer, &field, true));
+}
+
+static void test_decoder_witness_properties_hashing(void **state) {
+    (void) state;
+
+    field_t field = {0};
+    buffer_t buffer = {.offset = 0, .ptr = PROPERTIES, .size = sizeof(PROPERTIES)};
+
+    will_return(__wrap_cx_hash_no_throw, 0);
+    will_return(__wrap_cx_hash_get_size, 0);
+
+    // expect whole map to be hashed at once
+    expect_value(__wrap_cx_hash_no_throw, hash, &G_context.tx_info.sha);
+    expect_value(__wrap_cx_hash_no_throw, mode, 0);
+    expect_memory(__wrap_cx_hash_no_throw, in, PROPERTIES, sizeof(PROPERTIES));
+    expect_value(__wrap_cx_hash_no_throw, len, sizeof(PROPERTIES));
+    expect_value(__wrap_cx_hash_no_throw, out, NULL);
+    expect_value(__wrap_cx_hash_no_throw, out_len, 0);
+
+    assert_true(decoder_witness_properties(&buffer, &field, true));
+
+    // expect it to not modify the output field, just hash data
+    assert_string_equal(field.value, "");
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_decoder_witness_properties),
+                                       cmocka_unit_test(test_decoder_witness_properties_invalid),
+                                       cmocka_unit_test(test_decoder_witness_properties_hashing)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,161 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+#include "transaction/account_create.h"
+#include "types.h"
+
+// clang-format off
+static const uint8_t REQUEST[] = {
+    0x05, 0x80, 0x00, 0x00, 0x30, 0x80, 0x00, 0x00, 0x0d, 0x80, 0x00, 0x00,  // m/48'/13'/0'/0'/0'
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0xbe, 0xea, 0xb0, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // chain id
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x42, 0xef, 0x2c, 0xd8, 0x6d, 0x20, 0x7f, 0x35, 0x60,              // ref_block_num, ref_block_prefix, expiration
+    0x09,                                                                    // account_create
+    0xb8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,                          // 3.000 HIVE
+    0x03, 0x53, 0x54, 0x45, 0x45, 0x4d, 0x00, 0x00,
+    0x07, 'e', 'n', 'g', 'r', 'a', 'v', 'e',                                 // creator
+    0x0a, 'a', 'l', 'i', 'c', 'e', '.', 't', 'e', 's', 't',                  // new account name
+    0x00, 0x00, 0x00, 0x01                                                   // account index
+};
+// clang-format on
+
+#define REQUEST_NAME_OFFSET  (sizeof(REQUEST) - 15)
+#define REQUEST_INDEX_OFFSET (sizeof(REQUEST) - 4)
+
+static parser_status_e parse(const uint8_t *data, size_t size, account_request_t *request) {
+    buffer_t buf = {.ptr = data, .size = size, .offset = 0};
+
+    return account_request_parse(&buf, request);
+}
+
+static void test_account_request_parse(void **state) {
+    (void) state;
+
+    uint8_t data[sizeof(REQUEST) + 1];
+    account_request_t request;
+
+    memcpy(data, REQUEST, sizeof(REQUEST));
+
+    assert_int_equal(parse(data, sizeof(REQUEST), &request), PARSING_OK);
+    assert_int_equal(request.bip32_path_len, 5);
+    assert_int_equal(request.operation, OPERATION_ACCOUNT_CREATE);
+    assert_int_equal(request.fee.amount, 3000);
+    assert_string_equal(request.creator, "engrave");
+    assert_string_equal(request.new_account_name, "alice.test");
+    assert_int_equal(request.account_index, 1);
+
+    // trailing byte
+    assert_int_equal(parse(data, sizeof(data), &request), WRONG_LENGTH_ERROR);
+
+    // truncated
+    assert_int_equal(parse(data, sizeof(REQUEST) - 1, &request), FIELD_PARSING_ERROR);
+
+    // hardened account index
+    data[REQUEST_INDEX_OFFSET] = 0x80;
+    assert_int_equal(parse(data, sizeof(REQUEST), &request), FIELD_PARSING_ERROR);
+    data[REQUEST_INDEX_OFFSET] = 0x00;
+
+    // operation other than account creation
+    data[63] = 0x16;
+    assert_int_equal(parse(data, sizeof(REQUEST), &request), FIELD_PARSING_ERROR);
+}
+
+static void test_account_request_parse_name(void **state) {
+    (void) state;
+
+    // names of the same length as "alice.test"
+    const char *valid[] = {"alice-test", "abc-de.fgh", "a12345.b67"};
+    const char *invalid[] = {"Alice.test", "alice.te_t", "alice-.est", "1lice.test", "al.ce.test", "alice.tes."};
+    uint8_t data[sizeof(REQUEST)];
+    account_request_t request;
+
+    for (size_t i = 0; i < sizeof(valid) / sizeof(valid[0]); i++) {
+        memcpy(data, REQUEST, sizeof(REQUEST));
+        memcpy(data + REQUEST_NAME_OFFSET + 1, valid[i], 10);
+        assert_int_equal(parse(data, sizeof(data), &request), PARSING_OK);
+        assert_string_equal(request.new_account_name, valid[i]);
+    }
+
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+        memcpy(data, REQUEST, sizeof(REQUEST));
+        memcpy(data + REQUEST_NAME_OFFSET + 1, invalid[i], 10);
+        assert_int_equal(parse(data, sizeof(data), &request), FIELD_PARSING_ERROR);
+    }
+
+    // name shorter than 3 characters, the rest of the request follows
+    memcpy(data, REQUEST, sizeof(REQUEST));
+    data[REQUEST_NAME_OFFSET] = 2;
+    assert_int_equal(parse(data, sizeof(data), &request), FIELD_PARSING_ERROR);
+}
+
+static void test_account_key_path(void **state) {
+    (void) state;
+
+    uint32_t path[ACCOUNT_KEY_PATH_LEN];
+    const uint32_t expected[ACCOUNT_KEY_PATH_LEN] = {0x80000030, 0x8000000d, POSTING_KEY_ROLE, 0x80000007, 0x80000000};
+
+    account_key_path(7, POSTING_KEY_ROLE, path);
+    assert_memory_equal(path, expected, sizeof(expected));
+}
+
+static void test_account_create_serialize(void **state) {
+    (void) state;
+
+    const uint8_t header[] = {0x04, 0x02, 0x19, 0x42, 0x04, 0x04, 0xef, 0x2c, 0xd8, 0x6d, 0x04, 0x04, 0x20, 0x7f, 0x35, 0x60};
+    const uint8_t operation[] = {0x04, 0x01, 0x01, 0x04, 0x81, 193, 0x09};
+    const uint8_t authority[] = {0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02};
+    const uint8_t key_weight[] = {0x01, 0x00};
+    const uint8_t trailer[] = {0x00, 0x04, 0x01, 0x00};
+    uint8_t keys[ACCOUNT_KEYS_COUNT][PUBKEY_COMPRESSED_LEN];
+    uint8_t out[MAX_TRANSACTION_LEN];
+    account_request_t request;
+
+    for (uint8_t i = 0; i < ACCOUNT_KEYS_COUNT; i++) {
+        memset(keys[i], 0x02 + i, PUBKEY_COMPRESSED_LEN);
+    }
+
+    assert_int_equal(parse(REQUEST, sizeof(REQUEST), &request), PARSING_OK);
+
+    // path (21), chain id (34), header (4 + 6 + 6), operations count (3), operation (3 + 193), extensions (3)
+    const size_t length = account_create_serialize(&request, (const uint8_t(*)[PUBKEY_COMPRESSED_LEN]) keys, out, sizeof(out));
+    assert_int_equal(length, 21 + 34 + 16 + 3 + 196 + 3);
+
+    // path and header are copied from the request
+    assert_memory_equal(out, REQUEST, 21);
+    assert_memory_equal(out + 23, REQUEST + 21, CHAIN_ID_LEN);
+    assert_memory_equal(out + 55, header, sizeof(header));
+    assert_memory_equal(out + 71, operation, sizeof(operation));
+
+    // owner authority with a single key follows fee, creator and new account name
+    const uint8_t *owner = out + 78 + 16 + 8 + 11;
+    assert_memory_equal(owner, authority, sizeof(authority));
+    assert_memory_equal(owner + 6 + PUBKEY_COMPRESSED_LEN, key_weight, sizeof(key_weight));
+
+    // memo key, empty json_metadata and empty transaction extensions
+    assert_memory_equal(out + length - 4 - PUBKEY_COMPRESSED_LEN, keys[3], PUBKEY_COMPRESSED_LEN);
+    assert_memory_equal(out + length - 4, trailer, sizeof(trailer));
+
+    // create_claimed_account has no fee and ends with empty extensions
+    request.operation = OPERATION_CREATE_CLAIMED_ACCOUNT;
+    assert_int_equal(account_create_serialize(&request, (const uint8_t(*)[PUBKEY_COMPRESSED_LEN]) keys, out, sizeof(out)), length - 16 + 1);
+    assert_int_equal(out[76], 193 - 16 + 1);
+
+    // output too short
+    assert_int_equal(account_create_serialize(&request, (const uint8_t(*)[PUBKEY_COMPRESSED_LEN]) keys, out, 100), 0);
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_account_request_parse),
+                                       cmocka_unit_test(test_account_request_parse_name),
+                                       cmocka_unit_test(test_account_key_path),
+                                       cmocka_unit_test(test_account_create_serialize)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,102 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+#include "transaction/custom_json.h"
+#include "transaction/field.h"
+#include "types.h"
+
+static void render(const char *id, const char *json, field_t *field) {
+    field_reset(field, 0);
+    custom_json_render(id, strlen(id), json, strlen(json), field);
+}
+
+static void test_custom_json_follow(void **state) {
+    (void) state;
+
+    field_t field;
+
+    render("follow", "[\"follow\",{\"follower\":\"alice\",\"following\":\"bob\",\"what\":[\"blog\"]}]", &field);
+    assert_string_equal(field.value, "@alice follows @bob");
+
+    render("follow", "[\"follow\",{\"follower\":\"alice\",\"following\":\"bob\",\"what\":[]}]", &field);
+    assert_string_equal(field.value, "@alice unfollows @bob");
+
+    render("follow", "[\"follow\",{\"follower\":\"alice\",\"following\":\"bob\",\"what\":[\"ignore\"]}]", &field);
+    assert_string_equal(field.value, "@alice mutes @bob");
+
+    render("follow", "[\"reblog\",{\"account\":\"alice\",\"author\":\"bob\",\"permlink\":\"post\"}]", &field);
+    assert_string_equal(field.value, "@alice reblogs @bob/post");
+}
+
+static void test_custom_json_ssc(void **state) {
+    (void) state;
+
+    field_t field;
+
+    render("ssc-mainnet-hive",
+           "{\"contractName\":\"tokens\",\"contractAction\":\"transfer\",\"contractPayload\":{\"symbol\":\"BEE\",\"to\":\"bob\",\"quantity\":\"1.000\",\"memo\":\"hi\"}}",
+           &field);
+    assert_string_equal(field.value, "tokens transfer 1.000 BEE to @bob memo: hi");
+
+    render("ssc-mainnet-hive", "{\"contractName\":\"market\",\"contractAction\":\"buy\",\"contractPayload\":{\"symbol\":\"BEE\",\"quantity\":\"10\",\"price\":\"0.3\"}}", &field);
+    assert_string_equal(field.value, "market buy 10 BEE at 0.3");
+}
+
+static void test_custom_json_rc(void **state) {
+    (void) state;
+
+    field_t field;
+
+    render("rc", "[\"delegate_rc\",{\"from\":\"alice\",\"delegatees\":[\"bob\",\"carol\"],\"max_rc\":1000}]", &field);
+    assert_string_equal(field.value, "@alice delegates 1000 RC to @bob, @carol");
+}
+
+static void test_custom_json_raw(void **state) {
+    (void) state;
+
+    field_t field;
+
+    // id without a renderer
+    render("notify", "[\"setLastRead\",{\"date\":\"2021-03-01T10:43:15\"}]", &field);
+    assert_string_equal(field.value, "[\"setLastRead\",{\"date\":\"2021-03-01T10:43:15\"}]");
+
+    // member the renderer does not show
+    render("follow", "[\"follow\",{\"follower\":\"alice\",\"following\":\"bob\",\"what\":[\"blog\"],\"x\":1}]", &field);
+    assert_string_equal(field.value, "[\"follow\",{\"follower\":\"alice\",\"following\":\"bob\",\"what\":[\"blog\"],\"x\":1}]");
+
+    // unknown follow action
+    render("follow", "[\"follow\",{\"follower\":\"alice\",\"following\":\"bob\",\"what\":[\"other\"]}]", &field);
+    assert_string_equal(field.value, "[\"follow\",{\"follower\":\"alice\",\"following\":\"bob\",\"what\":[\"other\"]}]");
+
+    // object with members named as indexes of the expected array
+    render("follow", "{\"0\":\"follow\",\"1\":{\"follower\":\"alice\",\"following\":\"bob\",\"what\":[\"blog\"]}}", &field);
+    assert_string_equal(field.value, "{\"0\":\"follow\",\"1\":{\"follower\":\"alice\",\"following\":\"bob\",\"what\":[\"blog\"]}}");
+
+    render("follow", "[\"follow\",{\"follower\":\"alice\",\"following\":\"bob\",\"what\":{\"0\":\"blog\"}}]", &field);
+    assert_string_equal(field.value, "[\"follow\",{\"follower\":\"alice\",\"following\":\"bob\",\"what\":{\"0\":\"blog\"}}]");
+
+    render("rc", "{\"0\":\"delegate_rc\",\"1\":{\"from\":\"alice\",\"delegatees\":[\"bob\"],\"max_rc\":1000}}", &field);
+    assert_string_equal(field.value, "{\"0\":\"delegate_rc\",\"1\":{\"from\":\"alice\",\"delegatees\":[\"bob\"],\"max_rc\":1000}}");
+
+    // empty delegatees, rendering fails after part of the sentence is written
+    render("rc", "[\"delegate_rc\",{\"from\":\"alice\",\"delegatees\":[],\"max_rc\":1000}]", &field);
+    assert_string_equal(field.value, "[\"delegate_rc\",{\"from\":\"alice\",\"delegatees\":[],\"max_rc\":1000}]");
+
+    // malformed payload
+    render("rc", "[\"delegate_rc\",", &field);
+    assert_string_equal(field.value, "[\"delegate_rc\",");
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_custom_json_follow),
+                                       cmocka_unit_test(test_custom_json_ssc),
+                                       cmocka_unit_test(test_custom_json_rc),
+                                       cmocka_unit_test(test_custom_json_raw)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
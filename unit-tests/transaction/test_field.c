@@ -0,0 +1,73 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+#include "transaction/field.h"
+#include "types.h"
+
+static void test_field_single_page(void **state) {
+    (void) state;
+
+    field_t field;
+    field_reset(&field, 0);
+
+    field_append_string(&field, "[ ");
+    field_append(&field, "engrave", 7);
+    field_append_string(&field, " ]");
+
+    assert_string_equal(field.value, "[ engrave ]");
+    assert_int_equal(field.length, 11);
+    assert_int_equal(field_page_count(&field), 1);
+
+    // empty value still takes a single page
+    field_reset(&field, 0);
+    assert_string_equal(field.value, "");
+    assert_int_equal(field_page_count(&field), 1);
+}
+
+static void test_field_pages(void **state) {
+    (void) state;
+
+    char data[FIELD_PAGE_LEN * 2 + 10];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = 'a' + (i / FIELD_PAGE_LEN);
+    }
+
+    field_t field;
+
+    // first page
+    field_reset(&field, 0);
+    field_append(&field, data, 100);
+    field_append(&field, data + 100, sizeof(data) - 100);
+    assert_int_equal(field.length, sizeof(data));
+    assert_int_equal(field_page_count(&field), 3);
+    assert_int_equal(strlen(field.value), FIELD_PAGE_LEN);
+    assert_memory_equal(field.value, data, FIELD_PAGE_LEN);
+
+    // value split by appends across page boundary
+    field_reset(&field, 1);
+    field_append(&field, data, FIELD_PAGE_LEN + 5);
+    field_append(&field, data + FIELD_PAGE_LEN + 5, sizeof(data) - FIELD_PAGE_LEN - 5);
+    assert_int_equal(strlen(field.value), FIELD_PAGE_LEN);
+    assert_memory_equal(field.value, data + FIELD_PAGE_LEN, FIELD_PAGE_LEN);
+
+    // last page
+    field_reset(&field, 2);
+    field_append(&field, data, sizeof(data));
+    assert_string_equal(field.value, "cccccccccc");
+
+    // clearing value keeps selected page
+    field_clear_value(&field);
+    assert_int_equal(field.page, 2);
+    assert_int_equal(field.length, 0);
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_field_single_page), cmocka_unit_test(test_field_pages)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -13,7 +13,7 @@ static void test_get_operation_parser(void **state) {
     (void) state;
 
     uint8_t supported_ops[] = {0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 17, 18, 19, 20, 22,
-                               23, 24, 25, 26, 32, 33, 34, 36, 37, 38, 39, 40, 44, 45, 46, 47, 48, 49};
+                               23, 24, 25, 26, 32, 33, 34, 36, 37, 38, 39, 40, 42, 44, 45, 46, 47, 48, 49};
     uint8_t unsupported_ops[] = {14, 15, 16, 21, 50};
 
     for (uint8_t i = 0; i < sizeof(supported_ops); i++) {
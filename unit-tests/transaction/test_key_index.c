@@ -0,0 +1,174 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+#include "../unit-tests/mocks.h"
+#include "transaction/key_index.h"
+#include "transaction/parsers.h"
+#include "types.h"
+#include "globals.h"
+
+static parser_status_e parse(const uint8_t *data, size_t length, key_index_t *index) {
+    buffer_t buf = {.ptr = data, .size = length, .offset = 0};
+
+    return key_index_parse(&buf, index);
+}
+
+static void test_key_index_parse(void **state) {
+    (void) state;
+
+    key_index_t index = {0};
+
+    // accounts 5 and 6, owner and posting roles
+    const uint8_t config[] = {0x00, 0x00, 0x00, 0x05, 0x02, 0x11};
+    assert_int_equal(parse(config, sizeof(config), &index), PARSING_OK);
+    assert_int_equal(index.first_account, 5);
+    assert_int_equal(index.account_count, 2);
+    assert_int_equal(index.roles, 0x11);
+    assert_int_equal(index.size, 0);
+    assert_false(index.built);
+
+    // all roles of four accounts fill the index
+    const uint8_t full[] = {0x00, 0x00, 0x00, 0x00, 0x04, 0x1b};
+    assert_int_equal(parse(full, sizeof(full), &index), PARSING_OK);
+
+    // more keys than the index holds
+    const uint8_t too_many[] = {0x00, 0x00, 0x00, 0x00, 0x05, 0x1b};
+    assert_int_equal(parse(too_many, sizeof(too_many), &index), WRONG_LENGTH_ERROR);
+
+    // no accounts
+    const uint8_t no_accounts[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x1b};
+    assert_int_equal(parse(no_accounts, sizeof(no_accounts), &index), WRONG_LENGTH_ERROR);
+
+    // no roles and role 2 which is not defined by SLIP-48
+    const uint8_t no_roles[] = {0x00, 0x00, 0x00, 0x00, 0x01, 0x00};
+    assert_int_equal(parse(no_roles, sizeof(no_roles), &index), WRONG_LENGTH_ERROR);
+    const uint8_t unknown_role[] = {0x00, 0x00, 0x00, 0x00, 0x01, 0x04};
+    assert_int_equal(parse(unknown_role, sizeof(unknown_role), &index), WRONG_LENGTH_ERROR);
+
+    // accounts reaching hardened indices
+    const uint8_t hardened[] = {0x7f, 0xff, 0xff, 0xff, 0x02, 0x01};
+    assert_int_equal(parse(hardened, sizeof(hardened), &index), WRONG_LENGTH_ERROR);
+    const uint8_t last[] = {0x7f, 0xff, 0xff, 0xff, 0x01, 0x01};
+    assert_int_equal(parse(last, sizeof(last), &index), PARSING_OK);
+
+    // truncated and trailing data
+    assert_int_equal(parse(config, sizeof(config) - 1, &index), WRONG_LENGTH_ERROR);
+    const uint8_t trailing[] = {0x00, 0x00, 0x00, 0x05, 0x02, 0x11, 0x00};
+    assert_int_equal(parse(trailing, sizeof(trailing), &index), WRONG_LENGTH_ERROR);
+}
+
+static void test_key_index_defaults(void **state) {
+    (void) state;
+
+    key_index_t index = {0};
+
+    assert_int_equal(key_index_account_count(&index), 1);
+    assert_int_equal(key_index_roles(&index), KEY_INDEX_ALL_ROLES);
+
+    index.account_count = 3;
+    index.roles = 0x02;
+    assert_int_equal(key_index_account_count(&index), 3);
+    assert_int_equal(key_index_roles(&index), 0x02);
+}
+
+static void test_key_index_find(void **state) {
+    (void) state;
+
+    key_index_t index = {0};
+    uint8_t keys[MAX_KEY_INDEX_ENTRIES][PUBKEY_COMPRESSED_LEN];
+
+    // keys added in descending order of fingerprints
+    for (uint8_t i = 0; i < MAX_KEY_INDEX_ENTRIES; i++) {
+        memset(keys[i], 0, PUBKEY_COMPRESSED_LEN);
+        keys[i][0] = 0x02 + (i & 1);
+        keys[i][KEY_FINGERPRINT_LEN - 1] = 0xf0 - i;
+        keys[i][PUBKEY_COMPRESSED_LEN - 1] = i;
+        assert_true(key_index_add(&index, keys[i], i % 5, i / 4));
+    }
+    assert_int_equal(index.size, MAX_KEY_INDEX_ENTRIES);
+
+    // index is full
+    assert_false(key_index_add(&index, keys[0], 0, 0));
+
+    for (uint8_t i = 1; i < MAX_KEY_INDEX_ENTRIES; i++) {
+        assert_true(memcmp(index.entries[i - 1].fingerprint, index.entries[i].fingerprint, KEY_FINGERPRINT_LEN) < 0);
+    }
+
+    for (uint8_t i = 0; i < MAX_KEY_INDEX_ENTRIES; i++) {
+        const key_index_entry_t *entry = key_index_find(&index, keys[i]);
+
+        assert_non_null(entry);
+        assert_int_equal(entry->role, i % 5);
+        assert_int_equal(entry->account, i / 4);
+    }
+
+    // key with other parity of the same x-coordinate
+    uint8_t other[PUBKEY_COMPRESSED_LEN];
+    memcpy(other, keys[0], sizeof(other));
+    other[0] = 0x03;
+    assert_null(key_index_find(&index, other));
+
+    // key differing in the last byte of the fingerprint
+    memcpy(other, keys[5], sizeof(other));
+    other[KEY_FINGERPRINT_LEN - 1] ^= 0x01;
+    assert_null(key_index_find(&index, other));
+
+    // empty index
+    key_index_t empty = {0};
+    assert_null(key_index_find(&empty, keys[0]));
+}
+
+static void test_key_index_role_name(void **state) {
+    (void) state;
+
+    assert_string_equal(key_index_role_name(0), "owner");
+    assert_string_equal(key_index_role_name(1), "active");
+    assert_string_equal(key_index_role_name(3), "memo");
+    assert_string_equal(key_index_role_name(4), "posting");
+    assert_string_equal(key_index_role_name(2), "unknown");
+}
+
+static void test_key_index_ensure(void **state) {
+    (void) state;
+
+    // owner and posting keys of accounts 5 and 6
+    const uint8_t config[] = {0x00, 0x00, 0x00, 0x05, 0x02, 0x11};
+    memset(&G_key_index, 0, sizeof(G_key_index));
+    assert_int_equal(parse(config, sizeof(config), &G_key_index), PARSING_OK);
+
+    // vote shows no public keys, nothing is derived
+    key_index_ensure(get_operation_parser(0));
+    assert_false(G_key_index.built);
+    assert_int_equal(G_key_index.size, 0);
+
+    // account_update shows authorities
+    key_index_ensure(get_operation_parser(10));
+    assert_true(G_key_index.built);
+    assert_int_equal(G_key_index.size, 4);
+
+    const uint8_t posting[PUBKEY_COMPRESSED_LEN] = {0x02, 0x04, 0x06};
+    const key_index_entry_t *entry = key_index_find(&G_key_index, posting);
+    assert_non_null(entry);
+    assert_int_equal(entry->role, 4);
+    assert_int_equal(entry->account, 1);
+
+    const uint8_t active[PUBKEY_COMPRESSED_LEN] = {0x02, 0x01, 0x05};
+    assert_null(key_index_find(&G_key_index, active));
+
+    memset(&G_key_index, 0, sizeof(G_key_index));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_key_index_parse),
+                                       cmocka_unit_test(test_key_index_defaults),
+                                       cmocka_unit_test(test_key_index_find),
+                                       cmocka_unit_test(test_key_index_role_name),
+                                       cmocka_unit_test(test_key_index_ensure)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
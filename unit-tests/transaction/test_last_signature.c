@@ -0,0 +1,80 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+#include "transaction/last_signature.h"
+#include "types.h"
+#include "globals.h"
+
+// m/48'/13'/0'/0'/0'
+static const uint32_t path[] = {0x80000030, 0x8000000d, 0x80000000, 0x80000000, 0x80000000};
+
+static void store_signature(const uint8_t *digest, const uint8_t *signature) {
+    memcpy(G_context.bip32_path, path, sizeof(path));
+    G_context.bip32_path_len = 5;
+    last_signature_store(digest, signature);
+}
+
+static void test_last_signature_find(void **state) {
+    (void) state;
+
+    uint8_t digest[DIGEST_LEN], signature[SIGNATURE_LEN];
+    memset(digest, 0xd1, sizeof(digest));
+    memset(signature, 0x1f, sizeof(signature));
+    memset(&G_last_signature, 0, sizeof(G_last_signature));
+
+    // nothing signed yet
+    assert_null(last_signature_find(digest, path, 5));
+
+    store_signature(digest, signature);
+    const uint8_t *found = last_signature_find(digest, path, 5);
+    assert_non_null(found);
+    assert_memory_equal(found, signature, SIGNATURE_LEN);
+
+    // signature is bound to the key
+    assert_null(last_signature_find(digest, path, 4));
+    const uint32_t other_path[] = {0x80000030, 0x8000000d, 0x80000001, 0x80000000, 0x80000000};
+    assert_null(last_signature_find(digest, other_path, 5));
+
+    // and to the digest
+    digest[DIGEST_LEN - 1] ^= 0x01;
+    assert_null(last_signature_find(digest, path, 5));
+}
+
+static void test_last_signature_expiry(void **state) {
+    (void) state;
+
+    uint8_t digest[DIGEST_LEN], signature[SIGNATURE_LEN];
+    memset(digest, 0xd2, sizeof(digest));
+    memset(signature, 0x20, sizeof(signature));
+
+    store_signature(digest, signature);
+    for (uint16_t i = 0; i < LAST_SIGNATURE_TTL_TICKS - 1; i++) {
+        last_signature_tick();
+    }
+    assert_non_null(last_signature_find(digest, path, 5));
+
+    // wiped on the last tick
+    last_signature_tick();
+    assert_null(last_signature_find(digest, path, 5));
+    assert_int_equal(G_last_signature.signature[0], 0);
+
+    // no wrap around once expired
+    last_signature_tick();
+    assert_int_equal(G_last_signature.ttl, 0);
+
+    // new signature restarts the window
+    store_signature(digest, signature);
+    last_signature_tick();
+    assert_int_equal(G_last_signature.ttl, LAST_SIGNATURE_TTL_TICKS - 1);
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_last_signature_find), cmocka_unit_test(test_last_signature_expiry)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,152 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+#include "transaction/operation_ir.h"
+#include "transaction/parsers.h"
+#include "transaction/field.h"
+#include "types.h"
+#include "mocks.h"
+
+// clang-format off
+static uint8_t vote[] = {
+    0x00,                                            // vote
+    0x07, 0x65, 0x6e, 0x67, 0x72, 0x61, 0x76, 0x65,  // voter
+    0x06, 0x68, 0x69, 0x76, 0x65, 0x69, 0x6f,        // author
+    0x04, 0x74, 0x65, 0x73, 0x74,                    // permlink
+    0x88, 0x13                                       // weight
+};
+
+static uint8_t feed_publish[] = {
+    0x07,                                                  // feed_publish
+    0x07, 0x65, 0x6e, 0x67, 0x72, 0x61, 0x76, 0x65,        // publisher
+    0x38, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,  // base amount, precision
+    0x53, 0x42, 0x44, 0x00, 0x00, 0x00, 0x00,              // base symbol
+    0xe8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,  // quote amount, precision
+    0x53, 0x54, 0x45, 0x45, 0x4d, 0x00, 0x00               // quote symbol
+};
+
+static uint8_t custom_json[] = {
+    0x12,                                                                          // custom_json
+    0x00,                                                                          // required_auths
+    0x01, 0x07, 0x65, 0x6e, 0x67, 0x72, 0x61, 0x76, 0x65,                          // required_posting_auths
+    0x06, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77,                                      // id
+    0x35, 0x5b, 0x22, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x22, 0x2c, 0x7b, 0x22,  // json
+    0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x22, 0x3a, 0x22, 0x61,
+    0x22, 0x2c, 0x22, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67,
+    0x22, 0x3a, 0x22, 0x62, 0x22, 0x2c, 0x22, 0x77, 0x68, 0x61, 0x74, 0x22,
+    0x3a, 0x5b, 0x5d, 0x7d, 0x5d
+};
+// clang-format on
+
+static void test_operation_ir_build(void **state) {
+    (void) state;
+
+    operation_ir_t ir;
+    buffer_t operation = {.ptr = vote, .size = sizeof(vote), .offset = 0};
+
+    expect_any_cx_hash();
+    assert_true(operation_ir_build(&operation, get_operation_parser(vote[0]), &ir));
+    assert_int_equal(operation.offset, sizeof(vote));
+    assert_int_equal(ir.size, 5);
+
+    assert_int_equal(ir.fields[0].type, FIELD_TYPE_UINT);
+    assert_int_equal(operation_ir_uint(vote, &ir.fields[0]), 0);
+
+    const char *value;
+    assert_int_equal(ir.fields[2].type, FIELD_TYPE_STRING);
+    assert_int_equal(ir.fields[2].offset, 9);
+    assert_int_equal(ir.fields[2].length, 7);
+    assert_int_equal(operation_ir_string(vote, &ir.fields[2], &value), 6);
+    assert_memory_equal(value, "hiveio", 6);
+
+    assert_int_equal(ir.fields[4].type, FIELD_TYPE_UINT);
+    assert_int_equal(operation_ir_uint(vote, &ir.fields[4]), 5000);
+}
+
+static void test_operation_ir_build_truncated(void **state) {
+    (void) state;
+
+    operation_ir_t ir;
+    buffer_t operation = {.ptr = vote, .size = sizeof(vote) - 1, .offset = 0};
+
+    expect_any_cx_hash();
+    assert_false(operation_ir_build(&operation, get_operation_parser(vote[0]), &ir));
+    assert_int_equal(ir.size, 4);
+}
+
+static void test_operation_ir_asset(void **state) {
+    (void) state;
+
+    operation_ir_t ir;
+    asset_t asset;
+    buffer_t operation = {.ptr = feed_publish, .size = sizeof(feed_publish), .offset = 0};
+
+    expect_any_cx_hash();
+    assert_true(operation_ir_build(&operation, get_operation_parser(feed_publish[0]), &ir));
+    assert_int_equal(ir.fields[3].type, FIELD_TYPE_ASSET);
+
+    operation_ir_asset(feed_publish, &ir.fields[3], &asset);
+    assert_int_equal(asset.amount, 1000);
+    assert_int_equal(asset.precision, 3);
+    assert_string_equal(asset.symbol, "STEEM");
+
+    assert_true(operation_ir_equal(feed_publish, &ir.fields[1], feed_publish, &ir.fields[1]));
+    assert_false(operation_ir_equal(feed_publish, &ir.fields[2], feed_publish, &ir.fields[3]));
+}
+
+static void test_operation_ir_render(void **state) {
+    (void) state;
+
+    operation_ir_t ir;
+    field_t field;
+    buffer_t operation = {.ptr = vote, .size = sizeof(vote), .offset = 0};
+
+    expect_any_cx_hash();
+    assert_true(operation_ir_build(&operation, get_operation_parser(vote[0]), &ir));
+
+    field_reset(&field, 0);
+    assert_true(operation_ir_render(vote, get_operation_parser(vote[0]), &ir, 3, &field));
+    assert_string_equal(field.value, "test");
+
+    field_reset(&field, 0);
+    assert_true(operation_ir_render(vote, get_operation_parser(vote[0]), &ir, 4, &field));
+    assert_string_equal(field.value, "50.00%");
+}
+
+static void test_operation_ir_render_custom_json(void **state) {
+    (void) state;
+
+    operation_ir_t ir;
+    field_t field;
+    buffer_t operation = {.ptr = custom_json, .size = sizeof(custom_json), .offset = 0};
+
+    expect_any_cx_hash();
+    assert_true(operation_ir_build(&operation, get_operation_parser(custom_json[0]), &ir));
+    assert_int_equal(ir.fields[4].type, FIELD_TYPE_JSON);
+
+    // payload is rendered with the id of the same operation
+    field_reset(&field, 0);
+    assert_true(operation_ir_render(custom_json, get_operation_parser(custom_json[0]), &ir, 4, &field));
+    assert_string_equal(field.value, "@a unfollows @b");
+
+    // without the id the payload is displayed raw
+    ir.fields[3].type = FIELD_TYPE_COMPOSITE;
+    field_reset(&field, 0);
+    assert_true(operation_ir_render(custom_json, get_operation_parser(custom_json[0]), &ir, 4, &field));
+    assert_string_equal(field.value, "[\"follow\",{\"follower\":\"a\",\"following\":\"b\",\"what\":[]}]");
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_operation_ir_build),
+                                       cmocka_unit_test(test_operation_ir_build_truncated),
+                                       cmocka_unit_test(test_operation_ir_asset),
+                                       cmocka_unit_test(test_operation_ir_render),
+                                       cmocka_unit_test(test_operation_ir_render_custom_json)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
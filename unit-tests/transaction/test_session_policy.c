@@ -0,0 +1,282 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cmocka.h>
+#include "transaction/session_policy.h"
+#include "transaction/parsers.h"
+#include "transaction/operation_ir.h"
+#include "types.h"
+#include "globals.h"
+#include "mocks.h"
+
+static const uint32_t bip32_path[] = {0x80000030, 0x8000000d, 0x80000000, 0x80000000, 0x80000000};
+
+static void test_session_policy_parse_vote(void **state) {
+    (void) state;
+
+    // m/48'/13'/0'/0'/0', vote, 10 signatures, engrave, -100.00% - 50.00%
+    uint8_t data[] = {0x05, 0x80, 0x00, 0x00, 0x30, 0x80, 0x00, 0x00, 0x0d, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00,
+                      0x00, 0x00, 0x00, 0x00, 0x0a, 0x07, 0x65, 0x6e, 0x67, 0x72, 0x61, 0x76, 0x65, 0xd8, 0xf0, 0x13, 0x88};
+
+    buffer_t buf = {.ptr = data, .size = sizeof(data), .offset = 0};
+    session_policy_t policy;
+
+    assert_int_equal(session_policy_parse(&buf, &policy), PARSING_OK);
+    assert_int_equal(policy.bip32_path_len, 5);
+    assert_int_equal(policy.operation, OPERATION_VOTE);
+    assert_int_equal(policy.remaining, 10);
+    assert_string_equal(policy.account, "engrave");
+    assert_int_equal(policy.min_weight, -10000);
+    assert_int_equal(policy.max_weight, 5000);
+    assert_false(policy.active);
+
+    // trailing byte
+    uint8_t trailing[sizeof(data) + 1];
+    memcpy(trailing, data, sizeof(data));
+    buf = (buffer_t){.ptr = trailing, .size = sizeof(trailing), .offset = 0};
+    assert_int_equal(session_policy_parse(&buf, &policy), WRONG_LENGTH_ERROR);
+
+    // weight range out of bounds
+    data[sizeof(data) - 2] = 0x27;
+    data[sizeof(data) - 1] = 0x11;
+    buf = (buffer_t){.ptr = data, .size = sizeof(data), .offset = 0};
+    assert_int_equal(session_policy_parse(&buf, &policy), FIELD_PARSING_ERROR);
+
+    // max weight lower than min weight
+    data[sizeof(data) - 2] = 0xd8;
+    data[sizeof(data) - 1] = 0xef;
+    buf = (buffer_t){.ptr = data, .size = sizeof(data), .offset = 0};
+    assert_int_equal(session_policy_parse(&buf, &policy), FIELD_PARSING_ERROR);
+}
+
+static void test_session_policy_parse_custom_json(void **state) {
+    (void) state;
+
+    // m/48'/13'/0'/0'/0', custom_json, until app exit, engrave, follow
+    uint8_t data[] = {0x05, 0x80, 0x00, 0x00, 0x30, 0x80, 0x00, 0x00, 0x0d, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+                      0x12, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x67, 0x72, 0x61, 0x76, 0x65, 0x06, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77};
+
+    buffer_t buf = {.ptr = data, .size = sizeof(data), .offset = 0};
+    session_policy_t policy;
+
+    assert_int_equal(session_policy_parse(&buf, &policy), PARSING_OK);
+    assert_int_equal(policy.operation, OPERATION_CUSTOM_JSON);
+    assert_int_equal(policy.remaining, 0);
+    assert_string_equal(policy.account, "engrave");
+    assert_string_equal(policy.custom_json_id, "follow");
+
+    // truncated id
+    buf = (buffer_t){.ptr = data, .size = sizeof(data) - 1, .offset = 0};
+    assert_int_equal(session_policy_parse(&buf, &policy), FIELD_PARSING_ERROR);
+
+    // unsupported operation
+    data[21] = 0x02;
+    buf = (buffer_t){.ptr = data, .size = sizeof(data), .offset = 0};
+    assert_int_equal(session_policy_parse(&buf, &policy), FIELD_PARSING_ERROR);
+
+    // missing bip32 path
+    buf = (buffer_t){.ptr = data, .size = 3, .offset = 0};
+    assert_int_equal(session_policy_parse(&buf, &policy), BIP32_PATH_PARSING_ERROR);
+}
+
+static void test_session_policy_consume(void **state) {
+    (void) state;
+
+    session_policy_t policy = {.active = true, .remaining = 2};
+
+    session_policy_consume(&policy);
+    assert_true(policy.active);
+    assert_int_equal(policy.remaining, 1);
+
+    session_policy_consume(&policy);
+    assert_false(policy.active);
+
+    // unlimited policy is kept until the app exits
+    policy = (session_policy_t){.active = true, .remaining = 0};
+    session_policy_consume(&policy);
+    assert_true(policy.active);
+}
+
+/**
+ * Settings are const NVM variables, make their page writable as flash would be
+ */
+static void set_session_signing_policy(session_signing_policy_t value) {
+    long page_size = sysconf(_SC_PAGESIZE);
+    uintptr_t start = (uintptr_t) &N_settings_nvram & ~((uintptr_t) page_size - 1);
+    uintptr_t end = (uintptr_t) &N_settings_nvram + sizeof(settings_t);
+
+    assert_int_equal(mprotect((void *) start, end - start, PROT_READ | PROT_WRITE), 0);
+    ((settings_t *) &N_settings_nvram)->session_signing_policy = value;
+}
+
+static void load_operation(uint8_t *data, size_t size) {
+    G_context.bip32_path_len = sizeof(bip32_path) / sizeof(bip32_path[0]);
+    memcpy(G_context.bip32_path, bip32_path, sizeof(bip32_path));
+    G_context.tx_info.operation = (buffer_t){.ptr = data, .size = size, .offset = 0};
+    G_context.tx_info.parser = get_operation_parser(data[0]);
+
+    expect_any_cx_hash();
+    assert_true(operation_ir_build(&G_context.tx_info.operation, G_context.tx_info.parser, &G_context.tx_info.ir));
+}
+
+static void load_vote(int16_t weight) {
+    // clang-format off
+    static uint8_t data[] = {
+        0x00,                                            // vote
+        0x07, 0x65, 0x6e, 0x67, 0x72, 0x61, 0x76, 0x65,  // voter
+        0x06, 0x68, 0x69, 0x76, 0x65, 0x69, 0x6f,        // author
+        0x04, 0x74, 0x65, 0x73, 0x74,                    // permlink
+        0x00, 0x00                                       // weight
+    };
+    // clang-format on
+
+    data[sizeof(data) - 2] = (uint16_t) weight & 0xff;
+    data[sizeof(data) - 1] = (uint16_t) weight >> 8;
+    load_operation(data, sizeof(data));
+}
+
+/**
+ * Serialize custom_json with given authorities and id, auths are space separated account names
+ */
+static void load_custom_json(uint8_t *data, const char *required_auths, const char *required_posting_auths, const char *id) {
+    const char *auths[] = {required_auths, required_posting_auths};
+    size_t offset = 0;
+
+    data[offset++] = 0x12;  // custom_json
+
+    for (size_t i = 0; i < 2; i++) {
+        size_t count_offset = offset++;
+        data[count_offset] = 0;
+
+        for (const char *name = auths[i]; *name != '\0';) {
+            size_t length = strcspn(name, " ");
+            data[offset++] = length;
+            memcpy(data + offset, name, length);
+            offset += length;
+            data[count_offset]++;
+            name += length + (name[length] == ' ');
+        }
+    }
+
+    data[offset++] = strlen(id);
+    memcpy(data + offset, id, strlen(id));
+    offset += strlen(id);
+
+    data[offset++] = 2;  // json
+    memcpy(data + offset, "{}", 2);
+    offset += 2;
+
+    load_operation(data, offset);
+}
+
+static void test_session_policy_match_vote(void **state) {
+    (void) state;
+
+    session_policy_t policy = {.active = true, .operation = OPERATION_VOTE, .account = "engrave", .min_weight = -10000, .max_weight = 0};
+    policy.bip32_path_len = sizeof(bip32_path) / sizeof(bip32_path[0]);
+    memcpy(policy.bip32_path, bip32_path, sizeof(bip32_path));
+    set_session_signing_policy(SESSION_SIGNING_ENABLED);
+
+    // weight is signed, both bounds are inclusive
+    load_vote(-1);
+    assert_true(session_policy_match(&policy));
+    load_vote(-10000);
+    assert_true(session_policy_match(&policy));
+    load_vote(0);
+    assert_true(session_policy_match(&policy));
+
+    // weight out of range
+    load_vote(1);
+    assert_false(session_policy_match(&policy));
+    policy.min_weight = -5000;
+    load_vote(-5001);
+    assert_false(session_policy_match(&policy));
+
+    // wrong account
+    load_vote(-1);
+    strcpy(policy.account, "hiveio");
+    assert_false(session_policy_match(&policy));
+    strcpy(policy.account, "engrav");
+    assert_false(session_policy_match(&policy));
+    strcpy(policy.account, "engrave");
+    assert_true(session_policy_match(&policy));
+
+    // wrong path
+    G_context.bip32_path[4] = 0x80000001;
+    assert_false(session_policy_match(&policy));
+    G_context.bip32_path_len = 4;
+    assert_false(session_policy_match(&policy));
+
+    // policy bound to another operation
+    load_vote(-1);
+    policy.operation = OPERATION_CUSTOM_JSON;
+    assert_false(session_policy_match(&policy));
+    policy.operation = OPERATION_VOTE;
+
+    // setting disabled, policy not approved
+    set_session_signing_policy(SESSION_SIGNING_DISABLED);
+    assert_false(session_policy_match(&policy));
+    set_session_signing_policy(SESSION_SIGNING_ENABLED);
+    policy.active = false;
+    assert_false(session_policy_match(&policy));
+}
+
+static void test_session_policy_match_custom_json(void **state) {
+    (void) state;
+
+    uint8_t data[64];
+    session_policy_t policy = {.active = true, .operation = OPERATION_CUSTOM_JSON, .account = "engrave", .custom_json_id = "follow"};
+    policy.bip32_path_len = sizeof(bip32_path) / sizeof(bip32_path[0]);
+    memcpy(policy.bip32_path, bip32_path, sizeof(bip32_path));
+    set_session_signing_policy(SESSION_SIGNING_ENABLED);
+
+    load_custom_json(data, "", "engrave", "follow");
+    assert_true(session_policy_match(&policy));
+
+    // id mismatch
+    load_custom_json(data, "", "engrave", "follo");
+    assert_false(session_policy_match(&policy));
+    load_custom_json(data, "", "engrave", "rc");
+    assert_false(session_policy_match(&policy));
+
+    // empty id matches any id
+    policy.custom_json_id[0] = '\0';
+    assert_true(session_policy_match(&policy));
+
+    // active authority is never covered
+    load_custom_json(data, "engrave", "engrave", "follow");
+    assert_false(session_policy_match(&policy));
+    load_custom_json(data, "engrave", "", "follow");
+    assert_false(session_policy_match(&policy));
+
+    // policy account has to be the only posting authority
+    load_custom_json(data, "", "engrave hiveio", "follow");
+    assert_false(session_policy_match(&policy));
+    load_custom_json(data, "", "hiveio engrave", "follow");
+    assert_false(session_policy_match(&policy));
+    load_custom_json(data, "", "hiveio", "follow");
+    assert_false(session_policy_match(&policy));
+
+    // setting disabled
+    load_custom_json(data, "", "engrave", "follow");
+    assert_true(session_policy_match(&policy));
+    set_session_signing_policy(SESSION_SIGNING_DISABLED);
+    assert_false(session_policy_match(&policy));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_session_policy_parse_vote),
+                                       cmocka_unit_test(test_session_policy_parse_custom_json),
+                                       cmocka_unit_test(test_session_policy_match_vote),
+                                       cmocka_unit_test(test_session_policy_match_custom_json),
+                                       cmocka_unit_test(test_session_policy_consume)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,120 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+#include "transaction/summary.h"
+#include "transaction/parsers.h"
+#include "transaction/operation_ir.h"
+#include "types.h"
+#include "globals.h"
+#include "mocks.h"
+
+static void load_operation(uint8_t *data, size_t size) {
+    G_context.tx_info.operation = (buffer_t){.ptr = data, .size = size, .offset = 0};
+    G_context.tx_info.parser = get_operation_parser(data[0]);
+
+    expect_any_cx_hash();
+    assert_true(operation_ir_build(&G_context.tx_info.operation, G_context.tx_info.parser, &G_context.tx_info.ir));
+}
+
+static void test_summary_vote(void **state) {
+    (void) state;
+
+    // clang-format off
+    uint8_t data[] = {
+        0x00,                                            // vote
+        0x07, 0x65, 0x6e, 0x67, 0x72, 0x61, 0x76, 0x65,  // voter
+        0x06, 0x68, 0x69, 0x76, 0x65, 0x69, 0x6f,        // author
+        0x04, 0x74, 0x65, 0x73, 0x74,                    // permlink
+        0x88, 0x13                                       // weight
+    };
+    // clang-format on
+
+    char summary[255];
+    load_operation(data, sizeof(data));
+
+    assert_true(summary_format(summary, sizeof(summary)));
+    assert_string_equal(summary, "Vote 50.00% @hiveio/test by @engrave");
+
+    // summary which does not fit the buffer is not displayed
+    assert_false(summary_format(summary, 20));
+}
+
+/**
+ * Serialize custom_json with no active auths and a single posting auth
+ */
+static size_t build_custom_json(uint8_t *data, const char *posting, const char *id, const char *json) {
+    size_t offset = 0;
+    size_t json_len = strlen(json);
+
+    data[offset++] = 0x12;  // custom_json
+    data[offset++] = 0x00;  // required_auths
+    data[offset++] = 0x01;  // required_posting_auths
+    data[offset++] = strlen(posting);
+    memcpy(data + offset, posting, strlen(posting));
+    offset += strlen(posting);
+    data[offset++] = strlen(id);
+    memcpy(data + offset, id, strlen(id));
+    offset += strlen(id);
+
+    // varint length of the payload
+    do {
+        data[offset++] = (json_len & 0x7f) | (json_len > 0x7f ? 0x80 : 0);
+        json_len >>= 7;
+    } while (json_len > 0);
+
+    memcpy(data + offset, json, strlen(json));
+    return offset + strlen(json);
+}
+
+static void test_summary_custom_json(void **state) {
+    (void) state;
+
+    uint8_t data[512];
+    char json[300];
+    char summary[255];
+
+    load_operation(data, build_custom_json(data, "alice", "follow", "[\"follow\",{\"follower\":\"alice\",\"following\":\"bob\",\"what\":[\"blog\"]}]"));
+
+    assert_true(summary_format(summary, sizeof(summary)));
+    assert_string_equal(summary, "custom_json follow: @alice follows @bob posting: [ alice ] active: [  ]");
+
+    // payload which does not fit a single page is reviewed field by field
+    memset(json, 'a', sizeof(json) - 3);
+    json[0] = '"';
+    json[sizeof(json) - 3] = '"';
+    json[sizeof(json) - 2] = '\0';
+    load_operation(data, build_custom_json(data, "alice", "follow", json));
+
+    assert_false(summary_format(summary, sizeof(summary)));
+}
+
+static void test_summary_not_supported(void **state) {
+    (void) state;
+
+    // clang-format off
+    uint8_t data[] = {
+        0x0c,                                            // account_witness_vote
+        0x07, 0x65, 0x6e, 0x67, 0x72, 0x61, 0x76, 0x65,  // account
+        0x07, 0x65, 0x6e, 0x67, 0x72, 0x61, 0x76, 0x65,  // witness
+        0x01                                             // approve
+    };
+    // clang-format on
+
+    char summary[255];
+    load_operation(data, sizeof(data));
+
+    assert_false(summary_format(summary, sizeof(summary)));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_summary_vote),
+                                       cmocka_unit_test(test_summary_custom_json),
+                                       cmocka_unit_test(test_summary_not_supported)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,90 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+#include "transaction/template_diff.h"
+#include "transaction/parsers.h"
+#include "transaction/operation_ir.h"
+#include "types.h"
+#include "globals.h"
+#include "mocks.h"
+
+// clang-format off
+static uint8_t feed_publish[] = {
+    0x07,                                                  // feed_publish
+    0x07, 0x65, 0x6e, 0x67, 0x72, 0x61, 0x76, 0x65,        // publisher
+    0x38, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,  // base amount, precision
+    0x53, 0x42, 0x44, 0x00, 0x00, 0x00, 0x00,              // base symbol
+    0xe8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,  // quote amount, precision
+    0x53, 0x54, 0x45, 0x45, 0x4d, 0x00, 0x00               // quote symbol
+};
+// clang-format on
+
+static void load_operation(uint8_t *data, size_t size) {
+    G_context.tx_info.operation = (buffer_t){.ptr = data, .size = size, .offset = 0};
+    G_context.tx_info.parser = get_operation_parser(data[0]);
+    G_context.bip32_path_len = 5;
+
+    expect_any_cx_hash();
+    assert_true(operation_ir_build(&G_context.tx_info.operation, G_context.tx_info.parser, &G_context.tx_info.ir));
+}
+
+static void test_template_diff_without_template(void **state) {
+    (void) state;
+
+    memset(G_operation_templates, 0, sizeof(G_operation_templates));
+    load_operation(feed_publish, sizeof(feed_publish));
+
+    assert_false(template_diff_compute());
+    assert_int_equal(G_context.tx_info.changed_fields, TEMPLATE_DIFF_ALL_FIELDS);
+    assert_true(template_diff_is_changed(1));
+    assert_true(template_diff_is_changed(3));
+}
+
+static void test_template_diff_changed_base(void **state) {
+    (void) state;
+
+    memset(G_operation_templates, 0, sizeof(G_operation_templates));
+    load_operation(feed_publish, sizeof(feed_publish));
+    template_diff_store();
+
+    uint8_t next[sizeof(feed_publish)];
+    memcpy(next, feed_publish, sizeof(feed_publish));
+    next[9] = 0x3e;  // 0.318 HBD
+    load_operation(next, sizeof(next));
+
+    assert_true(template_diff_compute());
+    assert_true(template_diff_is_changed(0));
+    assert_false(template_diff_is_changed(1));
+    assert_true(template_diff_is_changed(2));
+    assert_false(template_diff_is_changed(3));
+
+    field_t field = {0};
+    strcpy(field.value, "0.318 HBD");
+    template_diff_format_field(2, &field);
+    assert_string_equal(field.value, "0.312 HBD -> 0.318 HBD");
+    assert_int_equal(field.length, strlen("0.312 HBD -> 0.318 HBD"));
+
+    // previous value does not fit next to the current one, only the current one is displayed
+    memset(&field, 0, sizeof(field));
+    memset(field.value, 'x', 245);
+    field.length = 245;
+    template_diff_format_field(2, &field);
+    assert_int_equal(strlen(field.value), 245);
+    assert_int_equal(field.length, 245);
+
+    // template is bound to the signing key
+    G_context.bip32_path_len = 4;
+    assert_false(template_diff_compute());
+    assert_int_equal(G_context.tx_info.changed_fields, TEMPLATE_DIFF_ALL_FIELDS);
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_template_diff_without_template), cmocka_unit_test(test_template_diff_changed_base)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}